@@ -64,11 +64,19 @@ static void calc_fft(struct my_worker_instance_s *inst, memblk_t *out)
 {
   uint32_t i;
   float max;
-  float *pcm = (float *)memblk_dataptr(&inst->pcm_float);
+  float *pcm = (float *)memblk_ring_dataptr(&inst->pcm_float);
+  int span = memblk_ring_dataspan(&inst->pcm_float) / sizeof(float);
+
+  /* Apply window. pcm_float is a full ring buffer,
+   * so the data may be wrapped around the end of the memory.
+   */
+
+  arm_mult_f32(pcm, fft_window, fft_input, span);
+  arm_mult_f32((float *)inst->pcm_float.addr, &fft_window[span],
+               &fft_input[span], FFT_TAPS - span);
 
   /* Calculate FFT with log */
 
-  arm_mult_f32(pcm, fft_window, fft_input, FFT_TAPS);
   arm_rfft_fast_f32(&inst->rfft, fft_input, fft_tmp, 0);
   arm_cmplx_mag_f32(fft_tmp, fft_power, FFT_TAPSHALF);
 
@@ -98,6 +106,7 @@ static void calc_fft(struct my_worker_instance_s *inst, memblk_t *out)
 static int on_process(void *arg)
 {
   memblk_t *fft_out;
+  memblk_t view;
   struct my_worker_instance_s *inst =
     (struct my_worker_instance_s *)arg;
 
@@ -127,8 +136,16 @@ static int on_process(void *arg)
       return AL_COMMFW_RET_OK;  /* Wait for memory to output */
     }
 
-  memblk_shift_drop(&inst->pcm_float, sizeof(float) * FFT_TAPSHALF);
-  memblk_conv_pcm16tofloat(&inst->pcm_float, &inst->pcm_cache);
+  /* Slide the window by half taps without moving data */
+
+  memblk_ring_drop(&inst->pcm_float, sizeof(float) * FFT_TAPSHALF);
+  while (!memblk_is_empty(&inst->pcm_cache) &&
+         memblk_ring_fillview(&inst->pcm_float, &view) > 0)
+    {
+      memblk_conv_pcm16tofloat(&view, &inst->pcm_cache);
+      memblk_ring_commit(&inst->pcm_float, view.filled);
+    }
+
   calc_fft(inst, fft_out);
 
   FREE_MEMBLK(fft_out, inst);
@@ -154,6 +171,10 @@ int main(void)
 
   memblk_init(&g_instance.pcm_cache, (char *)pcm_cache_mem, sizeof(pcm_cache_mem));
   memblk_init(&g_instance.pcm_float, (char *)pcm_float_mem, sizeof(pcm_float_mem));
+
+  /* Start with the full ring buffer of silence */
+
+  memblk_ring_commit(&g_instance.pcm_float, sizeof(pcm_float_mem));
   arm_rfft_fast_init_f32(&g_instance.rfft, FFT_TAPS);
   init_hanningw(fft_window, FFT_TAPS);
 
@@ -81,6 +81,7 @@ extern "C"
 int main(int argc, FAR char *argv[])
 {
   int ret;
+  int ch;
   my_mp3listener lsn;
   int volume = 1000;
   struct pollfd pfd;
@@ -200,10 +201,17 @@ int main(int argc, FAR char *argv[])
       poll(&pfd, 1, 10 /* ms */);
       if (pfd.revents & POLLIN)
         {
-          if (getchar() == 'q')
+          ch = getchar();
+          if (ch == 'q')
             {
               break;
             }
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+          else if (ch == 'p')
+            {
+              audiolite_profile_dump();
+            }
+#endif
         }
     }
 
@@ -1 +1,18 @@
 THIRD_PARTY_CC_SRCS = $(SPRESENSE_CURDIR)/c-runtime/tf_runtime.cc
+
+ifeq ($(CONFIG_EXTERNALS_TENSORFLOW_RT_MODELOPS),y)
+TF_RT_OPS_MODEL = $(subst ",,$(CONFIG_EXTERNALS_TENSORFLOW_RT_OPS_MODEL))
+TF_RT_OPS_FILE = $(patsubst "%",%,$(CONFIG_EXTERNALS_TENSORFLOW_RT_OPS_FILE))
+
+# Generated from the models by externals/tensorflow/Makefile
+
+ifneq ($(TF_RT_OPS_MODEL),)
+TF_RT_OPS_FILE := $(SPRESENSE_CURDIR)/c-runtime/tf_rt_ops_gen.h
+endif
+
+ifeq ($(TF_RT_OPS_FILE),)
+$(error CONFIG_EXTERNALS_TENSORFLOW_RT_OPS_MODEL or _OPS_FILE is not set)
+endif
+
+CXXFLAGS += -DTF_RT_OPS_FILE=\"$(TF_RT_OPS_FILE)\"
+endif
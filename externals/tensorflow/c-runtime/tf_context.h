@@ -40,13 +40,195 @@
  * Included Files
  ****************************************************************************/
 
+#include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/micro/simple_memory_allocator.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Maximum number of kernels replaced by tf_rt_set_kernel() */
+
+#define TF_RT_MAX_KERNELS  (8)
 
 /****************************************************************************
  * Public Types
  ****************************************************************************/
 
+/* Arena allocator of tflmrt.
+ *
+ * TFLM puts non-persistent buffers (activations and scratch buffers) on
+ * the head of the arena, and persistent ones (tensor structures, op data
+ * and variable tensors) on the tail.
+ * If a persistent region is given, tail allocations are taken from it
+ * instead, so the scratch region holds non-persistent buffers only and can
+ * be shared by models executed one after another.
+ * It also records the peak of temporary allocations on the scratch region
+ * to tell the minimal scratch size needed by AllocateTensors().
+ */
+
+class tf_rt_arena_allocator : public tflite::SimpleMemoryAllocator
+{
+public:
+  tf_rt_arena_allocator(tflite::ErrorReporter *reporter,
+                        uint8_t *scratch, size_t scratch_size,
+                        uint8_t *persist, size_t persist_size)
+    : tflite::SimpleMemoryAllocator(reporter, scratch, scratch_size),
+      _reporter(reporter), _scratch(scratch), _temp_peak(0),
+      _persist(persist), _persist_end(persist + persist_size),
+      _persist_tail(persist + persist_size)
+  {
+  }
+
+  uint8_t *AllocateFromTail(size_t size, size_t alignment) override
+  {
+    if (_persist == NULL)
+      {
+        return tflite::SimpleMemoryAllocator::AllocateFromTail(size,
+                                                               alignment);
+      }
+
+    uint8_t *p = tflite::AlignPointerDown(_persist_tail - size, alignment);
+    if (p < _persist || p > _persist_tail)
+      {
+        TF_LITE_REPORT_ERROR(_reporter,
+                             "Persistent region is short by %d bytes",
+                             (int)(_persist - p));
+        return NULL;
+      }
+
+    _persist_tail = p;
+    return p;
+  }
+
+  uint8_t *AllocateTemp(size_t size, size_t alignment) override
+  {
+    uint8_t *p = tflite::SimpleMemoryAllocator::AllocateTemp(size,
+                                                              alignment);
+    if (p != NULL && (size_t)(p + size - _scratch) > _temp_peak)
+      {
+        _temp_peak = p + size - _scratch;
+      }
+
+    return p;
+  }
+
+  size_t persistent_used(void) const
+  {
+    return _persist ? (size_t)(_persist_end - _persist_tail)
+                    : GetTailUsedBytes();
+  }
+
+  size_t scratch_used(void) const
+  {
+    size_t head = GetHeadUsedBytes();
+    return head > _temp_peak ? head : _temp_peak;
+  }
+
+private:
+  tflite::ErrorReporter *_reporter;
+  uint8_t *_scratch;
+  size_t _temp_peak;
+  uint8_t *_persist;
+  uint8_t *_persist_end;
+  uint8_t *_persist_tail;
+};
+
+/* Op resolver of tflmrt.
+ *
+ * It returns the kernels set by tf_rt_set_kernel() in preference to the
+ * ones of the base resolver. The base kernels stay reachable, so that a
+ * replacement can fall back to them for unsupported cases.
+ */
+
+class tf_rt_kernel_resolver : public tflite::MicroOpResolver
+{
+public:
+  explicit tf_rt_kernel_resolver(const tflite::MicroOpResolver &base)
+    : _base(base), _num(0)
+  {
+  }
+
+  const TfLiteRegistration *FindOp(tflite::BuiltinOperator op)
+    const override
+  {
+    for (int i = 0; i < _num; i++)
+      {
+        if (_ops[i] == op)
+          {
+            return _kernels[i];
+          }
+      }
+
+    return _base.FindOp(op);
+  }
+
+  const TfLiteRegistration *FindOp(const char *op) const override
+  {
+    return _base.FindOp(op);
+  }
+
+  BuiltinParseFunction GetOpDataParser(tflite::BuiltinOperator op)
+    const override
+  {
+    return _base.GetOpDataParser(op);
+  }
+
+  const TfLiteRegistration *FindBaseOp(tflite::BuiltinOperator op) const
+  {
+    return _base.FindOp(op);
+  }
+
+  bool SetOp(tflite::BuiltinOperator op, const TfLiteRegistration *kernel)
+  {
+    int i;
+
+    for (i = 0; i < _num && _ops[i] != op; i++);
+
+    if (kernel == NULL)
+      {
+        if (i < _num)
+          {
+            _num--;
+            _ops[i] = _ops[_num];
+            _kernels[i] = _kernels[_num];
+          }
+
+        return true;
+      }
+
+    if (i == TF_RT_MAX_KERNELS)
+      {
+        return false;
+      }
+
+    _ops[i] = op;
+    _kernels[i] = kernel;
+    if (i == _num)
+      {
+        _num++;
+      }
+
+    return true;
+  }
+
+private:
+  const tflite::MicroOpResolver &_base;
+  int _num;
+  tflite::BuiltinOperator _ops[TF_RT_MAX_KERNELS];
+  const TfLiteRegistration *_kernels[TF_RT_MAX_KERNELS];
+};
+
+/* The interpreter is constructed in interpreter_storage and lives until
+ * tf_rt_free_context(), so each context keeps its model resident with
+ * tensors allocated in its own arena. In shared scratch mode,
+ * tensor_arena is the persistent region, and the scratch region is owned
+ * by the application.
+ */
+
 typedef struct
 {
   tflite::ErrorReporter *error_reporter;
@@ -54,6 +236,11 @@ typedef struct
   tflite::MicroInterpreter *interpreter;
   int tensor_arena_size;
   uint8_t *tensor_arena;
+  tf_rt_arena_allocator *allocator;  /* Only in shared scratch mode */
+  alignas(tflite::MicroInterpreter)
+    uint8_t interpreter_storage[sizeof(tflite::MicroInterpreter)];
+  alignas(tf_rt_arena_allocator)
+    uint8_t allocator_storage[sizeof(tf_rt_arena_allocator)];
 } tf_rt_context_t;
 
 #endif /* __EXTERNALS_TENSORFLOW_C_RUNTIME_TF_CONTEXT_H */
@@ -38,19 +38,130 @@
  ****************************************************************************/
 
 #include <stdlib.h>
+#include <new>
 
 #include "tf_runtime.h"
 #include "tf_context.h"
 
-#include "tensorflow/lite/micro/all_ops_resolver.h"
+#ifdef TF_RT_OPS_FILE
+#  include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#else
+#  include "tensorflow/lite/micro/all_ops_resolver.h"
+#endif
+#include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/system_setup.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* TF_RT_OPS_FILE lists the ops to register as TF_RT_OP(<op>) lines, where
+ * <op> is the suffix of MicroMutableOpResolver::Add<op>(). It is given by
+ * CONFIG_EXTERNALS_TENSORFLOW_RT_OPS_FILE or generated by tflite_ops.py.
+ * Without it, all the ops are registered.
+ */
+
+#ifdef TF_RT_OPS_FILE
+#  define TF_RT_OP(op) + 1
+enum
+{
+  TF_RT_NUM_OPS = 0
+#  include TF_RT_OPS_FILE
+};
+#  undef TF_RT_OP
+
+typedef tflite::MicroMutableOpResolver<TF_RT_NUM_OPS> tf_rt_resolver_t;
+#else
+typedef tflite::AllOpsResolver tf_rt_resolver_t;
+#endif
+
+/* Margin added to probed sizes because the alignment padding depends on
+ * the address of the arena.
+ */
+
+#define TF_RT_ARENA_ALIGN_MARGIN  (16)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The resolver and the error reporter are shared by all the contexts.
+ * Interpreters refer them after tf_rt_initialize_context() returns.
+ */
+
+static tf_rt_kernel_resolver *g_resolver;
+static tflite::MicroErrorReporter g_error_reporter;
+alignas(tf_rt_resolver_t) static uint8_t
+  g_base_resolver_storage[sizeof(tf_rt_resolver_t)];
+alignas(tf_rt_kernel_resolver) static uint8_t
+  g_resolver_storage[sizeof(tf_rt_kernel_resolver)];
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
 void *(*tf_rt_malloc_func)(size_t size) = malloc;
 void (*tf_rt_free_func)(void *ptr) = free;
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static tf_rt_kernel_resolver *tf_rt_get_resolver(void)
+{
+  if (g_resolver != NULL)
+    {
+      return g_resolver;
+    }
+
+  tf_rt_resolver_t *r = new (g_base_resolver_storage) tf_rt_resolver_t();
+
+#ifdef TF_RT_OPS_FILE
+#  define TF_RT_OP(op) \
+  if (r->Add##op() != kTfLiteOk) \
+    { \
+      return NULL; \
+    }
+#  include TF_RT_OPS_FILE
+#  undef TF_RT_OP
+#endif
+
+  g_resolver = new (g_resolver_storage) tf_rt_kernel_resolver(*r);
+  return g_resolver;
+}
+
+static int tf_rt_load_model(const void *n, const tflite::Model **model,
+                            tf_rt_kernel_resolver **resolver)
+{
+  tflite::InitializeTarget();
+
+  /* Map the model into a usable data structure. This doesn't involve any
+   * copying or parsing, it's a very lightweight operation.
+   */
+
+  *model = tflite::GetModel(n);
+  if ((*model)->version() != TFLITE_SCHEMA_VERSION)
+    {
+      TF_LITE_REPORT_ERROR(&g_error_reporter,
+                          "Model provided is schema version %d not equal "
+                          "to supported version %d.",
+                          (*model)->version(), TFLITE_SCHEMA_VERSION);
+      return -EPERM;
+    }
+
+  *resolver = tf_rt_get_resolver();
+  if (*resolver == NULL)
+    {
+      TF_LITE_REPORT_ERROR(&g_error_reporter, "Op registration failed");
+      return -EPERM;
+    }
+
+  return 0;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -73,28 +184,18 @@ int tf_rt_allocate_context(tf_rt_context_pointer *context)
 int tf_rt_initialize_context(tf_rt_context_pointer context,
                              const void *n, int size)
 {
+  int ret;
+  tf_rt_kernel_resolver *resolver;
   tf_rt_context_t *c = (tf_rt_context_t *) context;
 
-  tflite::InitializeTarget();
-  tflite::MicroErrorReporter micro_error_reporter;
-  c->error_reporter = &micro_error_reporter;
+  c->error_reporter = &g_error_reporter;
 
-  /* Map the model into a usable data structure. This doesn't involve any
-   * copying or parsing, it's a very lightweight operation.
-   */
-
-  c->model = tflite::GetModel(n);
-  if (c->model->version() != TFLITE_SCHEMA_VERSION)
+  ret = tf_rt_load_model(n, &c->model, &resolver);
+  if (ret != 0)
     {
-      TF_LITE_REPORT_ERROR(c->error_reporter,
-                          "Model provided is schema version %d not equal "
-                          "to supported version %d.",
-                          c->model->version(), TFLITE_SCHEMA_VERSION);
-      return -EPERM;
+      return ret;
     }
 
-  tflite::AllOpsResolver resolver;
-
   c->tensor_arena_size = size;
   c->tensor_arena = (uint8_t *) tf_rt_malloc_func(c->tensor_arena_size);
   if (c->tensor_arena == 0)
@@ -104,12 +205,13 @@ int tf_rt_initialize_context(tf_rt_context_pointer context,
 
   memset(c->tensor_arena, 0, c->tensor_arena_size);
 
-  /* Build an interpreter to run the model with. */
+  /* Build an interpreter to run the model with. It is kept in the context
+   * so that tensors are allocated only once for the model.
+   */
 
-  tflite::MicroInterpreter interpreter(
-      c->model, resolver, c->tensor_arena,
+  c->interpreter = new (c->interpreter_storage) tflite::MicroInterpreter(
+      c->model, *resolver, c->tensor_arena,
       c->tensor_arena_size, c->error_reporter);
-  c->interpreter = &interpreter;
 
   /* Allocate memory from the tensor_arena for the model's tensors. */
 
@@ -123,10 +225,114 @@ int tf_rt_initialize_context(tf_rt_context_pointer context,
   return 0;
 }
 
+int tf_rt_initialize_context_shared(tf_rt_context_pointer context,
+                                    const void *n, void *scratch,
+                                    size_t scratch_size,
+                                    size_t persistent_size)
+{
+  int ret;
+  tf_rt_kernel_resolver *resolver;
+  tflite::MicroAllocator *allocator;
+  tf_rt_context_t *c = (tf_rt_context_t *) context;
+
+  c->error_reporter = &g_error_reporter;
+
+  ret = tf_rt_load_model(n, &c->model, &resolver);
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  /* Only the persistent region is owned by the context. */
+
+  c->tensor_arena_size = persistent_size;
+  c->tensor_arena = (uint8_t *) tf_rt_malloc_func(c->tensor_arena_size);
+  if (c->tensor_arena == 0)
+    {
+      return -ENOMEM;
+    }
+
+  c->allocator = new (c->allocator_storage) tf_rt_arena_allocator(
+      c->error_reporter, (uint8_t *) scratch, scratch_size,
+      c->tensor_arena, persistent_size);
+
+  allocator = tflite::MicroAllocator::Create(c->allocator,
+                                             c->error_reporter);
+  if (allocator == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  c->interpreter = new (c->interpreter_storage) tflite::MicroInterpreter(
+      c->model, *resolver, allocator, c->error_reporter);
+
+  TfLiteStatus allocate_status = c->interpreter->AllocateTensors();
+  if (allocate_status != kTfLiteOk)
+    {
+      TF_LITE_REPORT_ERROR(c->error_reporter, "AllocateTensors() failed");
+      return -ENOMEM;
+    }
+
+  return 0;
+}
+
+int tf_rt_probe_arena(const void *n, void *buf, size_t size,
+                      size_t *persistent_size, size_t *scratch_size)
+{
+  int ret;
+  const tflite::Model *model;
+  tf_rt_kernel_resolver *resolver;
+  tflite::MicroAllocator *allocator;
+
+  ret = tf_rt_load_model(n, &model, &resolver);
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  /* Run AllocateTensors() on a temporary interpreter in buf, and measure
+   * the both ends of the arena.
+   */
+
+  tf_rt_arena_allocator mem(&g_error_reporter, (uint8_t *) buf, size,
+                            NULL, 0);
+
+  allocator = tflite::MicroAllocator::Create(&mem, &g_error_reporter);
+  if (allocator == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  tflite::MicroInterpreter interpreter(model, *resolver, allocator,
+                                       &g_error_reporter);
+  if (interpreter.AllocateTensors() != kTfLiteOk)
+    {
+      TF_LITE_REPORT_ERROR(&g_error_reporter, "AllocateTensors() failed");
+      return -ENOMEM;
+    }
+
+  *persistent_size = mem.persistent_used() + TF_RT_ARENA_ALIGN_MARGIN;
+  *scratch_size = mem.scratch_used() + TF_RT_ARENA_ALIGN_MARGIN;
+
+  return 0;
+}
+
 int tf_rt_free_context(tf_rt_context_pointer *context)
 {
   tf_rt_context_t *c = (tf_rt_context_t *) *context;
 
+  if (c->interpreter)
+    {
+      c->interpreter->~MicroInterpreter();
+      c->interpreter = NULL;
+    }
+
+  if (c->allocator)
+    {
+      c->allocator->~tf_rt_arena_allocator();
+      c->allocator = NULL;
+    }
+
   if (c->tensor_arena)
     {
       tf_rt_free_func(c->tensor_arena);
@@ -141,7 +347,14 @@ int tf_rt_free_context(tf_rt_context_pointer *context)
 
 size_t tf_rt_arenasize(tf_rt_context_pointer context)
 {
-  return ((tf_rt_context_t *)context)->interpreter->arena_used_bytes();
+  tf_rt_context_t *c = (tf_rt_context_t *) context;
+
+  if (c->allocator)
+    {
+      return c->allocator->persistent_used() + c->allocator->scratch_used();
+    }
+
+  return c->interpreter->arena_used_bytes();
 }
 
 int tf_rt_num_of_input(tf_rt_context_pointer context)
@@ -251,3 +464,32 @@ void tf_rt_set_free(void (*user_free)(void *ptr))
       tf_rt_free_func = user_free;
     }
 }
+
+int tf_rt_set_kernel(int op, const TfLiteRegistration *kernel)
+{
+  tf_rt_kernel_resolver *resolver = tf_rt_get_resolver();
+
+  if (resolver == NULL)
+    {
+      return -EPERM;
+    }
+
+  if (!resolver->SetOp((tflite::BuiltinOperator) op, kernel))
+    {
+      return -ENOMEM;
+    }
+
+  return 0;
+}
+
+const TfLiteRegistration *tf_rt_base_kernel(int op)
+{
+  tf_rt_kernel_resolver *resolver = tf_rt_get_resolver();
+
+  if (resolver == NULL)
+    {
+      return NULL;
+    }
+
+  return resolver->FindBaseOp((tflite::BuiltinOperator) op);
+}
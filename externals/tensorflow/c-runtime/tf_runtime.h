@@ -46,6 +46,16 @@ extern "C" {
 
 #include "tensorflow/lite/c/common.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Builtin operator codes of kernels replaced by tf_rt_set_kernel() */
+
+#define TF_RT_OP_CONV_2D            (3)
+#define TF_RT_OP_DEPTHWISE_CONV_2D  (4)
+#define TF_RT_OP_FULLY_CONNECTED    (9)
+
 /****************************************************************************
  * Type Declarations
  ****************************************************************************/
@@ -59,6 +69,12 @@ typedef void *tf_rt_context_pointer;
 int tf_rt_allocate_context(tf_rt_context_pointer *context);
 int tf_rt_initialize_context(tf_rt_context_pointer context,
                              const void *n, int size);
+int tf_rt_initialize_context_shared(tf_rt_context_pointer context,
+                                    const void *n, void *scratch,
+                                    size_t scratch_size,
+                                    size_t persistent_size);
+int tf_rt_probe_arena(const void *n, void *buf, size_t size,
+                      size_t *persistent_size, size_t *scratch_size);
 int tf_rt_free_context(tf_rt_context_pointer *context);
 int tf_rt_num_of_input(tf_rt_context_pointer context);
 int tf_rt_input_size(tf_rt_context_pointer context, size_t index);
@@ -81,6 +97,14 @@ void tf_rt_set_malloc(void *(*user_malloc)(size_t size));
 void tf_rt_set_free(void (*user_free)(void *ptr));
 size_t tf_rt_arenasize(tf_rt_context_pointer context);
 
+/* Replace the kernel of a builtin operator by the given registration, or
+ * restore the original one if kernel is NULL. It takes effect on contexts
+ * initialized after the call. tf_rt_base_kernel() returns the original.
+ */
+
+int tf_rt_set_kernel(int op, const TfLiteRegistration *kernel);
+const TfLiteRegistration *tf_rt_base_kernel(int op);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+############################################################################
+# externals/tensorflow/c-runtime/tflite_ops.py
+#
+#   Copyright 2026 Sony Semiconductor Solutions Corporation
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+# 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+#    the names of its contributors may be used to endorse or promote
+#    products derived from this software without specific prior written
+#    permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+# OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+# AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+############################################################################
+
+import argparse
+import os
+import struct
+import sys
+
+TOOL_DESCRIPTION = '''
+Generate the op list of tflmrt C runtime from .tflite models
+
+The output lists TF_RT_OP(<op>) for each builtin operator used by the
+given models. It is used as CONFIG_EXTERNALS_TENSORFLOW_RT_OPS_FILE so that
+only these kernels are registered and linked.
+'''
+
+# BuiltinOperator enum in tensorflow/lite/schema/schema.fbs
+
+BUILTIN_OPS = [
+    'ADD', 'AVERAGE_POOL_2D', 'CONCATENATION', 'CONV_2D',
+    'DEPTHWISE_CONV_2D', 'DEPTH_TO_SPACE', 'DEQUANTIZE', 'EMBEDDING_LOOKUP',
+    'FLOOR', 'FULLY_CONNECTED', 'HASHTABLE_LOOKUP', 'L2_NORMALIZATION',
+    'L2_POOL_2D', 'LOCAL_RESPONSE_NORMALIZATION', 'LOGISTIC',
+    'LSH_PROJECTION', 'LSTM', 'MAX_POOL_2D', 'MUL', 'RELU', 'RELU_N1_TO_1',
+    'RELU6', 'RESHAPE', 'RESIZE_BILINEAR', 'RNN', 'SOFTMAX',
+    'SPACE_TO_DEPTH', 'SVDF', 'TANH', 'CONCAT_EMBEDDINGS', 'SKIP_GRAM',
+    'CALL', 'CUSTOM', 'EMBEDDING_LOOKUP_SPARSE', 'PAD',
+    'UNIDIRECTIONAL_SEQUENCE_RNN', 'GATHER', 'BATCH_TO_SPACE_ND',
+    'SPACE_TO_BATCH_ND', 'TRANSPOSE', 'MEAN', 'SUB', 'DIV', 'SQUEEZE',
+    'UNIDIRECTIONAL_SEQUENCE_LSTM', 'STRIDED_SLICE',
+    'BIDIRECTIONAL_SEQUENCE_RNN', 'EXP', 'TOPK_V2', 'SPLIT', 'LOG_SOFTMAX',
+    'DELEGATE', 'BIDIRECTIONAL_SEQUENCE_LSTM', 'CAST', 'PRELU', 'MAXIMUM',
+    'ARG_MAX', 'MINIMUM', 'LESS', 'NEG', 'PADV2', 'GREATER',
+    'GREATER_EQUAL', 'LESS_EQUAL', 'SELECT', 'SLICE', 'SIN',
+    'TRANSPOSE_CONV', 'SPARSE_TO_DENSE', 'TILE', 'EXPAND_DIMS', 'EQUAL',
+    'NOT_EQUAL', 'LOG', 'SUM', 'SQRT', 'RSQRT', 'SHAPE', 'POW', 'ARG_MIN',
+    'FAKE_QUANT', 'REDUCE_PROD', 'REDUCE_MAX', 'PACK', 'LOGICAL_OR',
+    'ONE_HOT', 'LOGICAL_AND', 'LOGICAL_NOT', 'UNPACK', 'REDUCE_MIN',
+    'FLOOR_DIV', 'REDUCE_ANY', 'SQUARE', 'ZEROS_LIKE', 'FILL', 'FLOOR_MOD',
+    'RANGE', 'RESIZE_NEAREST_NEIGHBOR', 'LEAKY_RELU', 'SQUARED_DIFFERENCE',
+    'MIRROR_PAD', 'ABS', 'SPLIT_V', 'UNIQUE', 'CEIL', 'REVERSE_V2', 'ADD_N',
+    'GATHER_ND', 'COS', 'WHERE', 'RANK', 'ELU', 'REVERSE_SEQUENCE',
+    'MATRIX_DIAG', 'QUANTIZE', 'MATRIX_SET_DIAG', 'ROUND', 'HARD_SWISH',
+    'IF', 'WHILE', 'NON_MAX_SUPPRESSION_V4', 'NON_MAX_SUPPRESSION_V5',
+    'SCATTER_ND', 'SELECT_V2', 'DENSIFY', 'SEGMENT_SUM', 'BATCH_MATMUL',
+    'PLACEHOLDER_FOR_GREATER_OP_CODES', 'CUMSUM', 'CALL_ONCE',
+    'BROADCAST_TO', 'RFFT2D', 'CONV_3D', 'IMAG', 'REAL', 'COMPLEX_ABS',
+    'HASHTABLE', 'HASHTABLE_FIND', 'HASHTABLE_IMPORT', 'HASHTABLE_SIZE',
+    'REDUCE_ALL', 'CONV_3D_TRANSPOSE', 'VAR_HANDLE', 'READ_VARIABLE',
+    'ASSIGN_VARIABLE', 'BROADCAST_ARGS',
+]
+
+# MicroMutableOpResolver::Add*() names which are not plain CamelCase
+
+RESOLVER_NAMES = {
+    'PADV2': 'PadV2',
+    'UNIDIRECTIONAL_SEQUENCE_LSTM': 'UnidirectionalSequenceLSTM',
+}
+
+CUSTOM_OP = 32
+
+
+def resolver_name(op):
+    if op in RESOLVER_NAMES:
+        return RESOLVER_NAMES[op]
+    # CONV_2D is AddConv2D, so words starting with a digit keep the case
+
+    return ''.join(w if w[0].isdigit() else w.capitalize()
+                   for w in op.split('_'))
+
+
+class FlatBuffer:
+    '''Minimum reader of flatbuffer tables'''
+
+    def __init__(self, buf):
+        self.buf = buf
+
+    def u32(self, pos):
+        return struct.unpack_from('<I', self.buf, pos)[0]
+
+    def field(self, table, index):
+        '''Return absolute position of a field, or None if absent'''
+        vtable = table - struct.unpack_from('<i', self.buf, table)[0]
+        vtsize = struct.unpack_from('<H', self.buf, vtable)[0]
+        if 4 + index * 2 >= vtsize:
+            return None
+        off = struct.unpack_from('<H', self.buf, vtable + 4 + index * 2)[0]
+        return table + off if off else None
+
+    def scalar(self, table, index, fmt, default):
+        pos = self.field(table, index)
+        if pos is None:
+            return default
+        return struct.unpack_from(fmt, self.buf, pos)[0]
+
+    def vector(self, table, index):
+        '''Return positions of the tables in a vector of tables'''
+        pos = self.field(table, index)
+        if pos is None:
+            return []
+        vec = pos + self.u32(pos)
+        n = self.u32(vec)
+        return [vec + 4 + i * 4 + self.u32(vec + 4 + i * 4)
+                for i in range(n)]
+
+
+def model_ops(path):
+    with open(path, 'rb') as f:
+        fb = FlatBuffer(f.read())
+
+    if fb.buf[4:8] != b'TFL3':
+        raise ValueError('%s is not a tflite model' % path)
+
+    # Model.operator_codes is the field 1. In OperatorCode, the field 0 is
+    # deprecated_builtin_code (int8) and the field 3 is builtin_code (int32).
+    # Newer converters fill builtin_code for codes over 127.
+
+    model = fb.u32(0)
+    codes = set()
+    for opcode in fb.vector(model, 1):
+        old = fb.scalar(opcode, 0, '<b', 0)
+        new = fb.scalar(opcode, 3, '<i', 0)
+        codes.add(max(old, new))
+    return codes
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        description=TOOL_DESCRIPTION)
+    parser.add_argument('models', nargs='+', metavar='MODEL',
+                        help='.tflite model files')
+    parser.add_argument('-o', '--output', metavar='FILE',
+                        help='output file (default stdout)')
+    parser.add_argument('--allow-custom', action='store_true',
+                        help='skip custom ops instead of failing. '
+                             'Register them by yourself.')
+    opts = parser.parse_args()
+
+    codes = set()
+    for m in opts.models:
+        codes |= model_ops(m)
+
+    lines = []
+    for code in sorted(codes):
+        if code == CUSTOM_OP:
+            if not opts.allow_custom:
+                sys.stderr.write('error: custom ops can not be registered '
+                                 'by the op list (see --allow-custom)\n')
+                sys.exit(1)
+            sys.stderr.write('warning: custom ops are not registered\n')
+            continue
+        if code >= len(BUILTIN_OPS):
+            sys.stderr.write('error: unknown builtin op %d\n' % code)
+            sys.exit(1)
+        lines.append('TF_RT_OP(%s)\n' % resolver_name(BUILTIN_OPS[code]))
+
+    text = '/* Generated by tflite_ops.py from %s */\n\n' % \
+           ' '.join(os.path.basename(m) for m in opts.models)
+    text += ''.join(lines)
+
+    if opts.output is None:
+        sys.stdout.write(text)
+        return
+
+    with open(opts.output, 'w') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
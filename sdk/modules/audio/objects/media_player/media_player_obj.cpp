@@ -960,6 +960,8 @@ void PlayerObj::decDoneOnPlay(MsgPacket *msg)
   data.is_valid  = ((data.size == 0) ?
                     false : cmplt.exec_dec_cmplt.is_valid_frame);
 
+  commitPcmBuf(data.size);
+
   sendPcmToOwner(data);
 
   freePcmBuf();
@@ -1027,6 +1029,8 @@ void PlayerObj::decDoneOnWaitStop(MsgPacket *msg)
       data.is_end = true;
     }
 
+  commitPcmBuf(data.size);
+
   sendPcmToOwner(data);
 
   freePcmBuf();
@@ -1048,6 +1052,8 @@ void PlayerObj::decDoneOnPrePlay(MsgPacket *msg)
   data.is_valid  = ((data.size == 0) ?
                    false : cmplt.exec_dec_cmplt.is_valid_frame);
 
+  commitPcmBuf(data.size);
+
   if (!m_decoded_pcm_mh_que.push(data))
     {
       MEDIA_PLAYER_ERR(AS_ATTENTION_SUB_CODE_QUEUE_PUSH_ERROR);
@@ -1508,6 +1514,24 @@ void* PlayerObj::allocPcmBuf(uint32_t size)
   return mh.getPa();
 }
 
+/*--------------------------------------------------------------------------*/
+void PlayerObj::commitPcmBuf(uint32_t size)
+{
+#ifdef USE_MEMMGR_RINGBUF_POOL
+  /* The PCM segment was reserved with the maximum decoded size.
+   * Fix it to the decoded size so that a RingBufType pool can reuse
+   * the rest for the next frame.
+   */
+
+  if (m_pcm_buf_mh_que.writable_at(0).commitSeg(size) != ERR_OK)
+    {
+      MEDIA_PLAYER_WARN(AS_ATTENTION_SUB_CODE_MEMHANDLE_ALLOC_ERROR);
+    }
+#else
+  (void)size;
+#endif
+}
+
 /*--------------------------------------------------------------------------*/
 void* PlayerObj::getEs(uint32_t* size)
 {
@@ -1521,6 +1545,15 @@ void* PlayerObj::getEs(uint32_t* size)
 
   if (m_input_device_handler->getEs(mh.getVa(), size))
     {
+#ifdef USE_MEMMGR_RINGBUF_POOL
+      /* Fix the ES segment to the size actually read */
+
+      if (mh.commitSeg(*size) != ERR_OK)
+        {
+          MEDIA_PLAYER_WARN(AS_ATTENTION_SUB_CODE_MEMHANDLE_ALLOC_ERROR);
+        }
+#endif
+
       if (!m_es_buf_mh_que.push(mh))
         {
           MEDIA_PLAYER_ERR(AS_ATTENTION_SUB_CODE_QUEUE_PUSH_ERROR);
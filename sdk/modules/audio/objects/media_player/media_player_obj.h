@@ -213,6 +213,7 @@ private:
   void decode(void* p_es, uint32_t es_size);
 
   void *allocPcmBuf(uint32_t size);
+  void  commitPcmBuf(uint32_t size);
   bool  freePcmBuf() {
   if (!m_pcm_buf_mh_que.pop())
     {
@@ -1731,6 +1731,18 @@ bool MediaRecorderObject::writeToDataSinker(
   sink_data.mh        = mh;
   sink_data.byte_size = byte_size;
 
+#ifdef USE_MEMMGR_RINGBUF_POOL
+  /* The segment was reserved with the maximum output size.
+   * Fix it to the encoded size so that a RingBufType pool can reuse
+   * the rest for the next frame.
+   */
+
+  if (sink_data.mh.commitSeg(byte_size) != ERR_OK)
+    {
+      MEDIA_RECORDER_WARN(AS_ATTENTION_SUB_CODE_MEMHANDLE_ALLOC_ERROR);
+    }
+#endif
+
   return m_rec_sink.write(sink_data);
 }
 
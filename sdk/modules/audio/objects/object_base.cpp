@@ -41,6 +41,14 @@
 #include <string.h>
 #include "object_base.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Maximum number of messages received in one wakeup. */
+
+#define MSG_RECV_BATCH_NUM  4
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -49,20 +57,26 @@ void ObjectBase::run()
 {
   err_t        err_code;
   MsgQueBlock* que;
-  MsgPacket*   msg = NULL;
+  MsgPacket*   msg[MSG_RECV_BATCH_NUM];
+  uint16_t     num = 0;
 
   err_code = MsgLib::referMsgQueBlock(m_msgq_id.self, &que);
   F_ASSERT(err_code == ERR_OK);
 
   while (1)
     {
-      err_code = que->recv(TIME_FOREVER, &msg);
+      /* Drain queued messages in one wakeup. */
+
+      err_code = que->recv(TIME_FOREVER, msg, MSG_RECV_BATCH_NUM, &num);
       F_ASSERT(err_code == ERR_OK);
 
-      parse(msg);
+      for (uint16_t i = 0; i < num; i++)
+        {
+          parse(msg[i]);
 
-      err_code = que->pop();
-      F_ASSERT(err_code == ERR_OK);
+          err_code = que->pop();
+          F_ASSERT(err_code == ERR_OK);
+        }
     }
 
 }
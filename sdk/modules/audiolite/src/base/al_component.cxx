@@ -75,10 +75,17 @@ audiolite_component::audiolite_component(int inputnum, int outputnum,
     _ins(NULL), _outs(NULL), _op(NULL), _pool(NULL),
     _innum(inputnum), _outnum(outputnum),
     _state(0)
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    , _profname("al_comp"), _profnext(NULL)
+#endif
 #ifdef _ALDEBUG_ENABLE
     , dbg_name(NULL)
 #endif
 {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  memset(&_prof_ondata, 0, sizeof(_prof_ondata));
+#endif
+
   if (inputnum > 0)
     {
 #ifdef __linux__
@@ -188,10 +195,20 @@ audiolite_component::audiolite_component(int inputnum, int outputnum,
           return;
         }
     }
+
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  /* Register after the nodes are ready, as the dump reads them */
+
+  audiolite_profile_register(this);
+#endif
 }
 
 audiolite_component::~audiolite_component()
 {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  audiolite_profile_unregister(this);
+#endif
+
   /* Stop own operation */
 
   for (int i = 0; i < _innum; i++)
@@ -231,6 +248,10 @@ audiolite_component::~audiolite_component()
 
 void audiolite_component::set_operatorname(const char *name)
 {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  set_profname(name);
+#endif
+
   if (_op && _op->async)
     {
       pthread_setname_np(_op->async->tid, name);
@@ -407,7 +428,14 @@ bool audiolite_component::can_breakdata(audiolite_outputnode *out)
 
 void audiolite_component::data_came(mossfw_callback_op_t *op)
 {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  uint32_t start = audiolite_profile_us();
+
+  on_data();
+  al_profile_time_add(&_prof_ondata, audiolite_profile_us() - start);
+#else
   on_data();
+#endif
 }
 
 void audiolite_component::on_data()
@@ -669,3 +697,47 @@ int audiolite_component::operate_cb(mossfw_callback_op_t *op, unsigned long arg)
 
   return 0;
 }
+
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+void audiolite_component::set_profname(const char *name)
+{
+  _profname = name;
+}
+
+int audiolite_component::get_profile(struct al_profile_s *prof)
+{
+  if (prof == NULL)
+    {
+      return -EINVAL;
+    }
+
+  memset(prof, 0, sizeof(struct al_profile_s));
+  prof->name = _profname;
+  prof->on_data = _prof_ondata;
+  if (_ins != NULL)
+    {
+      prof->innum = _innum < AL_PROFILE_MAXINPUTS ? _innum
+                                                  : AL_PROFILE_MAXINPUTS;
+    }
+
+  for (int i = 0; i < prof->innum; i++)
+    {
+      _ins[i]->get_depth(&prof->in_depth[i], &prof->in_maxdepth[i]);
+    }
+
+  get_subprofile(prof);
+
+  return OK;
+}
+
+void audiolite_component::reset_profile()
+{
+  memset(&_prof_ondata, 0, sizeof(_prof_ondata));
+  for (int i = 0; _ins != NULL && i < _innum; i++)
+    {
+      _ins[i]->reset_maxdepth();
+    }
+
+  reset_subprofile();
+}
+#endif
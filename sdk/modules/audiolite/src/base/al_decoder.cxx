@@ -49,13 +49,66 @@ audiolite_decoder::audiolite_decoder(const char *name,
                  : audiolite_component(0, 1), _stream(NULL),
                    _omempool(NULL), _prio(prio), _stacksz(stack_sz),
                    _tid(-1), _tname(name), _isplay(false), _ispause(false),
-                   _is_thrdrun(false)
+                   _is_thrdrun(false), _runner_evt(false)
 {
+  mossfw_lock_init(&_evtlock);
+  mossfw_condition_init(&_evtcond);
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  set_profname(name);
+#endif
 }
 
 audiolite_decoder::~audiolite_decoder()
 {
   stop_thread();
+
+  if (_omempool)
+    {
+      _omempool->set_eventcallback(NULL, NULL);
+    }
+
+  mossfw_lock_fin(&_evtlock);
+}
+
+void audiolite_decoder::wait_runner()
+{
+  mossfw_lock_take(&_evtlock);
+  while (_is_thrdrun && !_runner_evt)
+    {
+      mossfw_condition_wait(&_evtcond, &_evtlock);
+    }
+
+  _runner_evt = false;
+  mossfw_lock_give(&_evtlock);
+}
+
+void audiolite_decoder::notify_runner()
+{
+  mossfw_lock_take(&_evtlock);
+  _runner_evt = true;
+  mossfw_condition_notice(&_evtcond);
+  mossfw_lock_give(&_evtlock);
+}
+
+void audiolite_decoder::pool_event(void *arg)
+{
+  ((audiolite_decoder *)arg)->notify_runner();
+}
+
+void audiolite_decoder::set_outputmempool(audiolite_mempoolapbuf *pool)
+{
+  if (_omempool)
+    {
+      _omempool->set_eventcallback(NULL, NULL);
+    }
+
+  _omempool = pool;
+  if (_omempool)
+    {
+      _omempool->set_eventcallback(audiolite_decoder::pool_event, this);
+    }
+
+  notify_runner();
 }
 
 int audiolite_decoder::start_thread(const char *name)
@@ -95,6 +148,7 @@ void audiolite_decoder::stop_thread()
   if (_tid >= 0)
     {
       _is_thrdrun = false;
+      notify_runner();
       if (_pool != NULL)
         {
           _pool->disable_pool();
@@ -117,6 +171,7 @@ int audiolite_decoder::start()
   al_ddebug("Entry\n");
   if (!_isplay && _pool)
     {
+      output_profile()->latency_start();
       ret = audiolite_start(_outs[0]);
       al_ddebug("result alstart: %d\n", ret);
       if (ret == OK)
@@ -135,6 +190,7 @@ int audiolite_decoder::start()
               else
                 {
                   _isplay = true;
+                  notify_runner();
                 }
             }
           else
@@ -184,6 +240,7 @@ int audiolite_decoder::resume()
       if (ret == 0)
         {
           _ispause = false;
+          notify_runner();
         }
     }
 
@@ -195,6 +195,7 @@ const char *audiolite_strevent(int evt)
       STRINGCASE(MP3DECERROR)
       STRINGCASE(MP3DEC_WRONGTYPE)
       STRINGCASE(WRONGVERSION)
+      STRINGCASE(FRAMEINFO)
       default:
         return "not event id...";
     }
@@ -65,6 +65,9 @@ audiolite_inputnode::audiolite_inputnode(audiolite_component *cmp,
                                          int depth) :
       _component(cmp), _comm(cmp, this),
       _connected(NULL), _input(NULL), _op(NULL), _nextnode(NULL)
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+      , _prof_depth(0), _prof_maxdepth(0)
+#endif
 {
   _input = mossfw_input_create(DATATYPE, depth);
 }
@@ -134,6 +137,9 @@ void audiolite_inputnode::release_allstoredbuff()
   while ((mem = (audiolite_mem *)mossfw_release_delivereddata_array(_input))
           != NULL)
     {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+      add_depth(-1);
+#endif
       mem->release();
     }
 }
@@ -159,7 +165,18 @@ bool audiolite_inputnode::can_breakdata()
 
 audiolite_mem *audiolite_inputnode::pop_data(int *used)
 {
-  return (audiolite_mem *)mossfw_get_delivereddata_array(_input, 0, used);
+  audiolite_mem *mem;
+
+  mem = (audiolite_mem *)mossfw_get_delivereddata_array(_input, 0, used);
+
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  if (mem)
+    {
+      add_depth(-1);
+    }
+#endif
+
+  return mem;
 }
 
 /****************************************************************************
@@ -68,6 +68,7 @@ void audiolite_timeprofile::reflesh(int rem)
 {
   min_remain = rem;
   max_zero_timeus = 0;
+  min_prefetch_fill = -1;
   measure_interval();
 }
 
@@ -103,6 +104,36 @@ void audiolite_timeprofile::measure_stop()
     }
 }
 
+void audiolite_timeprofile::latency_start()
+{
+  gettimeofday(&latency_keeper, NULL);
+  first_sample_us = 0;
+  wait_first_sample = true;
+}
+
+void audiolite_timeprofile::latency_stop()
+{
+  struct timeval current;
+  struct timeval duration;
+
+  if (wait_first_sample)
+    {
+      wait_first_sample = false;
+      gettimeofday(&current, NULL);
+      timersub(&current, &latency_keeper, &duration);
+      first_sample_us = duration.tv_sec * 1000000 + duration.tv_usec;
+    }
+}
+
+void audiolite_timeprofile::update_prefetch(int fill)
+{
+  prefetch_fill = fill;
+  if (min_prefetch_fill < 0 || min_prefetch_fill > fill)
+    {
+      min_prefetch_fill = fill;
+    }
+}
+
 /****************************************************************************
  * Class: audiolite_mem
  ****************************************************************************/
@@ -461,6 +492,12 @@ void audiolite_mempoolapbuf::memfree(audiolite_mem *mem)
 {
   audiolite_memapbuf *tmp = (audiolite_memapbuf *)(mem);
   _add_freemem(tmp);
+
+  /* Notify out of the pool lock to avoid lock order inversion
+   * with the listener.
+   */
+
+  notify_event();
 }
 
 void audiolite_mempoolapbuf::disable_pool()
@@ -477,6 +514,8 @@ void audiolite_mempoolapbuf::enable_pool()
   _pool_enable = true;
   mossfw_condition_notice(&_cond);
   mossfw_lock_give(&_lock);
+
+  notify_event();
 }
 
 int audiolite_mempoolapbuf::remaining()
@@ -182,9 +182,41 @@ bool audiolite_outputnode::can_breakdata()
     }
 }
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+void audiolite_outputnode::add_depth(int n)
+{
+  audiolite_inputnode *tmp;
+
+  mossfw_lock_take(&_lock);
+  for (tmp = _binded; tmp; tmp = tmp->_nextnode)
+    {
+      tmp->add_depth(n);
+    }
+
+  mossfw_lock_give(&_lock);
+}
+#endif
+
 int audiolite_outputnode::push_data(audiolite_mem *mem)
 {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  int ret;
+
+  /* Count before delivery, because a synchronous operator may pop it
+   * before delivery returns.
+   */
+
+  add_depth(1);
+  ret = mossfw_deliver_dataarray(_output, (mossfw_data_t *)mem);
+  if (ret < 0)
+    {
+      add_depth(-1);
+    }
+
+  return ret;
+#else
   return mossfw_deliver_dataarray(_output, (mossfw_data_t *)mem);
+#endif
 }
 
 int audiolite_outputnode::fanout()
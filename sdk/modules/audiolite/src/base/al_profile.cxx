@@ -0,0 +1,164 @@
+/****************************************************************************
+ * modules/audiolite/src/base/al_profile.cxx
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <audiolite/al_component.h>
+#include <audiolite/al_profile.h>
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static audiolite_component *g_profhead = NULL;
+static pthread_mutex_t g_proflock = PTHREAD_MUTEX_INITIALIZER;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t average(struct al_profile_time_s *t)
+{
+  return t->count ? (uint32_t)(t->total_us / t->count) : 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+uint32_t audiolite_profile_us(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void audiolite_profile_register(audiolite_component *comp)
+{
+  pthread_mutex_lock(&g_proflock);
+  comp->_profnext = g_profhead;
+  g_profhead = comp;
+  pthread_mutex_unlock(&g_proflock);
+}
+
+void audiolite_profile_unregister(audiolite_component *comp)
+{
+  audiolite_component **pp;
+
+  pthread_mutex_lock(&g_proflock);
+  for (pp = &g_profhead; *pp; pp = &(*pp)->_profnext)
+    {
+      if (*pp == comp)
+        {
+          *pp = comp->_profnext;
+          break;
+        }
+    }
+
+  pthread_mutex_unlock(&g_proflock);
+}
+
+void audiolite_profile_dump(void)
+{
+  struct al_profile_s prof;
+  audiolite_component *comp;
+
+  printf("%-12s %8s %7s %7s %-16s %15s %15s\n",
+         "component", "on_data", "avg_us", "max_us", "inq now/max",
+         "wk_in avg/max", "wk_out avg/max");
+
+  pthread_mutex_lock(&g_proflock);
+
+  for (comp = g_profhead; comp; comp = comp->_profnext)
+    {
+      if (comp->get_profile(&prof) != OK)
+        {
+          continue;
+        }
+
+      printf("%-12.12s %8lu %7lu %7lu ", prof.name,
+             (unsigned long)prof.on_data.count,
+             (unsigned long)average(&prof.on_data),
+             (unsigned long)prof.on_data.max_us);
+
+      for (int i = 0; i < AL_PROFILE_MAXINPUTS; i++)
+        {
+          if (i < prof.innum)
+            {
+              printf("%d/%d ", prof.in_depth[i], prof.in_maxdepth[i]);
+            }
+          else if (i == 0)
+            {
+              printf("-   ");
+            }
+        }
+
+      if (prof.wk_in.count || prof.wk_out.count)
+        {
+          printf(" %7lu/%-7lu %7lu/%-7lu",
+                 (unsigned long)average(&prof.wk_in),
+                 (unsigned long)prof.wk_in.max_us,
+                 (unsigned long)average(&prof.wk_out),
+                 (unsigned long)prof.wk_out.max_us);
+        }
+
+      printf("\n");
+    }
+
+  pthread_mutex_unlock(&g_proflock);
+}
+
+void audiolite_profile_reset(void)
+{
+  audiolite_component *comp;
+
+  pthread_mutex_lock(&g_proflock);
+
+  for (comp = g_profhead; comp; comp = comp->_profnext)
+    {
+      comp->reset_profile();
+    }
+
+  pthread_mutex_unlock(&g_proflock);
+}
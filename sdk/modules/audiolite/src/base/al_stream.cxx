@@ -38,23 +38,62 @@
  ****************************************************************************/
 
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
 #include <audiolite/al_debug.h>
 #include <audiolite/al_stream.h>
 
 /****************************************************************************
- * Class: audiolite_filestream
+ * Pre-processor Definitions
  ****************************************************************************/
 
-audiolite_filestream::~audiolite_filestream()
+#define SKIP_BUFSZ  (64)
+
+/* File offset alignment of read-ahead and its buffer alignment */
+
+#define AL_FSTREAM_RAALIGN   (512)
+#define AL_FSTREAM_BUFALIGN  (32)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void calc_limit(clockid_t clk, int toms, struct timespec *limit)
 {
-  mossfw_lock_take(&_lock);
-  if (_fp != NULL && _self_open)
+  clock_gettime(clk, limit);
+  limit->tv_sec += toms / 1000;
+  limit->tv_nsec += (toms % 1000) * 1000000;
+  if (limit->tv_nsec >= 1000000000)
     {
-      fclose(_fp);
+      limit->tv_sec++;
+      limit->tv_nsec -= 1000000000;
     }
-  mossfw_lock_give(&_lock);
 }
 
+static int left_ms(clockid_t clk, struct timespec *limit)
+{
+  struct timespec now;
+  int ms;
+
+  clock_gettime(clk, &now);
+  ms = (limit->tv_sec - now.tv_sec) * 1000 +
+       (limit->tv_nsec - now.tv_nsec) / 1000000;
+
+  return ms < 0 ? 0 : ms;
+}
+
+/****************************************************************************
+ * Class: audiolite_filestream
+ ****************************************************************************/
+
+/***********************************************
+ * Private Class audiolite_filestream Methods
+ ***********************************************/
+
 int audiolite_filestream::open_file(const char *fname, const char *flg)
 {
   mossfw_lock_take(&_lock);
@@ -62,12 +101,236 @@ int audiolite_filestream::open_file(const char *fname, const char *flg)
   if (_fp)
     {
       _self_open = true;
+      _rdmode = (flg[0] == 'r');
+      if (_rabuf && _rdmode)
+        {
+          ra_reset(0);
+        }
     }
+
   mossfw_lock_give(&_lock);
 
   return errno;
 }
 
+/* Drop prefetched data and restart reading from pos.
+ * Should be called with _lock.
+ */
+
+int audiolite_filestream::ra_reset(long pos)
+{
+  long base = pos - (pos % AL_FSTREAM_RAALIGN);
+  int ret = OK;
+
+  /* Reading is started from an aligned offset for storage efficiency */
+
+  if (_fp && fseek(_fp, base, SEEK_SET) != 0)
+    {
+      ret = -errno;
+      base = pos = ftell(_fp);
+    }
+
+  mossfw_lock_take(&_ralock);
+  _rahead = 0;
+  _rafilled = 0;
+  _rahofst = pos - base;
+  _rapos = pos;
+  _raeof = false;
+  _ragen++;
+  if (_raprof)
+    {
+      _raprof->update_prefetch(0);
+    }
+
+  mossfw_condition_notice(&_racond);
+  mossfw_lock_give(&_ralock);
+
+  return ret;
+}
+
+/* Should be called with _ralock */
+
+int audiolite_filestream::ra_level()
+{
+  int level = -_rahofst;
+
+  for (int i = 0; i < _rafilled; i++)
+    {
+      level += _ralen[(_rahead + i) % _radepth];
+    }
+
+  return level < 0 ? 0 : level;
+}
+
+bool audiolite_filestream::ra_ended()
+{
+  bool ret;
+
+  mossfw_lock_take(&_ralock);
+  ret = _raeof && _rafilled == 0;
+  mossfw_lock_give(&_ralock);
+
+  return ret;
+}
+
+/* Copy prefetched data. NULL data just skips it. */
+
+int audiolite_filestream::ra_read(char *data, int sz)
+{
+  int done = 0;
+  int len;
+  int n;
+
+  mossfw_lock_take(&_ralock);
+
+  while (done < sz)
+    {
+      if (_rafilled == 0)
+        {
+          if (_raeof || _fp == NULL || !_rarun)
+            {
+              break;
+            }
+
+          mossfw_condition_wait(&_racond, &_ralock);
+          continue;
+        }
+
+      len = _ralen[_rahead];
+      if (_rahofst < len)
+        {
+          n = len - _rahofst;
+          n = (sz - done) < n ? (sz - done) : n;
+          if (data)
+            {
+              memcpy(&data[done], &_rabuf[_rahead * _rablksz + _rahofst],
+                     n);
+            }
+
+          _rahofst += n;
+          done += n;
+        }
+
+      if (_rahofst >= len)
+        {
+          _rahead = (_rahead + 1) % _radepth;
+          _rafilled--;
+          _rahofst = 0;
+          mossfw_condition_notice(&_racond);
+        }
+    }
+
+  _rapos += done;
+  if (_raprof)
+    {
+      _raprof->update_prefetch(ra_level());
+    }
+
+  mossfw_lock_give(&_ralock);
+
+  return done;
+}
+
+/***********************************************
+ * Public Class audiolite_filestream Methods
+ ***********************************************/
+
+audiolite_filestream::audiolite_filestream() :
+  _fp(NULL), _self_open(false), _rdmode(true),
+  _rathd(this, this, CONFIG_ALFSTREAM_RAPRIO, CONFIG_ALFSTREAM_RASTACK,
+         "al_fsread"),
+  _raprof(NULL), _rabuf(NULL), _ralen(NULL), _radepth(0), _rablksz(0),
+  _rahead(0), _rafilled(0), _rahofst(0), _rapos(0), _ragen(0),
+  _rarun(false), _raeof(false)
+{
+  mossfw_lock_init(&_lock);
+  mossfw_lock_init(&_ralock);
+  mossfw_condition_init(&_racond);
+}
+
+audiolite_filestream::~audiolite_filestream()
+{
+  set_readahead(0);
+
+  mossfw_lock_take(&_lock);
+  if (_fp != NULL && _self_open)
+    {
+      fclose(_fp);
+    }
+  mossfw_lock_give(&_lock);
+
+  mossfw_condition_fin(&_racond);
+  mossfw_lock_fin(&_ralock);
+  mossfw_lock_fin(&_lock);
+}
+
+int audiolite_filestream::set_readahead(int depth, int blksz,
+                                        audiolite_timeprofile *prof)
+{
+  long pos;
+  void *buf;
+
+  if (depth < 0 || (depth > 0 && (blksz <= 0 || !_rdmode)))
+    {
+      return -EINVAL;
+    }
+
+  /* Stop current read-ahead and take back the file position */
+
+  if (_rabuf)
+    {
+      _rathd.stop();
+
+      mossfw_lock_take(&_lock);
+      if (_fp && _rdmode)
+        {
+          fseek(_fp, _rapos, SEEK_SET);
+        }
+
+      free(_rabuf);
+      free(_ralen);
+      _rabuf = NULL;
+      _ralen = NULL;
+      _radepth = 0;
+      mossfw_lock_give(&_lock);
+    }
+
+  if (depth == 0)
+    {
+      return OK;
+    }
+
+  if (posix_memalign(&buf, AL_FSTREAM_BUFALIGN, depth * blksz) != 0)
+    {
+      return -ENOMEM;
+    }
+
+  _ralen = (int *)malloc(sizeof(int) * depth);
+  if (_ralen == NULL)
+    {
+      free(buf);
+      return -ENOMEM;
+    }
+
+  mossfw_lock_take(&_lock);
+  _rabuf = (char *)buf;
+  _radepth = depth;
+  _rablksz = blksz;
+  _raprof = prof;
+  pos = (_fp && _rdmode) ? ftell(_fp) : 0;
+  ra_reset(pos < 0 ? 0 : pos);
+  mossfw_lock_give(&_lock);
+
+  _rarun = true;
+  if (!_rathd.start())
+    {
+      set_readahead(0);
+      return -EAGAIN;
+    }
+
+  return OK;
+}
+
 int audiolite_filestream::rfile(const char *fname)
 {
   return open_file(fname, "rb");
@@ -80,13 +343,24 @@ int audiolite_filestream::wfile(const char *fname)
 
 int audiolite_filestream::set_file(FILE *fp)
 {
+  int ret = -EALREADY;
+
+  mossfw_lock_take(&_lock);
   if (_fp == NULL)
     {
       _fp = fp;
-      return OK;
+      _rdmode = true;
+      if (_rabuf)
+        {
+          ra_reset(ftell(fp) < 0 ? 0 : ftell(fp));
+        }
+
+      ret = OK;
     }
 
-  return -EALREADY;
+  mossfw_lock_give(&_lock);
+
+  return ret;
 }
 
 void audiolite_filestream::close()
@@ -99,6 +373,11 @@ void audiolite_filestream::close()
 
   _fp = NULL;
   _self_open = false;
+  if (_rabuf)
+    {
+      ra_reset(0);
+    }
+
   mossfw_lock_give(&_lock);
 }
 
@@ -106,7 +385,7 @@ int audiolite_filestream::filesize()
 {
   if (_fp)
     {
-      return ftell(_fp);
+      return (_rabuf && _rdmode) ? _rapos : ftell(_fp);
     }
 
   return -ENOENT;
@@ -114,38 +393,95 @@ int audiolite_filestream::filesize()
 
 int audiolite_filestream::seek(int size)
 {
+  int ret = -ENOENT;
+
   if (_fp)
     {
-      return fseek(_fp, size, SEEK_SET);
+      if (_rabuf && _rdmode)
+        {
+          mossfw_lock_take(&_lock);
+          ret = ra_reset(size);
+          mossfw_lock_give(&_lock);
+        }
+      else
+        {
+          ret = fseek(_fp, size, SEEK_SET);
+        }
     }
 
-  return -ENOENT;
+  return ret;
 }
 
 int audiolite_filestream::seekcur(int size)
 {
+  int ret = -ENOENT;
+  bool buffered;
+
   if (_fp)
     {
-      return fseek(_fp, size, SEEK_CUR);
+      if (_rabuf && _rdmode)
+        {
+          /* Skip in prefetched data if possible */
+
+          mossfw_lock_take(&_ralock);
+          buffered = size >= 0 && size <= ra_level();
+          mossfw_lock_give(&_ralock);
+
+          if (buffered)
+            {
+              ret = ra_read(NULL, size) == size ? OK : -EIO;
+            }
+          else
+            {
+              mossfw_lock_take(&_lock);
+              ret = ra_reset(_rapos + size);
+              mossfw_lock_give(&_lock);
+            }
+        }
+      else
+        {
+          ret = fseek(_fp, size, SEEK_CUR);
+        }
     }
 
-  return -ENOENT;
+  return ret;
 }
 
 int audiolite_filestream::seekend(int size)
 {
+  int ret = -ENOENT;
+
   if (_fp)
     {
-      return fseek(_fp, size, SEEK_END);
+      if (_rabuf && _rdmode)
+        {
+          mossfw_lock_take(&_lock);
+          ret = fseek(_fp, size, SEEK_END);
+          if (ret == 0)
+            {
+              ret = ra_reset(ftell(_fp));
+            }
+
+          mossfw_lock_give(&_lock);
+        }
+      else
+        {
+          ret = fseek(_fp, size, SEEK_END);
+        }
     }
 
-  return -ENOENT;
+  return ret;
 }
 
 int audiolite_filestream::read_data(void *data, int sz, int toms)
 {
   if (_fp)
     {
+      if (_rabuf && _rdmode)
+        {
+          return ra_read((char *)data, sz);
+        }
+
       return fread(data, 1, sz, _fp);
     }
 
@@ -184,12 +520,24 @@ int audiolite_filestream::receive_data(audiolite_mem *mem,
   mem->set_storedsize(0);
   if (_fp && sz > 0)
     {
-      ret = fread(&data[ofst], 1, sz, _fp);
-      if (feof(_fp))
+      if (_rabuf && _rdmode)
         {
-          mem->set_eof();
-          fclose(_fp);
-          _fp = NULL;
+          ret = ra_read(&data[ofst], sz);
+          if (ra_ended())
+            {
+              mem->set_eof();
+              close();
+            }
+        }
+      else
+        {
+          ret = fread(&data[ofst], 1, sz, _fp);
+          if (feof(_fp))
+            {
+              mem->set_eof();
+              fclose(_fp);
+              _fp = NULL;
+            }
         }
 
       if (ret >= 0)
@@ -215,3 +563,888 @@ int audiolite_filestream::send_data(audiolite_mem *mem,
 
   return ret;
 }
+
+/* Inherited methods from audiolite_runnable_if */
+
+int audiolite_filestream::run(void *arg)
+{
+  bool ready;
+  uint32_t gen;
+  int idx;
+  int n = 0;
+
+  mossfw_lock_take(&_ralock);
+  while (_rarun &&
+         (_fp == NULL || !_rdmode || _raeof || _rafilled == _radepth))
+    {
+      mossfw_condition_wait(&_racond, &_ralock);
+    }
+
+  mossfw_lock_give(&_ralock);
+
+  if (!_rarun)
+    {
+      return 0;
+    }
+
+  /* Seek and close can not come between taking the generation and
+   * reading the file, since _lock is held.
+   */
+
+  mossfw_lock_take(&_lock);
+  mossfw_lock_take(&_ralock);
+  ready = _fp && _rdmode && !_raeof && _rafilled < _radepth;
+  idx = (_rahead + _rafilled) % _radepth;
+  gen = _ragen;
+  mossfw_lock_give(&_ralock);
+
+  if (ready)
+    {
+      n = fread(&_rabuf[idx * _rablksz], 1, _rablksz, _fp);
+    }
+
+  mossfw_lock_give(&_lock);
+
+  if (ready)
+    {
+      mossfw_lock_take(&_ralock);
+      if (gen == _ragen)
+        {
+          _ralen[idx] = n;
+          _rafilled++;
+          _raeof = (n < _rablksz);
+          if (_raprof)
+            {
+              _raprof->update_prefetch(ra_level());
+            }
+
+          mossfw_condition_notice(&_racond);
+        }
+
+      mossfw_lock_give(&_ralock);
+    }
+
+  return 1;
+}
+
+void audiolite_filestream::before_stop(void *arg)
+{
+  mossfw_lock_take(&_ralock);
+  _rarun = false;
+  mossfw_condition_notice(&_racond);
+  mossfw_lock_give(&_ralock);
+}
+
+/****************************************************************************
+ * Class: audiolite_memstream
+ ****************************************************************************/
+
+audiolite_memstream::~audiolite_memstream()
+{
+  mossfw_lock_fin(&_lock);
+}
+
+int audiolite_memstream::set_pos(int pos)
+{
+  if (_buf == NULL)
+    {
+      return -ENOENT;
+    }
+
+  if (pos < 0 || pos > _stored)
+    {
+      return -EINVAL;
+    }
+
+  _pos = pos;
+  return OK;
+}
+
+int audiolite_memstream::set_buffer(const void *buf, int sz)
+{
+  if (buf == NULL || sz < 0)
+    {
+      return -EINVAL;
+    }
+
+  mossfw_lock_take(&_lock);
+  _buf = (char *)buf;
+  _size = sz;
+  _stored = sz;
+  _pos = 0;
+  _writable = false;
+  mossfw_lock_give(&_lock);
+
+  return OK;
+}
+
+int audiolite_memstream::set_wbuffer(void *buf, int sz)
+{
+  if (buf == NULL || sz < 0)
+    {
+      return -EINVAL;
+    }
+
+  mossfw_lock_take(&_lock);
+  _buf = (char *)buf;
+  _size = sz;
+  _stored = 0;
+  _pos = 0;
+  _writable = true;
+  mossfw_lock_give(&_lock);
+
+  return OK;
+}
+
+void audiolite_memstream::close()
+{
+  mossfw_lock_take(&_lock);
+  _buf = NULL;
+  _size = 0;
+  _stored = 0;
+  _pos = 0;
+  _writable = false;
+  mossfw_lock_give(&_lock);
+}
+
+int audiolite_memstream::filesize()
+{
+  return _buf ? _pos : -ENOENT;
+}
+
+int audiolite_memstream::seek(int size)
+{
+  return set_pos(size);
+}
+
+int audiolite_memstream::seekcur(int size)
+{
+  return set_pos(_pos + size);
+}
+
+int audiolite_memstream::seekend(int size)
+{
+  return set_pos(_stored + size);
+}
+
+bool audiolite_memstream::has_file()
+{
+  return _buf != NULL;
+}
+
+int audiolite_memstream::read_data(void *data, int sz, int toms)
+{
+  int ret = -ENOENT;
+
+  mossfw_lock_take(&_lock);
+  if (_buf)
+    {
+      ret = _stored - _pos;
+      ret = sz < ret ? sz : ret;
+      memcpy(data, &_buf[_pos], ret);
+      _pos += ret;
+    }
+
+  mossfw_lock_give(&_lock);
+
+  return ret;
+}
+
+int audiolite_memstream::write_data(void *data, int sz, int toms)
+{
+  int ret = -ENOENT;
+
+  mossfw_lock_take(&_lock);
+  if (_buf && _writable)
+    {
+      ret = _size - _pos;
+      ret = sz < ret ? sz : ret;
+      memcpy(&_buf[_pos], data, ret);
+      _pos += ret;
+      _stored = _pos > _stored ? _pos : _stored;
+      if (ret == 0 && sz > 0)
+        {
+          ret = -ENOSPC;
+        }
+    }
+
+  mossfw_lock_give(&_lock);
+
+  return ret;
+}
+
+int audiolite_memstream::receive_data(audiolite_mem *mem,
+                                      int ofst, int toms)
+{
+  char *data = (char *)mem->get_data();
+  int sz = mem->get_fullsize() - ofst;
+  int ret = 0;
+
+  mem->set_storedsize(0);
+  if (_buf && sz > 0)
+    {
+      ret = read_data(&data[ofst], sz, toms);
+      if (_pos == _stored)
+        {
+          mem->set_eof();
+        }
+
+      if (ret >= 0)
+        {
+          mem->set_storedsize(ret);
+        }
+    }
+
+  return ret;
+}
+
+int audiolite_memstream::send_data(audiolite_mem *mem,
+                                   int ofst, int toms)
+{
+  char *data = (char *)mem->get_data();
+  int sz = mem->get_storedsize() - ofst;
+  int ret = -EINVAL;
+
+  if (_buf && sz > 0)
+    {
+      ret = write_data(&data[ofst], sz, toms);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Class: audiolite_fdstream
+ ****************************************************************************/
+
+audiolite_fdstream::~audiolite_fdstream()
+{
+  close();
+  mossfw_lock_fin(&_lock);
+}
+
+int audiolite_fdstream::open_fd(const char *fname, int flags)
+{
+  int fd = ::open(fname, flags, 0666);
+
+  if (fd < 0)
+    {
+      return errno;
+    }
+
+  if (set_fd(fd) != OK)
+    {
+      ::close(fd);
+      return EALREADY;
+    }
+
+  _self_open = true;
+  return OK;
+}
+
+int audiolite_fdstream::wait_fd(int events, int toms)
+{
+  struct pollfd pfd;
+  int ret;
+
+  pfd.fd = _fd;
+  pfd.events = events;
+  pfd.revents = 0;
+
+  do
+    {
+      ret = poll(&pfd, 1, toms);
+    }
+  while (ret < 0 && errno == EINTR);
+
+  if (ret < 0)
+    {
+      return -errno;
+    }
+
+  /* Let read() or write() tell the reason of a hang up or an error */
+
+  return ret;
+}
+
+int audiolite_fdstream::skip(int size)
+{
+  char buf[SKIP_BUFSZ];
+  int ret;
+
+  while (size > 0)
+    {
+      ret = read_data(buf, size < SKIP_BUFSZ ? size : SKIP_BUFSZ, -1);
+      if (ret <= 0)
+        {
+          return ret < 0 ? ret : -EIO;
+        }
+
+      size -= ret;
+    }
+
+  return OK;
+}
+
+int audiolite_fdstream::rfile(const char *fname)
+{
+  return open_fd(fname, O_RDONLY);
+}
+
+int audiolite_fdstream::wfile(const char *fname)
+{
+  return open_fd(fname, O_WRONLY | O_CREAT | O_TRUNC);
+}
+
+int audiolite_fdstream::set_fd(int fd)
+{
+  int ret = -EALREADY;
+
+  mossfw_lock_take(&_lock);
+  if (_fd < 0)
+    {
+      _fd = fd;
+      _self_open = false;
+      _eof = false;
+      _seekable = lseek(fd, 0, SEEK_CUR) >= 0;
+      _pos = 0;
+      ret = OK;
+    }
+
+  mossfw_lock_give(&_lock);
+
+  return ret;
+}
+
+void audiolite_fdstream::close()
+{
+  mossfw_lock_take(&_lock);
+  if (_fd >= 0 && _self_open)
+    {
+      ::close(_fd);
+    }
+
+  _fd = -1;
+  _self_open = false;
+  mossfw_lock_give(&_lock);
+}
+
+int audiolite_fdstream::filesize()
+{
+  if (_fd < 0)
+    {
+      return -ENOENT;
+    }
+
+  return _seekable ? (int)lseek(_fd, 0, SEEK_CUR) : _pos;
+}
+
+int audiolite_fdstream::seek(int size)
+{
+  if (_fd < 0)
+    {
+      return -ENOENT;
+    }
+
+  if (_seekable)
+    {
+      return lseek(_fd, size, SEEK_SET) < 0 ? -errno : OK;
+    }
+
+  return size >= _pos ? skip(size - _pos) : -ESPIPE;
+}
+
+int audiolite_fdstream::seekcur(int size)
+{
+  if (_fd < 0)
+    {
+      return -ENOENT;
+    }
+
+  if (_seekable)
+    {
+      return lseek(_fd, size, SEEK_CUR) < 0 ? -errno : OK;
+    }
+
+  return size >= 0 ? skip(size) : -ESPIPE;
+}
+
+int audiolite_fdstream::seekend(int size)
+{
+  if (_fd < 0)
+    {
+      return -ENOENT;
+    }
+
+  if (_seekable)
+    {
+      return lseek(_fd, size, SEEK_END) < 0 ? -errno : OK;
+    }
+
+  return -ESPIPE;
+}
+
+bool audiolite_fdstream::has_file()
+{
+  bool ret;
+  mossfw_lock_take(&_lock);
+  ret = _fd >= 0;
+  mossfw_lock_give(&_lock);
+  return ret;
+}
+
+int audiolite_fdstream::read_data(void *data, int sz, int toms)
+{
+  struct timespec limit;
+  char *buf = (char *)data;
+  int done = 0;
+  int tout = toms;
+  int ret = 0;
+
+  if (_fd < 0)
+    {
+      return -ENOENT;
+    }
+
+  if (toms > 0)
+    {
+      calc_limit(CLOCK_MONOTONIC, toms, &limit);
+    }
+
+  while (done < sz)
+    {
+      ret = wait_fd(POLLIN, tout);
+      if (ret <= 0)
+        {
+          break;
+        }
+
+      ret = read(_fd, &buf[done], sz - done);
+      if (ret == 0)
+        {
+          _eof = true;
+          break;
+        }
+      else if (ret < 0)
+        {
+          if (errno == EINTR || errno == EAGAIN)
+            {
+              ret = 0;
+              continue;
+            }
+
+          ret = -errno;
+          break;
+        }
+
+      done += ret;
+
+      if (toms > 0)
+        {
+          tout = left_ms(CLOCK_MONOTONIC, &limit);
+        }
+    }
+
+  _pos += done;
+
+  if (done > 0 || _eof)
+    {
+      return done;
+    }
+
+  return ret < 0 ? ret : -EAGAIN;
+}
+
+int audiolite_fdstream::write_data(void *data, int sz, int toms)
+{
+  struct timespec limit;
+  char *buf = (char *)data;
+  int done = 0;
+  int tout = toms;
+  int ret = 0;
+
+  if (_fd < 0)
+    {
+      return -ENOENT;
+    }
+
+  if (toms > 0)
+    {
+      calc_limit(CLOCK_MONOTONIC, toms, &limit);
+    }
+
+  while (done < sz)
+    {
+      ret = wait_fd(POLLOUT, tout);
+      if (ret <= 0)
+        {
+          break;
+        }
+
+      ret = write(_fd, &buf[done], sz - done);
+      if (ret < 0)
+        {
+          if (errno == EINTR || errno == EAGAIN)
+            {
+              ret = 0;
+              continue;
+            }
+
+          ret = -errno;
+          break;
+        }
+
+      done += ret;
+
+      if (toms > 0)
+        {
+          tout = left_ms(CLOCK_MONOTONIC, &limit);
+        }
+    }
+
+  _pos += done;
+
+  if (done > 0)
+    {
+      return done;
+    }
+
+  return ret < 0 ? ret : -EAGAIN;
+}
+
+int audiolite_fdstream::receive_data(audiolite_mem *mem,
+                                     int ofst, int toms)
+{
+  char *data = (char *)mem->get_data();
+  int sz = mem->get_fullsize() - ofst;
+  int ret = 0;
+
+  mem->set_storedsize(0);
+  if (_fd >= 0 && sz > 0)
+    {
+      ret = read_data(&data[ofst], sz, toms);
+      if (_eof)
+        {
+          mem->set_eof();
+          close();
+        }
+
+      if (ret >= 0)
+        {
+          mem->set_storedsize(ret);
+        }
+    }
+
+  return ret;
+}
+
+int audiolite_fdstream::send_data(audiolite_mem *mem,
+                                  int ofst, int toms)
+{
+  char *data = (char *)mem->get_data();
+  int sz = mem->get_storedsize() - ofst;
+  int ret = -EINVAL;
+
+  if (_fd >= 0 && sz > 0)
+    {
+      ret = write_data(&data[ofst], sz, toms);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Class: audiolite_ringstream
+ ****************************************************************************/
+
+audiolite_ringstream::audiolite_ringstream(int size) :
+  _buf(NULL), _size(0), _rpos(0), _stored(0), _rtotal(0),
+  _ownbuf(true), _eos(false), _closed(false)
+{
+  mossfw_lock_init(&_lock);
+  mossfw_condition_init(&_cond);
+
+  _buf = (char *)malloc(size);
+  if (_buf)
+    {
+      _size = size;
+    }
+  else
+    {
+      printf("[AudioLite] Fatal Error! No memory for ring stream\n");
+    }
+}
+
+audiolite_ringstream::audiolite_ringstream(void *buf, int size) :
+  _buf((char *)buf), _size(buf ? size : 0), _rpos(0), _stored(0),
+  _rtotal(0), _ownbuf(false), _eos(false), _closed(false)
+{
+  mossfw_lock_init(&_lock);
+  mossfw_condition_init(&_cond);
+}
+
+audiolite_ringstream::~audiolite_ringstream()
+{
+  close();
+
+  if (_ownbuf && _buf)
+    {
+      free(_buf);
+    }
+
+  mossfw_condition_fin(&_cond);
+  mossfw_lock_fin(&_lock);
+}
+
+int audiolite_ringstream::wait_locked(struct timespec *limit)
+{
+  int ret;
+
+  if (limit == NULL)
+    {
+      mossfw_condition_wait(&_cond, &_lock);
+      return OK;
+    }
+
+  /* mossfw has no timed wait. Its lock and condition are pthread
+   * objects, so the limit is given to pthread directly.
+   */
+
+  ret = pthread_cond_timedwait(&_cond, &_lock, limit);
+  return ret == ETIMEDOUT ? -ETIMEDOUT : OK;
+}
+
+int audiolite_ringstream::skip(int size)
+{
+  char buf[SKIP_BUFSZ];
+  int ret;
+
+  while (size > 0)
+    {
+      ret = read_data(buf, size < SKIP_BUFSZ ? size : SKIP_BUFSZ, -1);
+      if (ret <= 0)
+        {
+          return ret < 0 ? ret : -EIO;
+        }
+
+      size -= ret;
+    }
+
+  return OK;
+}
+
+void audiolite_ringstream::set_eos()
+{
+  mossfw_lock_take(&_lock);
+  _eos = true;
+  mossfw_condition_notice(&_cond);
+  mossfw_lock_give(&_lock);
+}
+
+void audiolite_ringstream::reset()
+{
+  mossfw_lock_take(&_lock);
+  _rpos = 0;
+  _stored = 0;
+  _rtotal = 0;
+  _eos = false;
+  _closed = false;
+  mossfw_condition_notice(&_cond);
+  mossfw_lock_give(&_lock);
+}
+
+int audiolite_ringstream::remaining()
+{
+  return _stored;
+}
+
+int audiolite_ringstream::space()
+{
+  return _size - _stored;
+}
+
+void audiolite_ringstream::close()
+{
+  mossfw_lock_take(&_lock);
+  _closed = true;
+  mossfw_condition_notice(&_cond);
+  mossfw_lock_give(&_lock);
+}
+
+int audiolite_ringstream::filesize()
+{
+  return _rtotal;
+}
+
+int audiolite_ringstream::seek(int size)
+{
+  return size >= _rtotal ? skip(size - _rtotal) : -ESPIPE;
+}
+
+int audiolite_ringstream::seekcur(int size)
+{
+  return size >= 0 ? skip(size) : -ESPIPE;
+}
+
+int audiolite_ringstream::seekend(int size)
+{
+  return -ESPIPE;
+}
+
+bool audiolite_ringstream::has_file()
+{
+  return _buf != NULL && !_closed;
+}
+
+int audiolite_ringstream::read_data(void *data, int sz, int toms)
+{
+  struct timespec limit;
+  char *buf = (char *)data;
+  int done = 0;
+  int ret = 0;
+  int n;
+
+  if (_buf == NULL)
+    {
+      return -ENOENT;
+    }
+
+  if (toms > 0)
+    {
+      calc_limit(CLOCK_REALTIME, toms, &limit);
+    }
+
+  mossfw_lock_take(&_lock);
+
+  while (done < sz && !_closed)
+    {
+      if (_stored == 0)
+        {
+          if (_eos || toms == 0 || ret != 0)
+            {
+              break;
+            }
+
+          ret = wait_locked(toms > 0 ? &limit : NULL);
+          continue;
+        }
+
+      /* Copy up to the end of the ring at once */
+
+      n = _size - _rpos;
+      n = _stored < n ? _stored : n;
+      n = (sz - done) < n ? (sz - done) : n;
+
+      memcpy(&buf[done], &_buf[_rpos], n);
+      _rpos = (_rpos + n) % _size;
+      _stored -= n;
+      done += n;
+      mossfw_condition_notice(&_cond);
+    }
+
+  _rtotal += done;
+
+  if (done == 0 && !_eos && !_closed)
+    {
+      done = -EAGAIN;
+    }
+
+  mossfw_lock_give(&_lock);
+
+  return done;
+}
+
+int audiolite_ringstream::write_data(void *data, int sz, int toms)
+{
+  struct timespec limit;
+  char *buf = (char *)data;
+  int done = 0;
+  int ret = 0;
+  int wpos;
+  int n;
+
+  if (_buf == NULL)
+    {
+      return -ENOENT;
+    }
+
+  if (toms > 0)
+    {
+      calc_limit(CLOCK_REALTIME, toms, &limit);
+    }
+
+  mossfw_lock_take(&_lock);
+
+  while (done < sz && !_closed)
+    {
+      if (_stored == _size)
+        {
+          if (toms == 0 || ret != 0)
+            {
+              break;
+            }
+
+          ret = wait_locked(toms > 0 ? &limit : NULL);
+          continue;
+        }
+
+      wpos = (_rpos + _stored) % _size;
+      n = _size - _stored;
+      n = (_size - wpos) < n ? (_size - wpos) : n;
+      n = (sz - done) < n ? (sz - done) : n;
+
+      memcpy(&_buf[wpos], &buf[done], n);
+      _stored += n;
+      done += n;
+      mossfw_condition_notice(&_cond);
+    }
+
+  if (done == 0)
+    {
+      done = _closed ? -EPIPE : -EAGAIN;
+    }
+
+  mossfw_lock_give(&_lock);
+
+  return done;
+}
+
+int audiolite_ringstream::receive_data(audiolite_mem *mem,
+                                       int ofst, int toms)
+{
+  char *data = (char *)mem->get_data();
+  int sz = mem->get_fullsize() - ofst;
+  int ret = 0;
+
+  mem->set_storedsize(0);
+  if (_buf && sz > 0)
+    {
+      ret = read_data(&data[ofst], sz, toms);
+      if ((_eos && _stored == 0) || _closed)
+        {
+          mem->set_eof();
+        }
+
+      if (ret >= 0)
+        {
+          mem->set_storedsize(ret);
+        }
+    }
+
+  return ret;
+}
+
+int audiolite_ringstream::send_data(audiolite_mem *mem,
+                                    int ofst, int toms)
+{
+  char *data = (char *)mem->get_data();
+  int sz = mem->get_storedsize() - ofst;
+  int ret = -EINVAL;
+
+  if (_buf && sz > 0)
+    {
+      ret = write_data(&data[ofst], sz, toms);
+    }
+
+  return ret;
+}
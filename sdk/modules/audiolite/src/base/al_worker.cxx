@@ -53,6 +53,9 @@ audiolite_workermemq::audiolite_workermemq(int maxsz)
   mossfw_lock_init(&_lock);
   mossfw_condition_init(&_cond);
   dq_init(&_mem_proc);
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  reset_profile();
+#endif
 }
 
 audiolite_workermemq::~audiolite_workermemq()
@@ -97,6 +100,9 @@ void audiolite_workermemq::push(audiolite_memapbuf *mem)
 
   if (_en)
     {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+      mem->qstamp = audiolite_profile_us();
+#endif
       dq_addlast(mem->get_link(), &_mem_proc);
     }
   else
@@ -152,6 +158,23 @@ audiolite_memapbuf *audiolite_workermemq::pop(unsigned char *adr)
   return mem;
 }
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+void audiolite_workermemq::record_roundtrip(audiolite_memapbuf *mem)
+{
+  al_profile_time_add(&_prof, audiolite_profile_us() - mem->qstamp);
+}
+
+void audiolite_workermemq::get_profile(struct al_profile_time_s *prof)
+{
+  *prof = _prof;
+}
+
+void audiolite_workermemq::reset_profile()
+{
+  memset(&_prof, 0, sizeof(struct al_profile_time_s));
+}
+#endif
+
 /****************************************************************************
  * class: audiolite_worker
  ****************************************************************************/
@@ -51,6 +51,11 @@ audiolite_workercomp::audiolite_workercomp(const char *workername,
 
 audiolite_workercomp::~audiolite_workercomp()
 {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  /* Leave the list before the queues are destroyed */
+
+  audiolite_profile_unregister(this);
+#endif
 }
 
 int audiolite_workercomp::handle_message(al_comm_msghdr_t hdr,
@@ -123,6 +128,9 @@ int audiolite_workercomp::handle_message(al_comm_msghdr_t hdr,
       mem = thiz->_inq.pop(opt->addr);
       if (mem)
         {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+          thiz->_inq.record_roundtrip(mem);
+#endif
           nmem = listener->release_inmem(thiz, wtask, mem, opt->size);
           mem->release();
           if (nmem)
@@ -137,6 +145,9 @@ int audiolite_workercomp::handle_message(al_comm_msghdr_t hdr,
       mem = thiz->_outq.pop(opt->addr);
       if (mem)
         {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+          thiz->_outq.record_roundtrip(mem);
+#endif
           if (opt->eof == 1)
             {
               mem->set_eof();
@@ -318,3 +329,17 @@ int audiolite_workercomp::run(void *arg)
 void audiolite_workercomp::before_stop(void *arg)
 {
 }
+
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+void audiolite_workercomp::get_subprofile(struct al_profile_s *prof)
+{
+  _inq.get_profile(&prof->wk_in);
+  _outq.get_profile(&prof->wk_out);
+}
+
+void audiolite_workercomp::reset_subprofile()
+{
+  _inq.reset_profile();
+  _outq.reset_profile();
+}
+#endif
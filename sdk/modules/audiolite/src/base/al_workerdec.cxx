@@ -0,0 +1,364 @@
+/****************************************************************************
+ * modules/audiolite/src/base/al_workerdec.cxx
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+
+#include <audiolite/al_debug.h>
+#include <audiolite/al_workerdec.h>
+#include <audiolite/al_eventlistener.h>
+
+/****************************************************************************
+ * Class: audiolite_workerdec
+ ****************************************************************************/
+
+audiolite_workerdec::audiolite_workerdec(const char *workername,
+                                         int version,
+                                         int inqsz, int outqsz) :
+  audiolite_workercomp(workername, inqsz, outqsz, 0, 1),
+  _stream(NULL), _imempool(NULL), _rdq(inqsz), _runner_evt(false),
+  _version(version), _frame_eof(false),
+  _dec_chs(0), _dec_fs(0), _dec_kbps(0)
+{
+  mossfw_lock_init(&_evtlock);
+  mossfw_condition_init(&_evtcond);
+  set_msglistener(&_declsnr);
+}
+
+audiolite_workerdec::~audiolite_workerdec()
+{
+  mossfw_condition_fin(&_evtcond);
+  mossfw_lock_fin(&_evtlock);
+}
+
+void audiolite_workerdec::wait_runner()
+{
+  mossfw_lock_take(&_evtlock);
+  while (!_runner_evt)
+    {
+      mossfw_condition_wait(&_evtcond, &_evtlock);
+    }
+
+  _runner_evt = false;
+  mossfw_lock_give(&_evtlock);
+}
+
+void audiolite_workerdec::notify_runner()
+{
+  mossfw_lock_take(&_evtlock);
+  _runner_evt = true;
+  mossfw_condition_notice(&_evtcond);
+  mossfw_lock_give(&_evtlock);
+}
+
+void audiolite_workerdec::pool_event(void *arg)
+{
+  ((audiolite_workerdec *)arg)->notify_runner();
+}
+
+void audiolite_workerdec::read_stream(audiolite_memapbuf *mem)
+{
+  _stream->receive_data(mem, 0, -1);
+
+  if (mem->is_eof())
+    {
+      /* Zero sized memory can not be injected to the worker.
+       * Send EOF with a padding byte, which the worker ignores
+       * as a fragment of a frame.
+       */
+
+      if (mem->get_storedsize() == 0)
+        {
+          *(uint8_t *)mem->get_data() = 0;
+          mem->set_storedsize(1);
+        }
+
+      _frame_eof = true;
+    }
+}
+
+void audiolite_workerdec::flush_readq()
+{
+  audiolite_memapbuf *mem;
+
+  for (mem = _rdq.pop(); mem; mem = _rdq.pop())
+    {
+      mem->release();
+    }
+}
+
+int audiolite_workerdec::on_starting(audiolite_inputnode *inode,
+                                     audiolite_outputnode *onode)
+{
+  int ret;
+
+  if (_stream == NULL || _imempool == NULL || _pool == NULL)
+    {
+      return -EINVAL;
+    }
+
+  _frame_eof = false;
+  _dec_chs = 0;
+  _dec_fs = 0;
+  _dec_kbps = 0;
+
+  _stream->seek(0);
+  _imempool->enable_pool();
+  _pool->set_eventcallback(audiolite_workerdec::pool_event, this);
+
+  ret = audiolite_workercomp::on_starting(inode, onode);
+  if (ret != OK)
+    {
+      _pool->set_eventcallback(NULL, NULL);
+      _imempool->disable_pool();
+    }
+
+  return ret;
+}
+
+void audiolite_workerdec::on_canceled(audiolite_inputnode *inode,
+                                      audiolite_outputnode *onode)
+{
+  _imempool->disable_pool();
+  audiolite_workercomp::on_canceled(inode, onode);
+  _pool->set_eventcallback(NULL, NULL);
+  flush_readq();
+}
+
+void audiolite_workerdec::on_stopping(audiolite_inputnode *inode,
+                                      audiolite_outputnode *onode)
+{
+  _imempool->disable_pool();
+  audiolite_workercomp::on_stopping(inode, onode);
+  _pool->set_eventcallback(NULL, NULL);
+  flush_readq();
+}
+
+int audiolite_workerdec::run(void *arg)
+{
+  audiolite_workerdec *thiz = (audiolite_workerdec *)arg;
+  audiolite_memapbuf *mem;
+  bool busy = false;
+
+  if (thiz->_worker_booted)
+    {
+      /* Refill an input memory released by the worker */
+
+      mem = thiz->_rdq.pop();
+      if (mem)
+        {
+          if (thiz->_frame_eof)
+            {
+              mem->release();
+            }
+          else
+            {
+              thiz->read_stream(mem);
+              thiz->_inq.push(mem);
+              alworker_inject_imem(thiz->_worker.getwtask(), mem);
+            }
+
+          busy = true;
+        }
+
+      /* Inject an output memory without blocking, as waiting for it
+       * here would also stop the refill above.
+       */
+
+      if (thiz->_outq.current_sz() < thiz->_outq.get_qsize())
+        {
+          mem = (audiolite_memapbuf *)thiz->_pool->allocate(false);
+          if (mem)
+            {
+              thiz->_outq.push(mem);
+              alworker_inject_omem(thiz->_worker.getwtask(), mem);
+              busy = true;
+            }
+        }
+    }
+
+  /* Sleep until the worker returns a memory, the output pool gets
+   * a free memory or is enabled, or the thread is stopped.
+   */
+
+  if (!busy)
+    {
+      thiz->wait_runner();
+    }
+
+  return 1;
+}
+
+void audiolite_workerdec::before_stop(void *arg)
+{
+  ((audiolite_workerdec *)arg)->notify_runner();
+}
+
+/****************************************************************************
+ * Message Listener Class Methods
+ ****************************************************************************/
+
+void audiolite_workerdec::workerdec_msglistener::bootup(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask, int version, void *d)
+{
+  int i;
+  al_comm_msgopt_t opt;
+  audiolite_memapbuf *mem;
+  audiolite_workerdec *thiz = (audiolite_workerdec *)wcomp;
+
+  if (version != thiz->_version)
+    {
+      thiz->publish_event(AL_EVENT_WRONGVERSION, version);
+      return;
+    }
+
+  alworker_send_systemparam(wtask, thiz->channels(),
+                                   thiz->samplingrate(),
+                                   thiz->samplebitwidth());
+
+  /* Hand input memories to the injection thread, which fills them
+   * with compressed data once the worker is booted.
+   */
+
+  for (i = 0; i < thiz->_inq.get_qsize(); i++)
+    {
+      mem = (audiolite_memapbuf *)thiz->_imempool->allocate(false);
+      if (mem == NULL)
+        {
+          break;
+        }
+
+      thiz->_rdq.push(mem);
+    }
+
+  memset(&opt, 0, sizeof(opt));
+  thiz->set_playopt(&opt);
+  alworker_send_start(wtask, &opt);
+}
+
+void audiolite_workerdec::workerdec_msglistener::error(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask, int id, int ercode)
+{
+  al_derror("Decoder worker error : %d\n", ercode);
+
+  if (ercode == AL_COMM_MSGCODEERR_ILLIGALFRAME)
+    {
+      wcomp->publish_event(AL_EVENT_ILLIGALSTREAM, ercode);
+    }
+  else
+    {
+      wcomp->publish_event(AL_EVENT_UNSUPPORTFMT, ercode);
+    }
+}
+
+void audiolite_workerdec::workerdec_msglistener::info(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask,
+     int id, int chs, int fs, int layer, int rate)
+{
+  uint32_t param;
+  uint16_t *hparam = (uint16_t *)&param;
+  audiolite_workerdec *thiz = (audiolite_workerdec *)wcomp;
+
+  thiz->_dec_chs = chs;
+  thiz->_dec_fs = fs;
+  thiz->_dec_kbps = rate;
+
+  /* Same packing as AL_EVENT_MP3FRAMEINFO */
+
+  hparam[0] = chs;
+  hparam[1] = fs / 1000;
+
+  wcomp->publish_event(AL_EVENT_FRAMEINFO, param);
+}
+
+void audiolite_workerdec::workerdec_msglistener::done(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask, int id)
+{
+  wcomp->publish_event(AL_EVENT_DECODEDONE, 0);
+}
+
+audiolite_memapbuf *
+audiolite_workerdec::workerdec_msglistener::release_inmem(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask,
+     audiolite_memapbuf *mem, int size)
+{
+  audiolite_workerdec *thiz = (audiolite_workerdec *)wcomp;
+
+  if (thiz->_frame_eof || !thiz->_worker_booted)
+    {
+      return NULL;
+    }
+
+  /* Re-use the memory for next data. The reference is taken
+   * because the caller releases it after this returns.
+   * Reading the stream can block, so it is done by the injection thread.
+   */
+
+  mem->reference();
+  thiz->_rdq.push(mem);
+  thiz->notify_runner();
+
+  return NULL;
+}
+
+audiolite_memapbuf *
+audiolite_workerdec::workerdec_msglistener::release_outmem(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask,
+     audiolite_memapbuf *mem)
+{
+  audiolite_workerdec *thiz = (audiolite_workerdec *)wcomp;
+
+  /* Let the following component know the decoded rate,
+   * which can be differ from the system rate.
+   */
+
+  if (thiz->_dec_fs > 0)
+    {
+      mem->set_fs(thiz->_dec_fs);
+    }
+
+  push_data(wcomp, mem);
+
+  /* A slot of the output queue is free now */
+
+  thiz->notify_runner();
+
+  return NULL;
+}
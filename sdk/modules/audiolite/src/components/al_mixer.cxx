@@ -0,0 +1,677 @@
+/****************************************************************************
+ * modules/audiolite/src/components/al_mixer.cxx
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+
+#include <audiolite/al_debug.h>
+#include <audiolite/al_mixer.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define FRAME_BYTES(c)  ((c) * (int)sizeof(int16_t))
+
+/* Timestamp difference under this is treated as jitter (1/1000 sec) */
+
+#define ALIGN_TOLERANCE(fs)  ((fs) / 1000)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static inline int16_t saturate16(float v)
+{
+  if (v >= 32767.f)
+    {
+      return 32767;
+    }
+  else if (v <= -32768.f)
+    {
+      return -32768;
+    }
+
+  return (int16_t)v;
+}
+
+/****************************************************************************
+ * Class: audiolite_mixer
+ ****************************************************************************/
+
+/***********************************************
+ * Protected Class audiolite_mixer Methods
+ ***********************************************/
+
+int audiolite_mixer::frontier(int idx)
+{
+  int pos = -1;
+  int endpos = 0;
+
+  /* Earliest position which is not mixed by all playing inputs */
+
+  for (int i = 0; i < _innum; i++)
+    {
+      if (i != idx && _in[i].active)
+        {
+          if (!_in[i].ended)
+            {
+              if (pos < 0 || _in[i].wpos < pos)
+                {
+                  pos = _in[i].wpos;
+                }
+            }
+          else if (_in[i].wpos > endpos)
+            {
+              endpos = _in[i].wpos;
+            }
+        }
+    }
+
+  return pos < 0 ? endpos : pos;
+}
+
+void audiolite_mixer::join_input(int idx)
+{
+  struct mixin_s *m = &_in[idx];
+
+  m->wpos = frontier(idx);
+  m->skip = 0;
+  m->ended = false;
+  m->active = true;
+}
+
+void audiolite_mixer::leave_input(int idx)
+{
+  struct mixin_s *m = &_in[idx];
+
+  if (m->mem)
+    {
+      m->mem->release();
+      m->mem = NULL;
+    }
+
+  m->active = false;
+  m->ended = false;
+  m->wpos = 0;
+  m->skip = 0;
+}
+
+void audiolite_mixer::place_mem(int idx, audiolite_mem *mem)
+{
+  struct mixin_s *m = &_in[idx];
+  int fs = samplingrate();
+  int64_t ts = (int64_t)mem->timestamp;
+  int64_t pos;
+  int64_t diff;
+
+  if (ts == 0 || fs <= 0)
+    {
+      return;
+    }
+
+  pos = (int64_t)_outframes + m->wpos;
+
+  /* The first stamped memory decides the timeline of the mixer */
+
+  if (!_anchored)
+    {
+      _anchor_us = ts - pos * 1000000 / fs;
+      _anchored = true;
+    }
+
+  diff = (ts - _anchor_us) * fs / 1000000 - pos;
+  if (diff > ALIGN_TOLERANCE(fs) || diff < -ALIGN_TOLERANCE(fs))
+    {
+      al_dinfo("Input %d is aligned by %d frames\n", idx, (int)diff);
+      m->skip = diff;
+    }
+  else
+    {
+      m->skip = 0;
+    }
+}
+
+bool audiolite_mixer::fetch_mem(int idx)
+{
+  struct mixin_s *m = &_in[idx];
+  audiolite_mem *mem = pop_data(idx);
+
+  if (mem == NULL)
+    {
+      return false;
+    }
+
+  if (!m->active)
+    {
+      join_input(idx);
+    }
+
+  m->mem = mem;
+  m->ofst = 0;
+  place_mem(idx, mem);
+
+  return true;
+}
+
+void audiolite_mixer::apply_request(int idx)
+{
+  struct mixin_s *m = &_in[idx];
+  audiolite_mem *mem;
+
+  if (m->stopreq)
+    {
+      /* Previous component was stopped. Drop remaining data. */
+
+      if (m->mem)
+        {
+          m->mem->release();
+          m->mem = NULL;
+        }
+
+      while ((mem = pop_data(idx)) != NULL)
+        {
+          mem->release();
+        }
+
+      if (m->active)
+        {
+          m->ended = true;
+        }
+
+      m->stopreq = false;
+    }
+
+  if (m->rampreq >= 0)
+    {
+      if (m->rampreq == 0)
+        {
+          m->gain = m->target;
+          m->ramp = 0;
+        }
+      else
+        {
+          m->step = (m->target - m->gain) / m->rampreq;
+          m->ramp = m->rampreq;
+        }
+
+      m->rampreq = -1;
+    }
+}
+
+void audiolite_mixer::mix_input(int idx, int frames, int chs)
+{
+  struct mixin_s *m = &_in[idx];
+  int fbytes = FRAME_BYTES(chs);
+  int16_t *src;
+  float *acc;
+  int remain;
+  int n;
+  bool eof;
+
+  while (m->active && !m->ended && m->wpos < frames)
+    {
+      if (m->mem == NULL && !fetch_mem(idx))
+        {
+          break;
+        }
+
+      if (m->skip > 0)
+        {
+          /* Leave silence until the timestamp */
+
+          n = frames - m->wpos;
+          n = m->skip < n ? (int)m->skip : n;
+          m->wpos += n;
+          m->skip -= n;
+          continue;
+        }
+
+      remain = (m->mem->get_storedsize() - m->ofst) / fbytes;
+
+      if (m->skip < 0)
+        {
+          /* Drop samples behind the timeline */
+
+          n = -m->skip < remain ? (int)-m->skip : remain;
+          m->ofst += n * fbytes;
+          m->skip += n;
+          remain -= n;
+        }
+
+      n = frames - m->wpos;
+      n = remain < n ? remain : n;
+
+      src = (int16_t *)((char *)m->mem->get_data() + m->ofst);
+      acc = &_acc[m->wpos * chs];
+
+      if (m->ramp == 0)
+        {
+          if (m->gain != 0.f)
+            {
+              for (int i = 0; i < n * chs; i++)
+                {
+                  acc[i] += src[i] * m->gain;
+                }
+            }
+        }
+      else
+        {
+          for (int f = 0; f < n; f++)
+            {
+              if (m->ramp > 0)
+                {
+                  m->gain += m->step;
+                  if (--m->ramp == 0)
+                    {
+                      m->gain = m->target;
+                    }
+                }
+
+              for (int c = 0; c < chs; c++)
+                {
+                  acc[c] += src[c] * m->gain;
+                }
+
+              acc += chs;
+              src += chs;
+            }
+        }
+
+      m->wpos += n;
+      m->ofst += n * fbytes;
+      remain -= n;
+
+      if (remain == 0)
+        {
+          eof = m->mem->is_eof();
+          m->mem->release();
+          m->mem = NULL;
+
+          if (eof)
+            {
+              m->ended = true;
+            }
+        }
+    }
+}
+
+void audiolite_mixer::flush_output(int frames, int chs, bool eof)
+{
+  int16_t *dst = (int16_t *)_outmem->get_data();
+
+  for (int i = 0; i < frames * chs; i++)
+    {
+      dst[i] = saturate16(_acc[i]);
+    }
+
+  _outmem->set_storedsize(frames * FRAME_BYTES(chs));
+  _outmem->set_fs(samplingrate());
+  if (eof)
+    {
+      _outmem->set_eof();
+    }
+  else
+    {
+      _outmem->clear_eof();
+    }
+
+  if (frames > 0)
+    {
+      push_data(_outmem);
+    }
+
+  _outmem->release();
+  _outmem = NULL;
+  _outframes += frames;
+}
+
+void audiolite_mixer::release_all()
+{
+  for (int i = 0; i < _innum; i++)
+    {
+      leave_input(i);
+      _in[i].stopreq = false;
+      _in[i].gain = _in[i].target;
+      _in[i].ramp = 0;
+      _in[i].rampreq = -1;
+    }
+
+  if (_outmem)
+    {
+      _outmem->release();
+      _outmem = NULL;
+    }
+
+  _outframes = 0;
+  _anchored = false;
+}
+
+/***********************************************
+ * Public Class audiolite_mixer Methods
+ ***********************************************/
+
+audiolite_mixer::audiolite_mixer(int inputs) :
+  audiolite_component(inputs, 1),
+  _in(NULL), _outmem(NULL), _acc(NULL), _accsz(0), _outframes(0),
+  _anchor_us(0), _anchored(false), _running(false)
+{
+  mossfw_lock_init(&_lock);
+  set_operatorname("al_mixer_op");
+
+  if (_innum > 0)
+    {
+      _in = (struct mixin_s *)malloc(sizeof(struct mixin_s) * _innum);
+      if (_in == NULL)
+        {
+          printf("[AudioLite] Fatal Error! No memory mixer input\n");
+          _innum = 0;
+          return;
+        }
+
+      memset(_in, 0, sizeof(struct mixin_s) * _innum);
+      for (int i = 0; i < _innum; i++)
+        {
+          _in[i].gain = 1.f;
+          _in[i].target = 1.f;
+          _in[i].rampreq = -1;
+        }
+    }
+}
+
+audiolite_mixer::~audiolite_mixer()
+{
+  if (_in)
+    {
+      release_all();
+      free(_in);
+    }
+
+  if (_acc)
+    {
+      free(_acc);
+    }
+
+  mossfw_lock_fin(&_lock);
+}
+
+int audiolite_mixer::set_gain(int idx, float gain, int ramp_ms)
+{
+  if (idx < 0 || idx >= _innum || ramp_ms < 0)
+    {
+      return -EINVAL;
+    }
+
+  gain = gain < 0.f ? 0.f : gain;
+  gain = gain > AL_MIXER_MAX_GAIN ? AL_MIXER_MAX_GAIN : gain;
+
+  mossfw_lock_take(&_lock);
+  _in[idx].target = gain;
+  _in[idx].rampreq = (int)((int64_t)ramp_ms * samplingrate() / 1000);
+  mossfw_lock_give(&_lock);
+
+  return OK;
+}
+
+float audiolite_mixer::get_gain(int idx)
+{
+  return (idx >= 0 && idx < _innum) ? _in[idx].target : 0.f;
+}
+
+/* Inherited member functions from audiolite_component */
+
+int audiolite_mixer::start(audiolite_inputnode *node)
+{
+  int idx = search_inputidx(node);
+  bool running;
+
+  mossfw_lock_take(&_lock);
+  running = _running;
+  if (idx >= 0)
+    {
+      _in[idx].stopreq = false;
+    }
+
+  mossfw_lock_give(&_lock);
+
+  /* Another input started the output already. Just join to it. */
+
+  if (running)
+    {
+      return OK;
+    }
+
+  return audiolite_component::start(node);
+}
+
+void audiolite_mixer::stop(audiolite_inputnode *node)
+{
+  int idx = search_inputidx(node);
+  bool others = false;
+
+  mossfw_lock_take(&_lock);
+  if (_running && idx >= 0)
+    {
+      for (int i = 0; i < _innum; i++)
+        {
+          if (i != idx && _in[i].active && !_in[i].ended &&
+              !_in[i].stopreq)
+            {
+              others = true;
+            }
+        }
+
+      if (others)
+        {
+          _in[idx].stopreq = true;
+        }
+    }
+
+  mossfw_lock_give(&_lock);
+
+  /* Stop the output only when it is the last playing input */
+
+  if (!others)
+    {
+      audiolite_component::stop(node);
+    }
+}
+
+void audiolite_mixer::on_data()
+{
+  int chs = channels();
+  int frames;
+  int maxpos;
+  bool any;
+  bool complete;
+  bool alleof;
+  audiolite_mem *mem;
+
+  if (_pool == NULL || chs <= 0)
+    {
+      return;
+    }
+
+  mossfw_lock_take(&_lock);
+
+  while (_running)
+    {
+      /* Inputs which have new data join to the mix */
+
+      for (int i = 0; i < _innum; i++)
+        {
+          apply_request(i);
+          if (!_in[i].active && _in[i].mem == NULL)
+            {
+              fetch_mem(i);
+            }
+        }
+
+      if (_outmem == NULL)
+        {
+          any = false;
+          for (int i = 0; i < _innum; i++)
+            {
+              any = any || _in[i].active;
+            }
+
+          if (!any)
+            {
+              break;
+            }
+
+          mossfw_lock_give(&_lock);
+          mem = _pool->allocate();
+          mossfw_lock_take(&_lock);
+
+          if (mem == NULL || !_running)
+            {
+              if (mem)
+                {
+                  mem->release();
+                }
+
+              break;
+            }
+
+          frames = mem->get_fullsize() / FRAME_BYTES(chs);
+          if (frames * chs > _accsz)
+            {
+              free(_acc);
+              _acc = (float *)malloc(sizeof(float) * frames * chs);
+              _accsz = _acc ? frames * chs : 0;
+              if (_acc == NULL)
+                {
+                  al_derror("No memory for mixing %d frames\n", frames);
+                  mem->release();
+                  break;
+                }
+            }
+
+          memset(_acc, 0, sizeof(float) * frames * chs);
+          _outmem = mem;
+        }
+
+      frames = _outmem->get_fullsize() / FRAME_BYTES(chs);
+
+      for (int i = 0; i < _innum; i++)
+        {
+          mix_input(i, frames, chs);
+        }
+
+      /* Output is completed when all playing inputs filled it */
+
+      any = false;
+      complete = true;
+      alleof = true;
+      maxpos = 0;
+
+      for (int i = 0; i < _innum; i++)
+        {
+          if (_in[i].active)
+            {
+              any = true;
+              maxpos = _in[i].wpos > maxpos ? _in[i].wpos : maxpos;
+              if (!_in[i].ended)
+                {
+                  alleof = false;
+                  if (_in[i].wpos < frames)
+                    {
+                      complete = false;
+                    }
+                }
+            }
+        }
+
+      if (!any || !complete)
+        {
+          break;
+        }
+
+      flush_output(alleof ? maxpos : frames, chs, alleof);
+
+      for (int i = 0; i < _innum; i++)
+        {
+          if (_in[i].ended)
+            {
+              leave_input(i);
+            }
+          else
+            {
+              _in[i].wpos = 0;
+            }
+        }
+    }
+
+  mossfw_lock_give(&_lock);
+}
+
+int audiolite_mixer::on_starting(audiolite_inputnode *inode,
+                                 audiolite_outputnode *onode)
+{
+  if (_pool == NULL || _in == NULL)
+    {
+      return -EINVAL;
+    }
+
+  return audiolite_component::on_starting(inode, onode);
+}
+
+void audiolite_mixer::on_started(audiolite_inputnode *inode,
+                                 audiolite_outputnode *onode)
+{
+  mossfw_lock_take(&_lock);
+  release_all();
+  _running = true;
+  mossfw_lock_give(&_lock);
+
+  audiolite_component::on_started(inode, onode);
+}
+
+void audiolite_mixer::on_stop(audiolite_inputnode *inode,
+                              audiolite_outputnode *onode)
+{
+  mossfw_lock_take(&_lock);
+  _running = false;
+  release_all();
+  mossfw_lock_give(&_lock);
+
+  audiolite_component::on_stop(inode, onode);
+}
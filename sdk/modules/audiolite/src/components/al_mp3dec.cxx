@@ -69,7 +69,7 @@ void audiolite_mp3dec::decode_runner()
   while (_is_thrdrun &&
         (_omempool == NULL || _stream == NULL || !_isplay))
     {
-      usleep(10 * 1000);
+      wait_runner();
     }
 
   while (_is_thrdrun)
@@ -90,16 +90,16 @@ void audiolite_mp3dec::decode_runner()
             }
           else
             {
-              /* Yeild */
+              /* Pool is disabled. Sleep until it is enabled again. */
 
-              usleep(10 * 1000);
+              wait_runner();
             }
         }
       else
         {
-          /* Yeild */
+          /* Sleep until the worker is booted or stopped */
 
-          usleep(10 * 1000);
+          wait_runner();
         }
     }
 }
@@ -122,6 +122,9 @@ int audiolite_mp3dec::handle_mesage(al_comm_msghdr_t hdr,
       mem = thiz->_inq.pop();
       if (mem)
         {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+          thiz->_inq.record_roundtrip(mem);
+#endif
           if (thiz->_frame_eof || thiz->_worker_booted != true)
             {
               mem->release();
@@ -150,6 +153,9 @@ int audiolite_mp3dec::handle_mesage(al_comm_msghdr_t hdr,
       mem = thiz->_outq.pop();
       if (mem)
         {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+          thiz->_outq.record_roundtrip(mem);
+#endif
           if (thiz->_worker_booted)
             {
               mem->set_storedsize(opt->size);
@@ -160,6 +166,7 @@ int audiolite_mp3dec::handle_mesage(al_comm_msghdr_t hdr,
                 }
 
               thiz->_outs[0]->push_data(mem);
+              thiz->_omempool->latency_stop();
             }
           mem->release();
         }
@@ -235,6 +242,7 @@ int audiolite_mp3dec::handle_mesage(al_comm_msghdr_t hdr,
       alworker_send_startframe(thiz->_worker.getwtask());
       alworker_send_start(thiz->_worker.getwtask());
       thiz->_worker_booted = true; /* This makes start injection of omem */
+      thiz->notify_runner();
     }
   else if (CHECK_HDR(hdr, SYS, SYS_ERR))
     {
@@ -269,6 +277,11 @@ audiolite_mp3dec::audiolite_mp3dec() : audiolite_decoder("mp3decomem",
 
 audiolite_mp3dec::~audiolite_mp3dec()
 {
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  /* Leave the list before the queues are destroyed */
+
+  audiolite_profile_unregister(this);
+#endif
   stop_decode();
 }
 
@@ -320,3 +333,17 @@ int audiolite_mp3dec::stop_decode()
 
   return OK;
 }
+
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+void audiolite_mp3dec::get_subprofile(struct al_profile_s *prof)
+{
+  _inq.get_profile(&prof->wk_in);
+  _outq.get_profile(&prof->wk_out);
+}
+
+void audiolite_mp3dec::reset_subprofile()
+{
+  _inq.reset_profile();
+  _outq.reset_profile();
+}
+#endif
@@ -0,0 +1,146 @@
+/****************************************************************************
+ * modules/audiolite/src/components/al_resampler.cxx
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <audiolite/al_debug.h>
+#include <audiolite/al_resampler.h>
+#include <audiolite/al_eventlistener.h>
+
+/****************************************************************************
+ * Class: audiolite_resampler
+ ****************************************************************************/
+
+audiolite_resampler::audiolite_resampler() :
+  audiolite_workercomp("resampler", AL_RESAMPLER_IMEM_QSIZE,
+                       AL_RESAMPLER_OMEM_QSIZE),
+  _inhz(0), _quality(AL_RESAMPLER_QUALITY_MEDIUM), _actual_quality(-1),
+  _play_sent(false)
+{
+  set_msglistener(&_msglsnr);
+}
+
+audiolite_resampler::~audiolite_resampler()
+{
+}
+
+int audiolite_resampler::on_starting(audiolite_inputnode *inode,
+                                     audiolite_outputnode *onode)
+{
+  _play_sent = false;
+  _actual_quality = -1;
+
+  return audiolite_workercomp::on_starting(inode, onode);
+}
+
+void audiolite_resampler::on_data()
+{
+  int hz;
+  al_comm_msgopt_t opt;
+  audiolite_memapbuf *mem = (audiolite_memapbuf *)pop_data();
+
+  if (mem)
+    {
+      if (_worker_booted == true)
+        {
+          /* Input rate is fixed by the first data,
+           * because the previous component may know it after its start.
+           */
+
+          if (!_play_sent)
+            {
+              hz = _inhz ? _inhz : mem->get_fs();
+              if (hz <= 0)
+                {
+                  hz = samplingrate();
+                }
+
+              opt.usr[AL_RESAMPLER_OPT_INHZ] = hz;
+              opt.usr[AL_RESAMPLER_OPT_QUALITY] = _quality;
+              alworker_send_start(_worker.getwtask(), &opt);
+              _play_sent = true;
+            }
+
+          _inq.push(mem);
+          alworker_inject_imem(_worker.getwtask(), mem);
+        }
+      else
+        {
+          mem->release();
+        }
+    }
+}
+
+/****************************************************************************
+ * Message Listener Class Methods
+ ****************************************************************************/
+
+void audiolite_resampler::resampler_msglistener::bootup(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask, int version, void *d)
+{
+  if (version == AL_RESAMPLER_WORKER_VERSION)
+    {
+      /* Start message is sent when the first data comes */
+
+      alworker_send_systemparam(wtask, wcomp->channels(),
+                                       wcomp->samplingrate(),
+                                       wcomp->samplebitwidth());
+    }
+  else
+    {
+      wcomp->publish_event(AL_EVENT_WRONGVERSION, version);
+    }
+}
+
+void audiolite_resampler::resampler_msglistener::error(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask, int id, int ercode)
+{
+  al_derror("Resampler worker error : %d\n", ercode);
+  wcomp->publish_event(AL_EVENT_UNSUPPORTFMT, ercode);
+}
+
+void audiolite_resampler::resampler_msglistener::info(
+     audiolite_workercomp *wcomp, al_wtask_t *wtask,
+     int id, int chs, int fs, int layer, int rate)
+{
+  /* layer is the quality level, and rate is the input rate */
+
+  al_dinfo("Resampler %d -> %d, quality %d\n", rate, fs, layer);
+  ((audiolite_resampler *)wcomp)->_actual_quality = layer;
+}
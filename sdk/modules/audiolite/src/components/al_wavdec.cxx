@@ -48,48 +48,105 @@
  * Private Functions
  ****************************************************************************/
 
-static int check_wavheader(al_wavhdr *hdr, int ch, int hz, int bits)
+static bool is_supported_rate(int hz)
+{
+  /* Rates other than the system rate can be played through
+   * audiolite_resampler.
+   */
+
+  switch (hz)
+    {
+      case 8000:
+      case 11025:
+      case 12000:
+      case 16000:
+      case 22050:
+      case 24000:
+      case 32000:
+      case 44100:
+      case 48000:
+      case 88200:
+      case 96000:
+      case 176400:
+      case 192000:
+        return true;
+      default:
+        return false;
+    }
+}
+
+static int check_wavformat(int fmt, int ch, int hz, int bits, int blksz)
 {
   int ret = 0;
 
-  if ((strncmp((const char *)&hdr->riff_chunk_id[0], RIFF_ID, 4)))
+  if (fmt == FMT_WAV && !(bits == 8 || bits == 16 ||
+                          bits == 24 || bits == 32))
     {
-      ret = -1;
+      ret = -7;
     }
-  else if (strncmp((const char *)&hdr->riff_form_type[0], RIFF_FMT, 4))
+  else if (fmt == FMT_FLOAT && bits != 32)
     {
-      ret = -2;
+      ret = -7;
     }
-  else if (strncmp((const char *)&hdr->fmt_chunk_id[0], FMTCNK_ID, 4))
+  else if (fmt != FMT_WAV && fmt != FMT_FLOAT)
     {
-      ret = -3;
+      ret = -6;
     }
-  else if (strncmp((const char *)&hdr->data_chunk_id[0], DATACNK_ID, 4))
+  else if (!is_supported_rate(hz))
     {
-      ret = -4;
+      ret = -8;
     }
-  else if (hdr->fmt_chunk_size != FMTCNK_SZ)
+  else if (!(ch == 1 || ch == 2 || ch == 4 || ch == 8))
     {
-      ret = -5;
+      ret = -9;
     }
-  else if (hdr->fmt_wave_format_type != FMT_WAV)
+  else if (blksz != ch * bits / 8)
     {
-      ret = -6;
+      ret = -5;
     }
-  else if (bits != 16)
+
+  return ret;
+}
+
+/* Convert samples to 16bit PCM in place.
+ * Output is always smaller than input, except for 8bit samples. For them,
+ * input is placed on the latter half of the buffer by the caller.
+ */
+
+static void conv_u8topcm16(int16_t *dst, const uint8_t *src, int n)
+{
+  for (int i = 0; i < n; i++)
     {
-      ret = -7;
+      dst[i] = (int16_t)(((int)src[i] - 128) << 8);
     }
-  else if (!(hz == 48000 || hz == 44100 || hz == 96000 || hz == 192000))
+}
+
+static void conv_pcm24topcm16(int16_t *dst, const uint8_t *src, int n)
+{
+  for (int i = 0; i < n; i++, src += 3)
     {
-      ret = -8;
+      dst[i] = (int16_t)(src[1] | (src[2] << 8));
     }
-  else if (!(ch == 1 || ch == 2 || ch == 4 || ch == 8))
+}
+
+static void conv_pcm32topcm16(int16_t *dst, const uint8_t *src, int n)
+{
+  for (int i = 0; i < n; i++, src += 4)
     {
-      ret = -9;
+      dst[i] = (int16_t)(src[2] | (src[3] << 8));
     }
+}
 
-  return ret;
+static void conv_floattopcm16(int16_t *dst, const float *src, int n)
+{
+  float v;
+
+  for (int i = 0; i < n; i++)
+    {
+      v = src[i] * 32768.f;
+      v = (v > 32767.f) ? 32767.f : (v < -32768.f) ? -32768.f : v;
+      dst[i] = (int16_t)v;
+    }
 }
 
 /****************************************************************************
@@ -101,7 +158,7 @@ int audiolite_wavdec::start_decode()
   if (_stream)
     {
       _eof = false;
-      ((audiolite_filestream *)_stream)->seek(0);
+      _stream->seek(0);
       return parse_wavhdr();
     }
   else
@@ -110,37 +167,180 @@ int audiolite_wavdec::start_decode()
     }
 }
 
+int audiolite_wavdec::parse_fmtchunk(uint32_t size)
+{
+  struct al_wavfmt fmt;
+  int rdsz = size < sizeof(fmt) ? size : sizeof(fmt);
+  int skip = size - rdsz + (size & 1);
+
+  memset(&fmt, 0, sizeof(fmt));
+  if (size < FMTCNK_SZ || _stream->read_data(&fmt, rdsz, -1) != rdsz)
+    {
+      return -5;
+    }
+
+  if (skip > 0 && _stream->seekcur(skip) != 0)
+    {
+      return -5;
+    }
+
+  _fmttype = fmt.wave_format_type;
+  if (_fmttype == FMT_EXTENSIBLE)
+    {
+      if (size < FMTCNK_EXTSZ)
+        {
+          return -5;
+        }
+
+      _fmttype = fmt.sub_format[0] | (fmt.sub_format[1] << 8);
+    }
+
+  _chnum = fmt.channel;
+  _samplerate = fmt.samples_per_sec;
+  _bitlen = fmt.bits_per_sample;
+  _blksize = fmt.block_size;
+
+  return check_wavformat(_fmttype, _chnum, _samplerate, _bitlen, _blksize);
+}
+
 int audiolite_wavdec::parse_wavhdr()
 {
   int ret = -EINVAL;
+  bool has_fmt = false;
+  uint8_t riff[RIFF_HDRSZ];
+  struct al_chunkhdr chunk;
 
-  al_wavhdr hdr;
+  if (_stream->read_data(riff, RIFF_HDRSZ, -1) != RIFF_HDRSZ)
+    {
+      return -EINVAL;
+    }
 
-  ret = _stream->read_data(&hdr, sizeof(al_wavhdr), -1);
-  if (ret == sizeof(al_wavhdr))
+  if (strncmp((const char *)&riff[0], RIFF_ID, 4))
+    {
+      ret = -1;
+    }
+  else if (strncmp((const char *)&riff[8], RIFF_FMT, 4))
+    {
+      ret = -2;
+    }
+  else
     {
-      _chnum = hdr.fmt_channel;
-      _samplerate = hdr.fmt_samples_per_sec;
-      _bitlen = hdr.fmt_bits_per_sample;
+      /* Walk through chunks until "data" chunk.
+       * Unknown chunks like "LIST" or "fact" are skipped.
+       */
 
-      ret = check_wavheader(&hdr, _chnum, _samplerate, _bitlen);
-      if (ret != 0)
+      while (true)
         {
-          /* Invalid format */
+          if (_stream->read_data(&chunk, CHUNK_HDRSZ, -1) != CHUNK_HDRSZ)
+            {
+              ret = has_fmt ? -4 : -3;
+              break;
+            }
 
-          publish_event(AL_EVENT_ILLIGALSTREAM, (unsigned long)ret);
+          if (!strncmp((const char *)chunk.chunk_id, FMTCNK_ID, 4))
+            {
+              ret = parse_fmtchunk(chunk.chunk_size);
+              if (ret != 0)
+                {
+                  break;
+                }
+
+              has_fmt = true;
+            }
+          else if (!strncmp((const char *)chunk.chunk_id, DATACNK_ID, 4))
+            {
+              ret = has_fmt ? 0 : -3;
+
+              /* Size 0 or 0xffffffff is used by a writer which could
+               * not update the header. Play until the end of file.
+               */
+
+              _data_remain = (chunk.chunk_size == 0) ?
+                             UINT32_MAX : chunk.chunk_size;
+              break;
+            }
+          else if (_stream->seekcur(chunk.chunk_size +
+                                    (chunk.chunk_size & 1)) != 0)
+            {
+              ret = has_fmt ? -4 : -3;
+              break;
+            }
         }
-      else
+    }
+
+  if (ret != 0)
+    {
+      /* Invalid format */
+
+      publish_event(AL_EVENT_ILLIGALSTREAM, (unsigned long)ret);
+    }
+
+  return ret;
+}
+
+int audiolite_wavdec::read_pcm16(audiolite_mem *mem)
+{
+  uint8_t *buf = (uint8_t *)mem->get_data();
+  int samplesz = _bitlen / 8;
+  int outblk = _chnum * sizeof(int16_t);
+  int frames = mem->get_fullsize() /
+               (_blksize > outblk ? _blksize : outblk);
+  int rdsz = frames * _blksize;
+  int ofst = (samplesz == 1) ? frames * _chnum : 0;
+  int ret = 0;
+  int n;
+
+  if ((uint32_t)rdsz > _data_remain)
+    {
+      rdsz = _data_remain - (_data_remain % _blksize);
+      if (rdsz == 0)
         {
-          ret = OK;
+          /* Only a fragment of a frame is left. Discard it. */
+
+          _data_remain = 0;
         }
     }
-  else
+
+  if (rdsz > 0)
     {
-      ret = -EINVAL;
+      ret = _stream->read_data(&buf[ofst], rdsz, -1);
+      ret = (ret < 0) ? 0 : ret;
     }
 
-  return ret;
+  if (_data_remain != UINT32_MAX)
+    {
+      _data_remain -= ret;
+    }
+
+  if (ret < rdsz || _data_remain == 0)
+    {
+      mem->set_eof();
+    }
+
+  /* Drop a fragment of a frame at the end of the file */
+
+  n = (ret - ret % _blksize) / samplesz;
+
+  if (_fmttype == FMT_FLOAT)
+    {
+      conv_floattopcm16((int16_t *)buf, (const float *)buf, n);
+    }
+  else if (samplesz == 1)
+    {
+      conv_u8topcm16((int16_t *)buf, &buf[ofst], n);
+    }
+  else if (samplesz == 3)
+    {
+      conv_pcm24topcm16((int16_t *)buf, buf, n);
+    }
+  else if (samplesz == 4)
+    {
+      conv_pcm32topcm16((int16_t *)buf, buf, n);
+    }
+
+  mem->set_storedsize(n * sizeof(int16_t));
+
+  return n * sizeof(int16_t);
 }
 
 void audiolite_wavdec::decode_runner()
@@ -153,7 +353,7 @@ void audiolite_wavdec::decode_runner()
   while (_is_thrdrun &&
          (_pool == NULL || _stream == NULL || !_isplay))
     {
-      usleep(10 * 1000);
+      wait_runner();
     }
 
   /* Main Loop */
@@ -165,10 +365,12 @@ void audiolite_wavdec::decode_runner()
           audiolite_mem *mem = _pool->allocate();
           if (mem)
             {
-              _stream->receive_data(mem, 0, -1);
+              read_pcm16(mem);
+              mem->set_fs(_samplerate);
               if (!_eof)
                 {
                   _outs[0]->push_data(mem);
+                  _pool->latency_stop();
                 }
 
               eof = mem->is_eof();
@@ -183,9 +385,9 @@ void audiolite_wavdec::decode_runner()
         }
       else
         {
-          /* Yeild */
+          /* Sleep until resumed or stopped */
 
-          usleep(10 * 1000);
+          wait_runner();
         }
     }
 }
@@ -0,0 +1,386 @@
+/****************************************************************************
+ * modules/audiolite/worker/aacdec/aacdec_main.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <alworker_commfw.h>
+#include <audiolite/alworker_aacdec.h>
+
+#include "aacdec.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Helix decoder allocates its instance by malloc() once in
+ * AACInitDecoder(). The worker has no heap, so it is served from
+ * a static area of this size.
+ */
+
+#define AACDEC_HEAPSZ     (32 * 1024)
+
+#define AACDEC_STAGESZ    (AL_AACDEC_MAXFRAMEBYTES * 2)
+
+#define ADTS_HDRSZ        (7)
+#define ADTS_IS_SYNC(h)   ((h)[0] == 0xff && ((h)[1] & 0xf6) == 0xf0)
+#define ADTS_FRAMELEN(h)  ((((int)(h)[3] & 0x03) << 11) | \
+                            ((int)(h)[4] << 3) | ((int)(h)[5] >> 5))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct aacdec_instance_s
+{
+  /* ALWORKERCOMMFW_INSTANCE should be on top of your instance */
+
+  ALWORKERCOMMFW_INSTANCE;
+
+  HAACDecoder dec;
+
+  /* ADTS frames are not aligned to input memory blocks.
+   * stage gathers the bytes until a whole frame is stored,
+   * and pcm holds decoded samples until output memory takes them.
+   */
+
+  memblk_t stage;
+  memblk_t pcm;
+
+  int chs;      /* Channels of output */
+  int ichs;     /* Channels of the stream */
+  int hz;
+  int eof;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct aacdec_instance_s g_instance;
+
+static uint32_t g_heap[AACDEC_HEAPSZ / sizeof(uint32_t)];
+static size_t g_heapused;
+
+static char g_stagebuf[AACDEC_STAGESZ];
+static int16_t g_pcmbuf[AL_AACDEC_FRAMESAMPLES * AL_AACDEC_MAXCHS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/*** name: frame_length */
+
+static int frame_length(struct aacdec_instance_s *inst)
+{
+  int ofst;
+  int len;
+  uint8_t *hdr;
+
+  while (memblk_remain(&inst->stage) >= ADTS_HDRSZ)
+    {
+      hdr = memblk_dataptruint8(&inst->stage);
+      len = ADTS_FRAMELEN(hdr);
+      if (ADTS_IS_SYNC(hdr) &&
+          len >= ADTS_HDRSZ && len <= AL_AACDEC_MAXFRAMEBYTES)
+        {
+          return len;
+        }
+
+      /* Lost sync. Skip to the next sync word. */
+
+      ofst = AACFindSyncWord(hdr + 1, memblk_remain(&inst->stage) - 1);
+      memblk_drop(&inst->stage,
+                  ofst < 0 ? memblk_remain(&inst->stage) - 1 : ofst + 1);
+    }
+
+  return -1;
+}
+
+/*** name: decode_frame */
+
+static void decode_frame(struct aacdec_instance_s *inst, int len)
+{
+  int err;
+  int left = len;
+  unsigned char *frm = memblk_dataptruint8(&inst->stage);
+  AACFrameInfo info;
+
+  err = AACDecode(inst->dec, &frm, &left, g_pcmbuf);
+  memblk_drop(&inst->stage, len);
+
+  if (err != ERR_AAC_NONE)
+    {
+      alworker_send_errormsg(0, AL_COMM_MSGCODEERR_ILLIGALFRAME);
+      return;
+    }
+
+  AACGetLastFrameInfo(inst->dec, &info);
+
+  if (info.nChans != inst->ichs || info.sampRateOut != inst->hz)
+    {
+      inst->ichs = info.nChans;
+      inst->hz = info.sampRateOut;
+      alworker_send_frameinfo(0, inst->chs, inst->hz,
+                              AL_AACDEC_PROFILE_LC, info.bitRate / 1000);
+    }
+
+  memblk_init(&inst->pcm, g_pcmbuf, sizeof(g_pcmbuf));
+  memblk_commitint16(&inst->pcm, info.outputSamps);
+}
+
+/*** name: deliver_pcm */
+
+static int deliver_pcm(struct aacdec_instance_s *inst)
+{
+  memblk_t *omem;
+
+  omem = PEEK_OMEM(inst);
+  if (omem == NULL)
+    {
+      return AL_COMMFW_RET_NOOMEM;
+    }
+
+  /* Fit channels of the stream to the system */
+
+  if (inst->ichs == 1 && inst->chs == 2)
+    {
+      memblk_duplicate16(omem, &inst->pcm);
+    }
+  else if (inst->ichs == 2 && inst->chs == 1)
+    {
+      memblk_single16(omem, &inst->pcm);
+    }
+  else if (inst->ichs == inst->chs)
+    {
+      memblk_fillup(omem, &inst->pcm);
+    }
+  else
+    {
+      /* No other channel mapping is supported. Drop the frame. */
+
+      alworker_send_errormsg(0, AL_COMM_MSGCODEERR_UNSUPFRAME);
+      memblk_reset(&inst->pcm);
+      return AL_COMMFW_RET_OK;
+    }
+
+  if (memblk_space(omem) < (int)sizeof(int16_t) * inst->chs)
+    {
+      TAKE_OMEM(inst);
+      FREE_MEMBLK(omem, inst);
+    }
+
+  return AL_COMMFW_RET_OK;
+}
+
+/*** name: gather_frame */
+
+static int gather_frame(struct aacdec_instance_s *inst)
+{
+  memblk_t *imem;
+
+  imem = PEEK_IMEM(inst);
+  if (imem == NULL)
+    {
+      return AL_COMMFW_RET_NOIMEM;
+    }
+
+  memblk_shift(&inst->stage);
+  memblk_fillup(&inst->stage, imem);
+
+  if (memblk_is_empty(imem))
+    {
+      TAKE_IMEM(inst);
+      inst->eof = memblk_is_eof(imem);
+      FREE_MEMBLK(imem, inst);
+    }
+
+  return AL_COMMFW_RET_OK;
+}
+
+/*** name: finish_stream */
+
+static int finish_stream(struct aacdec_instance_s *inst)
+{
+  memblk_t *omem;
+
+  /* Pass EOF to the next component with the last output block */
+
+  omem = TAKE_OMEM(inst);
+  if (omem == NULL)
+    {
+      return AL_COMMFW_RET_NOOMEM;
+    }
+
+  memblk_set_eof(omem);
+  FREE_MEMBLK(omem, inst);
+
+  memblk_reset(&inst->stage);
+  inst->eof = 0;
+  alworker_send_framedone(0);
+
+  return AL_COMMFW_RET_OK;
+}
+
+/*** name: on_process */
+
+static int on_process(void *arg)
+{
+  int len;
+  struct aacdec_instance_s *inst = (struct aacdec_instance_s *)arg;
+
+  /* Deliver decoded samples before decoding next frame */
+
+  if (memblk_remain(&inst->pcm) > 0)
+    {
+      return deliver_pcm(inst);
+    }
+
+  len = frame_length(inst);
+  if (len > 0 && memblk_remain(&inst->stage) >= len)
+    {
+      decode_frame(inst, len);
+      return AL_COMMFW_RET_OK;
+    }
+
+  /* A fragment of a frame at the end of stream is dropped */
+
+  if (inst->eof)
+    {
+      return finish_stream(inst);
+    }
+
+  return gather_frame(inst);
+}
+
+/*** name: on_parammsg */
+
+static int on_parammsg(int state, void *arg,
+                       al_comm_msghdr_t hdr, al_comm_msgopt_t *opt)
+{
+  struct aacdec_instance_s *inst = (struct aacdec_instance_s *)arg;
+
+  if (opt->chs <= 0 || opt->chs > AL_AACDEC_MAXCHS)
+    {
+      return AL_COMM_MSGCODEERR_UNSUPFRAME;
+    }
+
+  inst->chs = opt->chs;
+
+  return AL_COMM_MSGCODEERR_OK;
+}
+
+/*** name: on_playmsg */
+
+static int on_playmsg(int state, void *arg, al_comm_msgopt_t *opt)
+{
+  struct aacdec_instance_s *inst = (struct aacdec_instance_s *)arg;
+
+  if (inst->dec == NULL || inst->chs <= 0)
+    {
+      alworker_send_errormsg(0, AL_COMM_MSGCODEERR_UNSUPFRAME);
+      return AL_COMM_MSGCODEERR_UNSUPFRAME;
+    }
+
+  AACFlushCodec(inst->dec);
+
+  memblk_init(&inst->stage, g_stagebuf, sizeof(g_stagebuf));
+  memblk_init(&inst->pcm, g_pcmbuf, sizeof(g_pcmbuf));
+  inst->ichs = 0;
+  inst->hz = 0;
+  inst->eof = 0;
+
+  return AL_COMM_MSGCODEERR_OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/*** name: malloc */
+
+void *malloc(size_t sz)
+{
+  void *ret = NULL;
+
+  sz = (sz + 7) & ~7;
+  if (g_heapused + sz <= sizeof(g_heap))
+    {
+      ret = (char *)g_heap + g_heapused;
+      g_heapused += sz;
+    }
+
+  return ret;
+}
+
+/*** name: free */
+
+void free(void *ptr)
+{
+  /* The decoder instance lives until the worker terminates */
+}
+
+/*** name: main */
+
+int main(void)
+{
+  alcommfw_cbs_t *cbs = alworker_commfw_get_cbtable();
+
+  if (alworker_commfw_initialize((alworker_insthead_t *)&g_instance) != OK)
+    {
+      return 0;
+    }
+
+  g_instance.chs = 0;
+
+  /* NULL is checked on start to report the error to the host */
+
+  g_instance.dec = AACInitDecoder();
+
+  SET_PROCESS(cbs, on_process);
+  SET_PARAMMSG(cbs, on_parammsg);
+  SET_PLAYMSG(cbs, on_playmsg);
+
+  alworker_send_bootmsg(AL_AACDEC_WORKER_VERSION, NULL);
+
+  alworker_commfw_msgloop((alworker_insthead_t *)&g_instance);
+
+  return 0;
+}
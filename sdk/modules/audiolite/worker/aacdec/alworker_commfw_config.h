@@ -0,0 +1,36 @@
+#ifndef __AUDIOLITE_WORKER_COMMON_ALWORKER_COMMFW_CONFIG_H
+#define __AUDIOLITE_WORKER_COMMON_ALWORKER_COMMFW_CONFIG_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <audiolite/alworker_aacdec.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/** Definition of NOTUSE_XXXXXX
+ *
+ * If you want to handle messages below,
+ * comment out to enable it.
+ */
+
+#define NOTUSE_STARTING
+#define NOTUSE_STOPPING
+#define NOTUSE_SYSPAUSE
+#define NOTUSE_INSTGAIN
+#define NOTUSE_ORGMSG
+#define NOTUSE_SYSDBG
+
+/** Definition of Memory block QUEUE size
+ *
+ * Input side memory block size will defined as CONF_WORKER_IMEMMAX.
+ * Output side memory block size will defined as CONF_WORKER_OMEMMAX.
+ */
+
+#define CONF_WORKER_IMEMMAX AL_AACDEC_IMEM_QSIZE
+#define CONF_WORKER_OMEMMAX AL_AACDEC_OMEM_QSIZE
+
+#endif /* __AUDIOLITE_WORKER_COMMON_ALWORKER_COMMFW_CONFIG_H */
@@ -38,9 +38,14 @@
  ****************************************************************************/
 
 #include <string.h>
+#include <stdint.h>
 #include <asmp/stdio.h>
 #include "alworker_memblk.h"
 
+#ifdef USE_CMSIS
+#include <arm_math.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -49,6 +54,24 @@
 #  define MIN(a,b)  ((a) > (b) ? (b) : (a))
 #endif
 
+/* 2 x 16bit packing and saturation.
+ * With CMSIS, they are single PKHBT/PKHTB/SSAT instructions of Cortex-M4.
+ *
+ *   PACK_LO16(a, b) : b[15:0]  << 16 | a[15:0]
+ *   PACK_HI16(a, b) : a[31:16] << 16 | b[31:16]
+ */
+
+#ifdef USE_CMSIS
+#  define PACK_LO16(a, b)  __PKHBT(a, b, 16)
+#  define PACK_HI16(a, b)  __PKHTB(a, b, 16)
+#  define SAT16(v)         __SSAT(v, 16)
+#else
+#  define PACK_LO16(a, b)  (((uint32_t)(a) & 0xffff) | ((uint32_t)(b) << 16))
+#  define PACK_HI16(a, b)  (((uint32_t)(a) & 0xffff0000) | \
+                            ((uint32_t)(b) >> 16))
+#  define SAT16(v)  ((v) > 32767 ? 32767 : (v) < -32768 ? -32768 : (v))
+#endif
+
 #define TEMPLATE_PUSH_POP(name, type) \
   type memblk_pop_##name(memblk_t *mb) \
     { \
@@ -61,6 +84,37 @@
       memblk_fillupraw(mb, (char *)&val, sizeof(type)); \
     }
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Access 2 samples at once. memblk data is only 2 bytes aligned,
+ * and Cortex-M4 allows unaligned LDR/STR.
+ */
+
+static inline uint32_t read16x2(short **p)
+{
+  uint32_t val;
+
+  memcpy(&val, *p, sizeof(val));
+  *p += 2;
+
+  return val;
+}
+
+static inline void write16x2(short **p, uint32_t val)
+{
+  memcpy(*p, &val, sizeof(val));
+  *p += 2;
+}
+
+static inline short float2pcm16(float v)
+{
+  int32_t i = (int32_t)v;  /* VCVT saturates to int32 range on Cortex-M4 */
+
+  return (short)SAT16(i);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -264,13 +318,23 @@ int  memblk_split_lr16(memblk_t *lch, memblk_t *rch, memblk_t *src)
   short *lchadr = (short *)memblk_fillptr(lch);
   short *rchadr = (short *)memblk_fillptr(rch);
   short *srcadr = (short *)memblk_dataptr(src);
+  uint32_t lr0;
+  uint32_t lr1;
 
   ALWORKER_DBGASSERT(memblk_space(rch) == memblk_space(lch));
 
   split_samples = MIN(memblk_remain(src) / 2, memblk_space(lch));
   split_samples /= sizeof(short);
 
-  for (i = 0; i < split_samples; i++)
+  for (i = 0; i < split_samples / 2; i++)
+    {
+      lr0 = read16x2(&srcadr);
+      lr1 = read16x2(&srcadr);
+      write16x2(&lchadr, PACK_LO16(lr0, lr1));
+      write16x2(&rchadr, PACK_HI16(lr1, lr0));
+    }
+
+  if (split_samples & 1)
     {
       *lchadr++ = *srcadr++;
       *rchadr++ = *srcadr++;
@@ -308,16 +372,30 @@ int  memblk_conbine_lr16(memblk_t *dst, memblk_t *lch, memblk_t *rch)
   short *dstadr = (short *)memblk_fillptr(dst);
   short *lchadr = (short *)memblk_dataptr(lch);
   short *rchadr = (short *)memblk_dataptr(rch);
+  uint32_t l;
+  uint32_t r;
 
   samples = MIN(memblk_remain(lch), memblk_remain(rch));
   samples = MIN(memblk_space(dst) / 2, samples);
 
   samples = samples / sizeof(short);
 
-  for (i = 0; i < samples; i++)
+  /* Read both channels before writing, because memblk_conbine_lr16acc()
+   * places dst over the rch plane.
+   */
+
+  for (i = 0; i < samples / 2; i++)
     {
-      dstadr[i * 2 + 1] = *rchadr++; /* Odd is copied first */
-      dstadr[i * 2 + 0] = *lchadr++;
+      l = read16x2(&lchadr);
+      r = read16x2(&rchadr);
+      write16x2(&dstadr, PACK_LO16(l, r));
+      write16x2(&dstadr, PACK_HI16(r, l));
+    }
+
+  if (samples & 1)
+    {
+      dstadr[1] = *rchadr++; /* Odd is copied first */
+      dstadr[0] = *lchadr++;
     }
 
   samples *= sizeof(short);
@@ -407,10 +485,18 @@ int memblk_conv_pcm16tofloat(memblk_t *flt, memblk_t *pcm16)
   int samp_num = memblk_remain(pcm16) / sizeof(short);
   float *fdat = (float *)memblk_fillptr(flt);
   short *pcm  = (short *)memblk_dataptr(pcm16);
+  uint32_t val;
 
   samp_num = (samp_num > fltspace) ? fltspace : samp_num;
 
-  for (i = 0; i < samp_num; i++)
+  for (i = 0; i < samp_num / 2; i++)
+    {
+      val = read16x2(&pcm);
+      *fdat++ = (float)(short)(val & 0xffff);
+      *fdat++ = (float)(short)(val >> 16);
+    }
+
+  if (samp_num & 1)
     {
       *fdat++ = (float)*pcm++;
     }
@@ -428,14 +514,22 @@ int memblk_conv_floattopcm16(memblk_t *pcm16, memblk_t *flt, float gain)
   int samp_num = memblk_space(pcm16) / sizeof(short);
   float *fdat = (float *)memblk_dataptr(flt);
   short *pcm  = (short *)memblk_fillptr(pcm16);
+  short a;
+  short b;
 
   samp_num = (samp_num > fltspace) ? fltspace : samp_num;
 
-  for (i = 0; i < samp_num; i++)
+  for (i = 0; i < samp_num / 2; i++)
     {
-      /* TODO: Use CMSIS for the gain */
+      a = float2pcm16(fdat[0] * gain);
+      b = float2pcm16(fdat[1] * gain);
+      write16x2(&pcm, PACK_LO16(a, b));
+      fdat += 2;
+    }
 
-      *pcm++ = gain * (short)*fdat++;
+  if (samp_num & 1)
+    {
+      *pcm++ = float2pcm16(*fdat++ * gain);
     }
 
   memblk_updateused(flt, sizeof(float) * samp_num);
@@ -450,22 +544,125 @@ int memblk_normalizef(memblk_t *flt, float min, float max)
   int remain = memblk_remain(flt) / sizeof(float);
   float *dat = (float *)memblk_dataptr(flt);
   float div = max - min;
+  float v;
 
   if (div <= 0.f)
     {
       return -1;
     }
 
+  /* Multiply by reciprocal. FPU division takes 14 cycles per sample */
+
+  div = 1.f / div;
+
   for (i = 0; i < remain; i++, dat++)
     {
-      *dat = (*dat - min) / div;
-      if (*dat < -1) *dat = -1;
-      else if (*dat >  1) *dat =  1;
+      v = (*dat - min) * div;
+      *dat = (v < -1.f) ? -1.f : (v > 1.f) ? 1.f : v;
     }
 
   return remain;
 }
 
+/* memblk_ring_drop
+ *
+ * Drop data from a ring memblk. The read offset goes back to the top of
+ * the memory when it reaches the end, instead of moving the data.
+ *
+ *    filled     used
+ *       v        v
+ * +--------------------------+
+ * |3412          12341234123 |
+ * +--------------------------+
+ */
+
+void memblk_ring_drop(memblk_t *ring, int sz)
+{
+  sz = MIN(sz, memblk_remain(ring));
+
+  ring->used += sz;
+  if (ring->used >= ring->size)
+    {
+      ring->used   -= ring->size;
+      ring->filled -= ring->size;
+    }
+}
+
+/* memblk_ring_dataview
+ *
+ * Set up view as a linear memblk on the contiguous stored data of ring.
+ * After consuming data of the view, call memblk_ring_drop() with
+ * view->used.
+ */
+
+int memblk_ring_dataview(memblk_t *ring, memblk_t *view)
+{
+  int span = memblk_ring_dataspan(ring);
+
+  memblk_init(view, memblk_ring_dataptr(ring), span);
+  memblk_setfilled(view, span);
+
+  return span;
+}
+
+/* memblk_ring_fillview
+ *
+ * Set up view as a linear memblk on the contiguous space of ring.
+ * After storing data in the view, call memblk_ring_commit() with
+ * view->filled.
+ */
+
+int memblk_ring_fillview(memblk_t *ring, memblk_t *view)
+{
+  int span = memblk_ring_fillspan(ring);
+
+  memblk_init(view, memblk_ring_fillptr(ring), span);
+
+  return span;
+}
+
+/* memblk_ring_fillup
+ *
+ * Copy remaining data in src (linear) to the space of ring.
+ */
+
+int memblk_ring_fillup(memblk_t *ring, memblk_t *src)
+{
+  int total = 0;
+  memblk_t view;
+
+  while (!memblk_is_empty(src) && memblk_ring_fillview(ring, &view) > 0)
+    {
+      total += memblk_fillup(&view, src);
+      memblk_ring_commit(ring, view.filled);
+    }
+
+  return total;
+}
+
+/* memblk_ring_fillupraw
+ *
+ * Copy data stored in src to the space of ring.
+ */
+
+int memblk_ring_fillupraw(memblk_t *ring, char *src, int sz)
+{
+  int cpysize;
+  int total = 0;
+  memblk_t view;
+
+  while (sz > 0 && memblk_ring_fillview(ring, &view) > 0)
+    {
+      cpysize = memblk_fillupraw(&view, src, sz);
+      memblk_ring_commit(ring, cpysize);
+      src   += cpysize;
+      sz    -= cpysize;
+      total += cpysize;
+    }
+
+  return total;
+}
+
 TEMPLATE_PUSH_POP(float, float)
 TEMPLATE_PUSH_POP(uint8, uint8_t)
 TEMPLATE_PUSH_POP(int16, int16_t)
@@ -132,6 +132,37 @@
 #define memblk_dropfloat(mb, sz)    (memblk_updateused(mb, (sz) * 4))
 #define memblk_dropuint8(mb, sz)    (memblk_updateused(mb, sz))
 
+/* Ring mode
+ *
+ * A memblk handled by memblk_ring_* is used as a circular buffer.
+ * used is the read offset (0 to size-1), and filled is used + stored bytes,
+ * so memblk_remain(), memblk_dataptr() and memblk_is_empty() are also
+ * valid for it. Stored data can be wrapped around the end of the memory.
+ * To pass a part of it to functions for linear memblk,
+ * get a linear view of contiguous span by memblk_ring_dataview() or
+ * memblk_ring_fillview(), and reflect the result of the view by
+ * memblk_ring_drop() or memblk_ring_commit().
+ */
+
+#define memblk_ring_fillofst(mb)    ((mb)->filled >= (mb)->size ? \
+                                     (mb)->filled - (mb)->size :  \
+                                     (mb)->filled)
+#define memblk_ring_fillptr(mb)     (&(mb)->addr[memblk_ring_fillofst(mb)])
+#define memblk_ring_dataptr(mb)     memblk_dataptr(mb)
+#define memblk_ring_remain(mb)      memblk_remain(mb)
+#define memblk_ring_space(mb)       ((mb)->size - memblk_remain(mb))
+#define memblk_ring_is_full(mb)     (memblk_remain(mb) == (mb)->size)
+#define memblk_ring_commit(mb, sz)  (memblk_updatefilled(mb, sz))
+
+/* Contiguous bytes from memblk_ring_dataptr() and memblk_ring_fillptr() */
+
+#define memblk_ring_dataspan(mb)    MEMBLK_MIN(memblk_remain(mb), \
+                                               (mb)->size - (mb)->used)
+#define memblk_ring_fillspan(mb)    MEMBLK_MIN(memblk_ring_space(mb), \
+                                     (mb)->size - memblk_ring_fillofst(mb))
+
+#define MEMBLK_MIN(a, b)            ((a) > (b) ? (b) : (a))
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -169,6 +200,12 @@ int memblk_conv_pcm16tofloat(memblk_t *flt, memblk_t *pcm16);
 int memblk_conv_floattopcm16(memblk_t *pcm16, memblk_t *flt, float gain);
 int memblk_normalizef(memblk_t *flt, float min, float max);
 
+void memblk_ring_drop(memblk_t *ring, int sz);
+int  memblk_ring_dataview(memblk_t *ring, memblk_t *view);
+int  memblk_ring_fillview(memblk_t *ring, memblk_t *view);
+int  memblk_ring_fillup(memblk_t *ring, memblk_t *src);
+int  memblk_ring_fillupraw(memblk_t *ring, char *src, int sz);
+
 float   memblk_pop_float(memblk_t *mb);
 void    memblk_push_float(memblk_t *mb, float val);
 int16_t memblk_pop_int16(memblk_t *mb);
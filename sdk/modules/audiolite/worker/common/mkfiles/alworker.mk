@@ -31,6 +31,14 @@ ifeq ($(ALWORKER_USE_RESAMPLER),1)
 include $(ALWORKER_COMMONMKS)/resampler.mk
 endif
 
+ifeq ($(ALWORKER_USE_OPUS),1)
+include $(ALWORKER_COMMONMKS)/opus.mk
+endif
+
+ifeq ($(ALWORKER_USE_HELIXAAC),1)
+include $(ALWORKER_COMMONMKS)/helixaac.mk
+endif
+
 AUDIOLITE_DIR = $(ALWORKER_COMMON)/../..
 
 CFLAGS += -DBUILD_TGT_ASMPWORKER
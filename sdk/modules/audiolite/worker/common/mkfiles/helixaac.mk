@@ -0,0 +1,18 @@
+# Helix AAC decoder is not included in this SDK.
+# Set the path of its source tree to CONFIG_AUDIO_LITE_AACDEC_HELIX_DIR.
+
+HELIX_DIR = $(patsubst "%",%,$(CONFIG_AUDIO_LITE_AACDEC_HELIX_DIR))
+
+ifeq ($(HELIX_DIR),)
+$(error aacdec uses Helix AAC decoder,
+        you must set CONFIG_AUDIO_LITE_AACDEC_HELIX_DIR.)
+endif
+
+# Only AAC-LC is supported, so SBR sources are not built.
+
+HELIX_SRCS = $(notdir $(wildcard $(HELIX_DIR)/*.c $(HELIX_DIR)/real/*.c))
+
+CSRCS += $(filter-out sbr%.c,$(HELIX_SRCS))
+VPATH_DIRS += $(HELIX_DIR) $(HELIX_DIR)/real
+INCDIRS += $(HELIX_DIR) $(HELIX_DIR)/pub $(HELIX_DIR)/real
+CFLAGS += -DUSE_DEFAULT_STDLIB
@@ -0,0 +1,34 @@
+# libopus is not included in this SDK. It is downloaded on the first build.
+
+OPUS_VERSION = 1.3.1
+OPUS_EXTDIR  = $(ALWORKER_COMMON)/../ext_libs
+OPUS_DIR     = $(OPUS_EXTDIR)/opus-$(OPUS_VERSION)
+OPUS_URL     = https://downloads.xiph.org/releases/opus/opus-$(OPUS_VERSION).tar.gz
+OPUS_DL_NAME = $(OPUS_EXTDIR)/opus-$(OPUS_VERSION).tar.gz
+OPUS_MKFILES = $(addprefix $(OPUS_DIR)/,opus_sources.mk celt_sources.mk silk_sources.mk)
+
+WGET ?= wget
+
+$(OPUS_DIR):
+	$(Q) echo "Downloading: $(OPUS_URL)"
+	$(Q) $(WGET) -O $(OPUS_DL_NAME) $(OPUS_URL)
+	$(Q) tar xzf $(OPUS_DL_NAME) -C $(OPUS_EXTDIR)
+
+$(OPUS_MKFILES): | $(OPUS_DIR)
+
+include $(OPUS_MKFILES)
+
+# Decoder only uses fixed point code. Unused encoder code is removed
+# by --gc-sections on linking.
+
+CSRCS += $(notdir $(CELT_SOURCES) $(SILK_SOURCES) $(SILK_SOURCES_FIXED))
+CSRCS += $(notdir $(OPUS_SOURCES))
+VPATH_DIRS += $(OPUS_DIR)/src $(OPUS_DIR)/celt
+VPATH_DIRS += $(OPUS_DIR)/silk $(OPUS_DIR)/silk/fixed
+INCDIRS += $(OPUS_DIR)/include $(OPUS_DIR)/celt
+INCDIRS += $(OPUS_DIR)/silk $(OPUS_DIR)/silk/fixed
+CFLAGS += -DOPUS_BUILD -DFIXED_POINT -DDISABLE_FLOAT_API -DVAR_ARRAYS
+
+distclean::
+	$(call DELFILE, $(OPUS_DL_NAME))
+	$(call DELDIR, $(OPUS_DIR))
@@ -6,6 +6,6 @@ endif
 SPEEXDSP_DIR = $(ALWORKER_COMMON)/../ext_libs/speexdsp_resample
 
 CSRCS += resample.c
-VPATH_DIR += $(SPEEXDSP_DIR)
+VPATH_DIRS += $(SPEEXDSP_DIR)
 INCDIRS += $(SPEEXDSP_DIR)
 CFLAGS += -DUSE_CMSIS
@@ -0,0 +1,10 @@
+#ifndef __DUMMY_NUTTX_QUEUE_H
+#define __DUMMY_NUTTX_QUEUE_H
+
+struct sq_entry_s
+{
+  struct sq_entry_s *flink;
+};
+typedef struct sq_entry_s sq_entry_t;
+
+#endif
@@ -0,0 +1,372 @@
+/****************************************************************************
+ * modules/audiolite/worker/common/test_on_pc/memblk_bench.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/* Host benchmark of memblk conversion functions.
+ * Compares alworker_memblk.c with the scalar loops used before,
+ * and checks the results are the same.
+ * On a host, PKHBT/PKHTB/SSAT of Cortex-M4 are emulated by C macros and
+ * auto vectorization is disabled, so the time is just a rough guide.
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "alworker_memblk.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define BLK_SAMPLES (1024)   /* Samples per channel in a block */
+#define LOOP_NUM    (20000)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static short g_stereo[BLK_SAMPLES * 2];
+static short g_lch[BLK_SAMPLES];
+static short g_rch[BLK_SAMPLES];
+static short g_pcm[BLK_SAMPLES * 2];
+static short g_pcmref[BLK_SAMPLES * 2];
+static float g_flt[BLK_SAMPLES * 2];
+static float g_fltref[BLK_SAMPLES * 2];
+
+static volatile int g_sink;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Scalar reference implementations */
+
+static void ref_split_lr16(short *l, short *r, const short *src, int n)
+{
+  for (int i = 0; i < n; i++)
+    {
+      *l++ = *src++;
+      *r++ = *src++;
+    }
+}
+
+static void ref_conbine_lr16(short *dst, const short *l, const short *r,
+                             int n)
+{
+  for (int i = 0; i < n; i++)
+    {
+      dst[i * 2 + 1] = *r++;
+      dst[i * 2 + 0] = *l++;
+    }
+}
+
+static void ref_pcm16tofloat(float *f, const short *pcm, int n)
+{
+  for (int i = 0; i < n; i++)
+    {
+      *f++ = (float)*pcm++;
+    }
+}
+
+static void ref_floattopcm16(short *pcm, const float *f, int n, float gain)
+{
+  for (int i = 0; i < n; i++)
+    {
+      *pcm++ = gain * (short)*f++;
+    }
+}
+
+static void ref_normalizef(float *f, int n, float min, float max)
+{
+  float div = max - min;
+
+  for (int i = 0; i < n; i++, f++)
+    {
+      *f = (*f - min) / div;
+      if (*f < -1) *f = -1;
+      else if (*f >  1) *f =  1;
+    }
+}
+
+static double now_us(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void report(const char *name, double ref, double opt, int ok)
+{
+  printf("%-16s scalar %8.3f us  new %8.3f us  x%5.2f  %s\n",
+         name, ref / LOOP_NUM, opt / LOOP_NUM, ref / opt,
+         ok ? "OK" : "MISMATCH");
+}
+
+static int bench_split(void)
+{
+  int i;
+  int ok;
+  double t0;
+  double t1;
+  double t2;
+  memblk_t src;
+  memblk_t l;
+  memblk_t r;
+
+  t0 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      ref_split_lr16(g_lch, g_rch, g_stereo, BLK_SAMPLES);
+      g_sink += g_lch[i % BLK_SAMPLES];
+    }
+
+  t1 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      memblk_init(&src, (char *)g_stereo, sizeof(g_stereo));
+      memblk_setfilled(&src, sizeof(g_stereo));
+      memblk_init(&l, (char *)g_pcm, BLK_SAMPLES * sizeof(short));
+      memblk_init(&r, (char *)&g_pcm[BLK_SAMPLES],
+                  BLK_SAMPLES * sizeof(short));
+      memblk_split_lr16(&l, &r, &src);
+      g_sink += g_pcm[i % BLK_SAMPLES];
+    }
+
+  t2 = now_us();
+
+  ok = !memcmp(g_pcm, g_lch, sizeof(g_lch)) &&
+       !memcmp(&g_pcm[BLK_SAMPLES], g_rch, sizeof(g_rch));
+  report("split_lr16", t1 - t0, t2 - t1, ok);
+
+  return ok;
+}
+
+static int bench_conbine(void)
+{
+  int i;
+  int ok;
+  double t0;
+  double t1;
+  double t2;
+  memblk_t dst;
+  memblk_t l;
+  memblk_t r;
+
+  t0 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      ref_conbine_lr16(g_pcmref, g_lch, g_rch, BLK_SAMPLES);
+      g_sink += g_pcmref[i % BLK_SAMPLES];
+    }
+
+  t1 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      memblk_init(&dst, (char *)g_pcm, sizeof(g_pcm));
+      memblk_init(&l, (char *)g_lch, sizeof(g_lch));
+      memblk_setfilled(&l, sizeof(g_lch));
+      memblk_init(&r, (char *)g_rch, sizeof(g_rch));
+      memblk_setfilled(&r, sizeof(g_rch));
+      memblk_conbine_lr16(&dst, &l, &r);
+      g_sink += g_pcm[i % BLK_SAMPLES];
+    }
+
+  t2 = now_us();
+
+  ok = !memcmp(g_pcm, g_pcmref, sizeof(g_pcm)) &&
+       !memcmp(g_pcm, g_stereo, sizeof(g_pcm));
+  report("conbine_lr16", t1 - t0, t2 - t1, ok);
+
+  return ok;
+}
+
+static int bench_pcm16tofloat(void)
+{
+  int i;
+  int ok;
+  double t0;
+  double t1;
+  double t2;
+  memblk_t pcm;
+  memblk_t flt;
+
+  t0 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      ref_pcm16tofloat(g_fltref, g_stereo, BLK_SAMPLES * 2);
+      g_sink += (int)g_fltref[i % BLK_SAMPLES];
+    }
+
+  t1 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      memblk_init(&pcm, (char *)g_stereo, sizeof(g_stereo));
+      memblk_setfilled(&pcm, sizeof(g_stereo));
+      memblk_init(&flt, (char *)g_flt, sizeof(g_flt));
+      memblk_conv_pcm16tofloat(&flt, &pcm);
+      g_sink += (int)g_flt[i % BLK_SAMPLES];
+    }
+
+  t2 = now_us();
+
+  ok = !memcmp(g_flt, g_fltref, sizeof(g_flt));
+  report("pcm16tofloat", t1 - t0, t2 - t1, ok);
+
+  return ok;
+}
+
+static int bench_floattopcm16(void)
+{
+  int i;
+  int ok;
+  double t0;
+  double t1;
+  double t2;
+  memblk_t pcm;
+  memblk_t flt;
+
+  t0 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      ref_floattopcm16(g_pcmref, g_fltref, BLK_SAMPLES * 2, 1.f);
+      g_sink += g_pcmref[i % BLK_SAMPLES];
+    }
+
+  t1 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      memblk_init(&flt, (char *)g_fltref, sizeof(g_fltref));
+      memblk_setfilled(&flt, sizeof(g_fltref));
+      memblk_init(&pcm, (char *)g_pcm, sizeof(g_pcm));
+      memblk_conv_floattopcm16(&pcm, &flt, 1.f);
+      g_sink += g_pcm[i % BLK_SAMPLES];
+    }
+
+  t2 = now_us();
+
+  ok = !memcmp(g_pcm, g_pcmref, sizeof(g_pcm));
+
+  /* Out of range values must be saturated */
+
+  g_flt[0] = 40000.f;
+  g_flt[1] = -40000.f;
+  g_flt[2] = 1000.f;
+  memblk_init(&flt, (char *)g_flt, 3 * sizeof(float));
+  memblk_setfilled(&flt, 3 * sizeof(float));
+  memblk_init(&pcm, (char *)g_pcm, sizeof(g_pcm));
+  memblk_conv_floattopcm16(&pcm, &flt, 2.f);
+  ok = ok && g_pcm[0] == 32767 && g_pcm[1] == -32768 && g_pcm[2] == 2000;
+
+  report("floattopcm16", t1 - t0, t2 - t1, ok);
+
+  return ok;
+}
+
+static int bench_normalizef(void)
+{
+  int i;
+  int ok = 1;
+  double t0;
+  double t1;
+  double t2;
+  memblk_t flt;
+  static float ref[BLK_SAMPLES * 2];
+
+  t0 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      memcpy(ref, g_fltref, sizeof(ref));
+      ref_normalizef(ref, BLK_SAMPLES * 2, -16384.f, 16384.f);
+      g_sink += (int)ref[i % BLK_SAMPLES];
+    }
+
+  t1 = now_us();
+  for (i = 0; i < LOOP_NUM; i++)
+    {
+      memcpy(g_flt, g_fltref, sizeof(g_flt));
+      memblk_init(&flt, (char *)g_flt, sizeof(g_flt));
+      memblk_setfilled(&flt, sizeof(g_flt));
+      memblk_normalizef(&flt, -16384.f, 16384.f);
+      g_sink += (int)g_flt[i % BLK_SAMPLES];
+    }
+
+  t2 = now_us();
+
+  /* Reciprocal multiplication can differ in the last bit */
+
+  for (i = 0; i < BLK_SAMPLES * 2; i++)
+    {
+      if (g_flt[i] - ref[i] > 1e-6f || ref[i] - g_flt[i] > 1e-6f)
+        {
+          ok = 0;
+        }
+    }
+
+  report("normalizef", t1 - t0, t2 - t1, ok);
+
+  return ok;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int main(void)
+{
+  int i;
+  int ok = 1;
+
+  srand(1);
+  for (i = 0; i < BLK_SAMPLES * 2; i++)
+    {
+      g_stereo[i] = (short)(rand() - RAND_MAX / 2);
+    }
+
+  ok &= bench_split();
+  ok &= bench_conbine();
+  ok &= bench_pcm16tofloat();
+  ok &= bench_floattopcm16();
+  ok &= bench_normalizef();
+
+  printf("%s\n", ok ? "ALL OK" : "FAILED");
+
+  return ok ? 0 : 1;
+}
@@ -653,6 +653,12 @@ static int update_filter(SpeexResamplerState *st)
 
       min_sinc_table_length = st->filt_len*st->oversample+8;
    }
+   /* sinc_table and mem are fixed size arrays in this port.
+      Reject a filter which does not fit instead of overrunning them. */
+   if (min_sinc_table_length > sizeof(st->sinc_table)/sizeof(st->sinc_table[0]))
+      goto fail;
+   if (st->nb_channels*(st->filt_len-1 + st->buffer_size) > sizeof(st->mem)/sizeof(st->mem[0]))
+      goto fail;
    if (st->sinc_table_length < min_sinc_table_length)
    {
 #if 0
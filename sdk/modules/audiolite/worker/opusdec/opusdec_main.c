@@ -0,0 +1,352 @@
+/****************************************************************************
+ * modules/audiolite/worker/opusdec/opusdec_main.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <stdint.h>
+#include <string.h>
+#include <alworker_commfw.h>
+#include <audiolite/alworker_opusdec.h>
+
+#include "opus.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Size of decoder state. Stereo state of fixed point build fits in it,
+ * and it is checked by opus_decoder_get_size() on start.
+ */
+
+#define OPUSDEC_STATESZ   (32 * 1024)
+
+/* Staging buffer holds a header and a packet at least */
+
+#define OPUSDEC_STAGESZ   (AL_OPUSDEC_MAXPACKET + 8)
+
+#define OPUSDEC_HDRSZ(f)  ((f) == AL_OPUSDEC_FRAMING_LEN32 ? 8 : 1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct opusdec_instance_s
+{
+  /* ALWORKERCOMMFW_INSTANCE should be on top of your instance */
+
+  ALWORKERCOMMFW_INSTANCE;
+
+  OpusDecoder *dec;
+
+  /* Packets are not aligned to input memory blocks.
+   * stage gathers the bytes until a whole packet is stored,
+   * and pcm holds decoded samples until output memory takes them.
+   */
+
+  memblk_t stage;
+  memblk_t pcm;
+
+  int chs;
+  int hz;
+  int framing;
+  int hdrsz;
+  int eof;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct opusdec_instance_s g_instance;
+
+static uint32_t g_decstate[OPUSDEC_STATESZ / sizeof(uint32_t)];
+static char g_stagebuf[OPUSDEC_STAGESZ];
+static int16_t g_pcmbuf[AL_OPUSDEC_MAXFRAME * AL_OPUSDEC_MAXCHS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/*** name: packet_length */
+
+static int packet_length(struct opusdec_instance_s *inst)
+{
+  uint8_t *hdr = memblk_dataptruint8(&inst->stage);
+
+  if (memblk_remain(&inst->stage) < inst->hdrsz)
+    {
+      return -1;
+    }
+
+  if (inst->framing == AL_OPUSDEC_FRAMING_LEN32)
+    {
+      return (int)(((uint32_t)hdr[0] << 24) | ((uint32_t)hdr[1] << 16) |
+                   ((uint32_t)hdr[2] << 8)  |  (uint32_t)hdr[3]);
+    }
+
+  return hdr[0];
+}
+
+/*** name: decode_packet */
+
+static void decode_packet(struct opusdec_instance_s *inst, int len)
+{
+  int samples;
+  uint8_t *pkt = memblk_dataptruint8(&inst->stage) + inst->hdrsz;
+
+  /* Zero length packet comes as padding of EOF. Just skip it. */
+
+  if (len > 0)
+    {
+      samples = opus_decode(inst->dec, pkt, len,
+                            g_pcmbuf, AL_OPUSDEC_MAXFRAME, 0);
+      if (samples < 0)
+        {
+          alworker_send_errormsg(0, AL_COMM_MSGCODEERR_ILLIGALFRAME);
+        }
+      else
+        {
+          memblk_init(&inst->pcm, g_pcmbuf, sizeof(g_pcmbuf));
+          memblk_commitint16(&inst->pcm, samples * inst->chs);
+        }
+    }
+
+  memblk_drop(&inst->stage, inst->hdrsz + len);
+}
+
+/*** name: gather_packet */
+
+static int gather_packet(struct opusdec_instance_s *inst)
+{
+  memblk_t *imem;
+
+  imem = PEEK_IMEM(inst);
+  if (imem == NULL)
+    {
+      return AL_COMMFW_RET_NOIMEM;
+    }
+
+  memblk_shift(&inst->stage);
+  memblk_fillup(&inst->stage, imem);
+
+  if (memblk_is_empty(imem))
+    {
+      TAKE_IMEM(inst);
+      inst->eof = memblk_is_eof(imem);
+      FREE_MEMBLK(imem, inst);
+    }
+
+  return AL_COMMFW_RET_OK;
+}
+
+/*** name: finish_stream */
+
+static int finish_stream(struct opusdec_instance_s *inst)
+{
+  memblk_t *omem;
+
+  /* Pass EOF to the next component with the last output block */
+
+  omem = TAKE_OMEM(inst);
+  if (omem == NULL)
+    {
+      return AL_COMMFW_RET_NOOMEM;
+    }
+
+  memblk_set_eof(omem);
+  FREE_MEMBLK(omem, inst);
+
+  memblk_reset(&inst->stage);
+  inst->eof = 0;
+  alworker_send_framedone(0);
+
+  return AL_COMMFW_RET_OK;
+}
+
+/*** name: on_process */
+
+static int on_process(void *arg)
+{
+  int len;
+  memblk_t *omem;
+  struct opusdec_instance_s *inst = (struct opusdec_instance_s *)arg;
+
+  /* Deliver decoded samples before decoding next packet */
+
+  if (memblk_remain(&inst->pcm) > 0)
+    {
+      omem = PEEK_OMEM(inst);
+      if (omem == NULL)
+        {
+          return AL_COMMFW_RET_NOOMEM;
+        }
+
+      memblk_fillup(omem, &inst->pcm);
+      if (memblk_is_full(omem))
+        {
+          TAKE_OMEM(inst);
+          FREE_MEMBLK(omem, inst);
+        }
+
+      return AL_COMMFW_RET_OK;
+    }
+
+  len = packet_length(inst);
+  if (len > AL_OPUSDEC_MAXPACKET)
+    {
+      /* Length field is broken. No way to find next packet. */
+
+      alworker_send_errormsg(0, AL_COMM_MSGCODEERR_ILLIGALFRAME);
+      memblk_reset(&inst->stage);
+      len = -1;
+    }
+
+  if (len >= 0 && memblk_remain(&inst->stage) >= inst->hdrsz + len)
+    {
+      decode_packet(inst, len);
+      return AL_COMMFW_RET_OK;
+    }
+
+  /* A fragment of a packet at the end of stream is dropped */
+
+  if (inst->eof)
+    {
+      return finish_stream(inst);
+    }
+
+  return gather_packet(inst);
+}
+
+/*** name: on_parammsg */
+
+static int on_parammsg(int state, void *arg,
+                       al_comm_msghdr_t hdr, al_comm_msgopt_t *opt)
+{
+  struct opusdec_instance_s *inst = (struct opusdec_instance_s *)arg;
+
+  if (opt->chs <= 0 || opt->chs > AL_OPUSDEC_MAXCHS)
+    {
+      return AL_COMM_MSGCODEERR_UNSUPFRAME;
+    }
+
+  inst->chs = opt->chs;
+
+  /* Opus decodes at one of these rates.
+   * For other rate, decode at 48kHz and resample it after this.
+   */
+
+  switch (opt->hz)
+    {
+      case 8000:
+      case 12000:
+      case 16000:
+      case 24000:
+      case 48000:
+        inst->hz = opt->hz;
+        break;
+
+      default:
+        inst->hz = 48000;
+        break;
+    }
+
+  return AL_COMM_MSGCODEERR_OK;
+}
+
+/*** name: on_playmsg */
+
+static int on_playmsg(int state, void *arg, al_comm_msgopt_t *opt)
+{
+  struct opusdec_instance_s *inst = (struct opusdec_instance_s *)arg;
+
+  inst->framing = opt->usr[AL_OPUSDEC_OPT_FRAMING];
+  inst->hdrsz = OPUSDEC_HDRSZ(inst->framing);
+
+  if (inst->chs <= 0 ||
+      opus_decoder_get_size(inst->chs) > (int)sizeof(g_decstate))
+    {
+      alworker_send_errormsg(0, AL_COMM_MSGCODEERR_UNSUPFRAME);
+      return AL_COMM_MSGCODEERR_UNSUPFRAME;
+    }
+
+  inst->dec = (OpusDecoder *)g_decstate;
+  if (opus_decoder_init(inst->dec, inst->hz, inst->chs) != OPUS_OK)
+    {
+      alworker_send_errormsg(0, AL_COMM_MSGCODEERR_UNSUPFRAME);
+      return AL_COMM_MSGCODEERR_UNSUPFRAME;
+    }
+
+  memblk_init(&inst->stage, g_stagebuf, sizeof(g_stagebuf));
+  memblk_init(&inst->pcm, g_pcmbuf, sizeof(g_pcmbuf));
+  inst->eof = 0;
+
+  /* Notice the decoded format to the host. layer is the framing. */
+
+  alworker_send_frameinfo(0, inst->chs, inst->hz, inst->framing, 0);
+
+  return AL_COMM_MSGCODEERR_OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/*** name: main */
+
+int main(void)
+{
+  alcommfw_cbs_t *cbs = alworker_commfw_get_cbtable();
+
+  if (alworker_commfw_initialize((alworker_insthead_t *)&g_instance) != OK)
+    {
+      return 0;
+    }
+
+  g_instance.chs = 0;
+  g_instance.hz = 48000;
+
+  SET_PROCESS(cbs, on_process);
+  SET_PARAMMSG(cbs, on_parammsg);
+  SET_PLAYMSG(cbs, on_playmsg);
+
+  alworker_send_bootmsg(AL_OPUSDEC_WORKER_VERSION, NULL);
+
+  alworker_commfw_msgloop((alworker_insthead_t *)&g_instance);
+
+  return 0;
+}
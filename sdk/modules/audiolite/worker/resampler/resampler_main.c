@@ -0,0 +1,302 @@
+/****************************************************************************
+ * modules/audiolite/worker/resampler/resampler_main.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <stdint.h>
+#include <string.h>
+#include <alworker_commfw.h>
+#include <audiolite/alworker_resampler.h>
+
+#include "speex_resampler.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct resampler_instance_s
+{
+  /* ALWORKERCOMMFW_INSTANCE should be on top of your instance */
+
+  ALWORKERCOMMFW_INSTANCE;
+
+  /* One state per channel. The speex port in this worker has static
+   * buffers for up to 2 channels, so interleaved data is processed
+   * channel by channel with input/output stride.
+   */
+
+  SpeexResamplerState st[AL_RESAMPLER_MAXCHS];
+
+  int chs;
+  int ihz;
+  int ohz;
+  int quality;
+  int passthrough;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct resampler_instance_s g_instance;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/*** name: setup_resampler */
+
+static int setup_resampler(struct resampler_instance_s *inst, int quality)
+{
+  int ch;
+  int ret = RESAMPLER_ERR_INVALID_ARG;
+
+  /* Some filters at high quality does not fit in the static tables.
+   * Fall back to lower quality until it fits.
+   */
+
+  for (; quality >= AL_RESAMPLER_QUALITY_MIN; quality--)
+    {
+      for (ch = 0; ch < inst->chs; ch++)
+        {
+          ret = speex_resampler_init(&inst->st[ch], 1,
+                                     inst->ihz, inst->ohz, quality);
+          if (ret != RESAMPLER_ERR_SUCCESS)
+            {
+              break;
+            }
+
+          speex_resampler_set_input_stride(&inst->st[ch], inst->chs);
+          speex_resampler_set_output_stride(&inst->st[ch], inst->chs);
+        }
+
+      if (ret == RESAMPLER_ERR_SUCCESS)
+        {
+          return quality;
+        }
+    }
+
+  return -1;
+}
+
+/*** name: resample_block */
+
+static void resample_block(struct resampler_instance_s *inst,
+                           memblk_t *imem, memblk_t *omem)
+{
+  int ch;
+  unsigned int inl;
+  unsigned int outl;
+  unsigned int frames_in;
+  unsigned int frames_out;
+  int16_t *src;
+  int16_t *dst;
+
+  frames_in  = memblk_remainint16(imem) / inst->chs;
+  frames_out = memblk_spaceint16(omem) / inst->chs;
+  src = memblk_dataptrint16(imem);
+  dst = memblk_fillptrint16(omem);
+
+  if (inst->passthrough)
+    {
+      inl = (frames_in < frames_out) ? frames_in : frames_out;
+      outl = inl;
+      memcpy(dst, src, inl * inst->chs * sizeof(int16_t));
+    }
+  else
+    {
+      /* All channel states have the same rate and history length,
+       * so they consume and produce the same number of frames.
+       */
+
+      for (ch = 0; ch < inst->chs; ch++)
+        {
+          inl  = frames_in;
+          outl = frames_out;
+          speex_resampler_process_int(&inst->st[ch], 0,
+                                      &src[ch], &inl, &dst[ch], &outl);
+        }
+    }
+
+  memblk_dropint16(imem, inl * inst->chs);
+  memblk_commitint16(omem, outl * inst->chs);
+
+  /* Drop a fragment of a frame, which can not be processed */
+
+  if (memblk_remainint16(imem) < inst->chs)
+    {
+      memblk_drop(imem, memblk_remain(imem));
+    }
+}
+
+/*** name: on_process */
+
+static int on_process(void *arg)
+{
+  memblk_t *imem;
+  memblk_t *omem;
+  struct resampler_instance_s *inst =
+    (struct resampler_instance_s *)arg;
+
+  imem = PEEK_IMEM(inst);
+  if (imem == NULL)
+    {
+      return AL_COMMFW_RET_NOIMEM;
+    }
+
+  omem = PEEK_OMEM(inst);
+  if (omem == NULL)
+    {
+      return AL_COMMFW_RET_NOOMEM;
+    }
+
+  resample_block(inst, imem, omem);
+
+  if (memblk_is_empty(imem))
+    {
+      TAKE_IMEM(inst);
+      if (memblk_is_eof(imem))
+        {
+          /* Flush the output block to pass EOF to the next component */
+
+          TAKE_OMEM(inst);
+          memblk_set_eof(omem);
+          FREE_MEMBLK(omem, inst);
+          omem = NULL;
+        }
+
+      FREE_MEMBLK(imem, inst);
+    }
+
+  if (omem && memblk_spaceint16(omem) < inst->chs)
+    {
+      TAKE_OMEM(inst);
+      FREE_MEMBLK(omem, inst);
+    }
+
+  return AL_COMMFW_RET_OK;
+}
+
+/*** name: on_parammsg */
+
+static int on_parammsg(int state, void *arg,
+                       al_comm_msghdr_t hdr, al_comm_msgopt_t *opt)
+{
+  struct resampler_instance_s *inst =
+    (struct resampler_instance_s *)arg;
+
+  if (opt->chs <= 0 || opt->chs > AL_RESAMPLER_MAXCHS || opt->hz <= 0)
+    {
+      return AL_COMM_MSGCODEERR_UNSUPFRAME;
+    }
+
+  inst->chs = opt->chs;
+  inst->ohz = opt->hz;
+
+  return AL_COMM_MSGCODEERR_OK;
+}
+
+/*** name: on_playmsg */
+
+static int on_playmsg(int state, void *arg, al_comm_msgopt_t *opt)
+{
+  struct resampler_instance_s *inst =
+    (struct resampler_instance_s *)arg;
+
+  inst->ihz = opt->usr[AL_RESAMPLER_OPT_INHZ];
+  inst->quality = opt->usr[AL_RESAMPLER_OPT_QUALITY];
+
+  if (inst->chs <= 0 || inst->ihz <= 0)
+    {
+      alworker_send_errormsg(0, AL_COMM_MSGCODEERR_UNSUPFRAME);
+      return AL_COMM_MSGCODEERR_UNSUPFRAME;
+    }
+
+  if (inst->quality > AL_RESAMPLER_QUALITY_MAX)
+    {
+      inst->quality = AL_RESAMPLER_QUALITY_MAX;
+    }
+
+  inst->passthrough = (inst->ihz == inst->ohz);
+  if (!inst->passthrough)
+    {
+      inst->quality = setup_resampler(inst, inst->quality);
+      if (inst->quality < 0)
+        {
+          alworker_send_errormsg(0, AL_COMM_MSGCODEERR_UNSUPFRAME);
+          return AL_COMM_MSGCODEERR_UNSUPFRAME;
+        }
+    }
+
+  /* Notice the actual quality to the host as layer */
+
+  alworker_send_frameinfo(0, inst->chs, inst->ohz,
+                          inst->quality, inst->ihz);
+
+  return AL_COMM_MSGCODEERR_OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/*** name: main */
+
+int main(void)
+{
+  alcommfw_cbs_t *cbs = alworker_commfw_get_cbtable();
+
+  if (alworker_commfw_initialize((alworker_insthead_t *)&g_instance) != OK)
+    {
+      return 0;
+    }
+
+  g_instance.chs = 0;
+  g_instance.ihz = 0;
+  g_instance.ohz = 0;
+
+  SET_PROCESS(cbs, on_process);
+  SET_PARAMMSG(cbs, on_parammsg);
+  SET_PLAYMSG(cbs, on_playmsg);
+
+  alworker_send_bootmsg(AL_RESAMPLER_WORKER_VERSION, NULL);
+
+  alworker_commfw_msgloop((alworker_insthead_t *)&g_instance);
+
+  return 0;
+}
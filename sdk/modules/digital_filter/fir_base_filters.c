@@ -46,21 +46,32 @@
 
 #include <digital_filter/fir_filter.h>
 #include <digital_filter/fir_decimator.h>
+#ifdef CONFIG_DIGITAL_FILTER_RESAMPLER
+#include <digital_filter/fir_resampler.h>
+#endif
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
-static int tap_number(int fs, int tr_width)
+#if defined(CONFIG_DIGITAL_FILTER_FIR) || \
+    defined(CONFIG_DIGITAL_FILTER_DECIMATOR)
+
+static int tap_number_norm(float tr_norm)
 {
   int taps;
 
-  taps = (int)roundf(3.1 / ((float)tr_width / (float)fs));
+  taps = (int)roundf(3.1 / tr_norm);
   taps += (taps & 0x01);
 
   return taps + 1;
 }
 
+static int tap_number(int fs, int tr_width)
+{
+  return tap_number_norm((float)tr_width / (float)fs);
+}
+
 static void hanning_window(float *coeffs, int taps)
 {
   int i;
@@ -81,6 +92,8 @@ static float sinc(float n)
   return sin(n) / n;
 }
 
+#ifdef CONFIG_DIGITAL_FILTER_FIR
+
 static arm_fir_instance_f32 * prepare_fir(int taps, float *coeffs, int blocksz)
 {
   arm_fir_instance_f32 *S;
@@ -104,6 +117,10 @@ static arm_fir_instance_f32 * prepare_fir(int taps, float *coeffs, int blocksz)
   return S;
 }
 
+#endif  /* CONFIG_DIGITAL_FILTER_FIR */
+
+#ifdef CONFIG_DIGITAL_FILTER_DECIMATOR
+
 static decimator_instancef_t * prepare_decimator(int dec_factor, int taps,
                                                  float *coeffs, int blocksz)
 {
@@ -129,6 +146,8 @@ static decimator_instancef_t * prepare_decimator(int dec_factor, int taps,
   return S;
 }
 
+#endif  /* CONFIG_DIGITAL_FILTER_DECIMATOR */
+
 static float * fir_coeffs_lpf(float fe, int taps)
 {
   int i;
@@ -151,6 +170,8 @@ static float * fir_coeffs_lpf(float fe, int taps)
   return coeffs;
 }
 
+#ifdef CONFIG_DIGITAL_FILTER_FIR
+
 static float * fir_coeffs_hpf(float fe, int taps)
 {
   int i;
@@ -219,6 +240,10 @@ static float * fir_coeffs_bef(float fe1, float fe2, int taps)
   return coeffs;
 }
 
+#endif  /* CONFIG_DIGITAL_FILTER_FIR */
+
+#endif  /* CONFIG_DIGITAL_FILTER_FIR || CONFIG_DIGITAL_FILTER_DECIMATOR */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -448,120 +473,1241 @@ void fir_deletef(fir_instancef_t *fir)
     }
 }
 
-#endif  /* CONFIG_DIGITAL_FILTER_FIR */
 
 /****************************************************************************
- * Decimation Filter
+ * FIR Filter (q15)
  ****************************************************************************/
 
-#ifdef CONFIG_DIGITAL_FILTER_DECIMATOR
+/* Coefficients are designed in float and quantized once at create time. */
 
-/** create_decimatorf() */
+static fir_instanceq15_t * prepare_firq15(int taps, float *coeffs, int blocksz)
+{
+  fir_instanceq15_t *S;
+  q15_t *qcoeffs;
+  q15_t *state;
+  int ntaps = taps;
+
+  /* arm_fir_fast_q15() needs an even tap number.
+   * A zero coefficient is added as the last tap. (Coefficients are in
+   * time reversed order, so it is the first element.)
+   */
+
+  ntaps += (taps & 0x01);
+
+  S = (fir_instanceq15_t *)malloc(sizeof(fir_instanceq15_t));
+  qcoeffs = (q15_t *)calloc(ntaps, sizeof(q15_t));
+  state = (q15_t *)malloc(sizeof(q15_t) * (ntaps + blocksz));
+  if (S == NULL || qcoeffs == NULL || state == NULL)
+    {
+      goto error;
+    }
 
-decimator_instancef_t *create_decimatorf(int fs, int dec_factor,
-    int tr_width, int blocksz)
+  arm_float_to_q15(coeffs, &qcoeffs[ntaps - taps], taps);
+
+  if (arm_fir_init_q15(S, ntaps, qcoeffs, state, blocksz)
+      != ARM_MATH_SUCCESS)
+    {
+      goto error;
+    }
+
+  free(coeffs);
+  return S;
+
+error:
+  free(state);
+  free(qcoeffs);
+  free(S);
+  free(coeffs);
+  return NULL;
+}
+
+/** fir_create_lpfq15() */
+
+fir_instanceq15_t * fir_create_lpfq15(int fs, int cutoff_freq, int tr_width,
+    int blocksz)
 {
-  decimator_instancef_t *S;
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
 
-  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+  return fir_create_lpfq15_tap(fs, cutoff_freq,
+                               tap_number(fs, tr_width), blocksz);
+}
+
+/** fir_create_lpfq15_tap() */
+
+fir_instanceq15_t * fir_create_lpfq15_tap(int fs, int cutoff_freq, int taps,
+    int blocksz)
+{
+  float *coeffs;
+
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
     {
       return NULL;
     }
 
-  S = create_decimatorf_tap(fs, dec_factor, tap_number(fs, tr_width), blocksz);
+  taps = (taps & 0x01) ? taps : taps + 1;
 
-  return S;
+  coeffs = fir_coeffs_lpf((float)cutoff_freq / (float)fs, taps);
+  if (coeffs == NULL)
+    {
+      return NULL;
+    }
+
+  return prepare_firq15(taps, coeffs, blocksz);
 }
 
-/** create_decimatorf_tap() */
+/** fir_create_hpfq15() */
 
-decimator_instancef_t *create_decimatorf_tap(int fs, int dec_factor,
-    int taps, int blocksz)
+fir_instanceq15_t * fir_create_hpfq15(int fs, int cutoff_freq, int tr_width,
+    int blocksz)
+{
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  return fir_create_hpfq15_tap(fs, cutoff_freq,
+                               tap_number(fs, tr_width), blocksz);
+}
+
+/** fir_create_hpfq15_tap() */
+
+fir_instanceq15_t * fir_create_hpfq15_tap(int fs, int cutoff_freq, int taps,
+    int blocksz)
 {
-  decimator_instancef_t *S;
   float *coeffs;
 
-  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
     {
       return NULL;
     }
 
-  if (taps > 0)
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_hpf((float)cutoff_freq / (float)fs, taps);
+  if (coeffs == NULL)
     {
-      taps = (taps & 0x01) ? taps : taps + 1;
+      return NULL;
+    }
 
-      coeffs = fir_coeffs_lpf(1.f / (float)(2 * dec_factor), taps);
-      if (coeffs == NULL)
-        {
-          return NULL;
-        }
+  return prepare_firq15(taps, coeffs, blocksz);
+}
 
-      S = prepare_decimator(dec_factor, taps, coeffs, blocksz);
+/** fir_create_bpfq15() */
+
+fir_instanceq15_t * fir_create_bpfq15(int fs, int lower_cutfreq,
+    int higher_cutfreq, int tr_width, int blocksz)
+{
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
     }
-  else
+
+  return fir_create_bpfq15_tap(fs, lower_cutfreq, higher_cutfreq,
+                               tap_number(fs, tr_width), blocksz);
+}
+
+/** fir_create_bpfq15_tap() */
+
+fir_instanceq15_t * fir_create_bpfq15_tap(int fs, int lower_cutfreq,
+    int higher_cutfreq, int taps, int blocksz)
+{
+  float *coeffs;
+
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
     {
-      S = (decimator_instancef_t *)malloc(sizeof(decimator_instancef_t));
-      if (S)
-        {
-          S->inst.numTaps = 0;
-          S->inst.M = dec_factor;
-        }
+      return NULL;
     }
 
-  return S;
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_bpf((float)lower_cutfreq / (float)fs,
+                          (float)higher_cutfreq / (float)fs, taps);
+  if (coeffs == NULL)
+    {
+      return NULL;
+    }
+
+  return prepare_firq15(taps, coeffs, blocksz);
 }
 
-/** decimator_execute() */
+/** fir_create_befq15() */
 
-int decimator_executef(decimator_instancef_t *dec, float *input, int input_len,
-    float *output, int output_len)
+fir_instanceq15_t * fir_create_befq15(int fs, int lower_cutfreq,
+    int higher_cutfreq, int tr_width, int blocksz)
 {
-  int i;
-  int output_sz = input_len / dec->inst.M;
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
 
-  if (output_len < output_sz)
+  return fir_create_befq15_tap(fs, lower_cutfreq, higher_cutfreq,
+                               tap_number(fs, tr_width), blocksz);
+}
+
+/** fir_create_befq15_tap() */
+
+fir_instanceq15_t * fir_create_befq15_tap(int fs, int lower_cutfreq,
+    int higher_cutfreq, int taps, int blocksz)
+{
+  float *coeffs;
+
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
     {
-      return -1;
+      return NULL;
     }
 
-  if (dec->inst.numTaps)
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_bef((float)lower_cutfreq / (float)fs,
+                          (float)higher_cutfreq / (float)fs, taps);
+  if (coeffs == NULL)
     {
-      arm_fir_decimate_f32(&dec->inst, input, output, input_len);
+      return NULL;
     }
-  else
+
+  return prepare_firq15(taps, coeffs, blocksz);
+}
+
+/** fir_get_tapnumq15() */
+
+int fir_get_tapnumq15(fir_instanceq15_t *fir)
+{
+  return fir->numTaps;
+}
+
+/** fir_executeq15() */
+
+void fir_executeq15(fir_instanceq15_t *fir, q15_t *input, q15_t *output,
+    int len)
+{
+  arm_fir_fast_q15(fir, input, output, len);
+}
+
+/** firabs_executeq15() */
+
+void firabs_executeq15(fir_instanceq15_t *fir, q15_t *input, q15_t *output,
+    int len)
+{
+  arm_fir_fast_q15(fir, input, output, len);
+  arm_abs_q15(output, output, len);
+}
+
+/** fir_deleteq15() */
+
+void fir_deleteq15(fir_instanceq15_t *fir)
+{
+  if (fir)
     {
-      /* Do without filter */
+      free(fir->pState);
+      free((void *)fir->pCoeffs);
+      free(fir);
+    }
+}
 
-      for (i = 0; i < output_sz; i++)
-        {
-          output[i] = input[i * dec->inst.M];
-        }
+/****************************************************************************
+ * FIR Filter (q31)
+ ****************************************************************************/
+
+/* Coefficients are designed in float and quantized once at create time. */
+
+static fir_instanceq31_t * prepare_firq31(int taps, float *coeffs, int blocksz)
+{
+  fir_instanceq31_t *S;
+  q31_t *qcoeffs;
+  q31_t *state;
+  int ntaps = taps;
+
+  S = (fir_instanceq31_t *)malloc(sizeof(fir_instanceq31_t));
+  qcoeffs = (q31_t *)calloc(ntaps, sizeof(q31_t));
+  state = (q31_t *)malloc(sizeof(q31_t) * (ntaps + blocksz - 1));
+  if (S == NULL || qcoeffs == NULL || state == NULL)
+    {
+      goto error;
     }
 
-  return output_sz;
+  arm_float_to_q31(coeffs, qcoeffs, taps);
+  arm_fir_init_q31(S, ntaps, qcoeffs, state, blocksz);
+
+  free(coeffs);
+  return S;
+
+error:
+  free(state);
+  free(qcoeffs);
+  free(S);
+  free(coeffs);
+  return NULL;
 }
 
-/** decimator_tapnumf() */
+/** fir_create_lpfq31() */
 
-int decimator_tapnumf(decimator_instancef_t *dec)
+fir_instanceq31_t * fir_create_lpfq31(int fs, int cutoff_freq, int tr_width,
+    int blocksz)
 {
-  return dec->inst.numTaps;
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  return fir_create_lpfq31_tap(fs, cutoff_freq,
+                               tap_number(fs, tr_width), blocksz);
 }
 
-/** decimator_deletef() */
+/** fir_create_lpfq31_tap() */
 
-void decimator_deletef(decimator_instancef_t *dec)
+fir_instanceq31_t * fir_create_lpfq31_tap(int fs, int cutoff_freq, int taps,
+    int blocksz)
 {
-  if (dec)
+  float *coeffs;
+
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
     {
-      if (dec->inst.numTaps)
-        {
-          free(dec->inst.pState);
-          free((void *)dec->inst.pCoeffs);
-        }
+      return NULL;
+    }
 
-      free(dec);
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_lpf((float)cutoff_freq / (float)fs, taps);
+  if (coeffs == NULL)
+    {
+      return NULL;
+    }
+
+  return prepare_firq31(taps, coeffs, blocksz);
+}
+
+/** fir_create_hpfq31() */
+
+fir_instanceq31_t * fir_create_hpfq31(int fs, int cutoff_freq, int tr_width,
+    int blocksz)
+{
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  return fir_create_hpfq31_tap(fs, cutoff_freq,
+                               tap_number(fs, tr_width), blocksz);
+}
+
+/** fir_create_hpfq31_tap() */
+
+fir_instanceq31_t * fir_create_hpfq31_tap(int fs, int cutoff_freq, int taps,
+    int blocksz)
+{
+  float *coeffs;
+
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_hpf((float)cutoff_freq / (float)fs, taps);
+  if (coeffs == NULL)
+    {
+      return NULL;
     }
+
+  return prepare_firq31(taps, coeffs, blocksz);
 }
 
+/** fir_create_bpfq31() */
+
+fir_instanceq31_t * fir_create_bpfq31(int fs, int lower_cutfreq,
+    int higher_cutfreq, int tr_width, int blocksz)
+{
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  return fir_create_bpfq31_tap(fs, lower_cutfreq, higher_cutfreq,
+                               tap_number(fs, tr_width), blocksz);
+}
+
+/** fir_create_bpfq31_tap() */
+
+fir_instanceq31_t * fir_create_bpfq31_tap(int fs, int lower_cutfreq,
+    int higher_cutfreq, int taps, int blocksz)
+{
+  float *coeffs;
+
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_bpf((float)lower_cutfreq / (float)fs,
+                          (float)higher_cutfreq / (float)fs, taps);
+  if (coeffs == NULL)
+    {
+      return NULL;
+    }
+
+  return prepare_firq31(taps, coeffs, blocksz);
+}
+
+/** fir_create_befq31() */
+
+fir_instanceq31_t * fir_create_befq31(int fs, int lower_cutfreq,
+    int higher_cutfreq, int tr_width, int blocksz)
+{
+  if ((tr_width <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  return fir_create_befq31_tap(fs, lower_cutfreq, higher_cutfreq,
+                               tap_number(fs, tr_width), blocksz);
+}
+
+/** fir_create_befq31_tap() */
+
+fir_instanceq31_t * fir_create_befq31_tap(int fs, int lower_cutfreq,
+    int higher_cutfreq, int taps, int blocksz)
+{
+  float *coeffs;
+
+  if ((taps <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_bef((float)lower_cutfreq / (float)fs,
+                          (float)higher_cutfreq / (float)fs, taps);
+  if (coeffs == NULL)
+    {
+      return NULL;
+    }
+
+  return prepare_firq31(taps, coeffs, blocksz);
+}
+
+/** fir_get_tapnumq31() */
+
+int fir_get_tapnumq31(fir_instanceq31_t *fir)
+{
+  return fir->numTaps;
+}
+
+/** fir_executeq31() */
+
+void fir_executeq31(fir_instanceq31_t *fir, q31_t *input, q31_t *output,
+    int len)
+{
+  arm_fir_fast_q31(fir, input, output, len);
+}
+
+/** firabs_executeq31() */
+
+void firabs_executeq31(fir_instanceq31_t *fir, q31_t *input, q31_t *output,
+    int len)
+{
+  arm_fir_fast_q31(fir, input, output, len);
+  arm_abs_q31(output, output, len);
+}
+
+/** fir_deleteq31() */
+
+void fir_deleteq31(fir_instanceq31_t *fir)
+{
+  if (fir)
+    {
+      free(fir->pState);
+      free((void *)fir->pCoeffs);
+      free(fir);
+    }
+}
+
+#endif  /* CONFIG_DIGITAL_FILTER_FIR */
+
+/****************************************************************************
+ * Decimation Filter
+ ****************************************************************************/
+
+#ifdef CONFIG_DIGITAL_FILTER_DECIMATOR
+
+/** create_decimatorf() */
+
+decimator_instancef_t *create_decimatorf(int fs, int dec_factor,
+    int tr_width, int blocksz)
+{
+  decimator_instancef_t *S;
+
+  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  S = create_decimatorf_tap(fs, dec_factor, tap_number(fs, tr_width), blocksz);
+
+  return S;
+}
+
+/** create_decimatorf_tap() */
+
+decimator_instancef_t *create_decimatorf_tap(int fs, int dec_factor,
+    int taps, int blocksz)
+{
+  decimator_instancef_t *S;
+  float *coeffs;
+
+  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  if (taps > 0)
+    {
+      taps = (taps & 0x01) ? taps : taps + 1;
+
+      coeffs = fir_coeffs_lpf(1.f / (float)(2 * dec_factor), taps);
+      if (coeffs == NULL)
+        {
+          return NULL;
+        }
+
+      S = prepare_decimator(dec_factor, taps, coeffs, blocksz);
+    }
+  else
+    {
+      S = (decimator_instancef_t *)malloc(sizeof(decimator_instancef_t));
+      if (S)
+        {
+          S->inst.numTaps = 0;
+          S->inst.M = dec_factor;
+        }
+    }
+
+  return S;
+}
+
+/** decimator_execute() */
+
+int decimator_executef(decimator_instancef_t *dec, float *input, int input_len,
+    float *output, int output_len)
+{
+  int i;
+  int output_sz = input_len / dec->inst.M;
+
+  if (output_len < output_sz)
+    {
+      return -1;
+    }
+
+  if (dec->inst.numTaps)
+    {
+      arm_fir_decimate_f32(&dec->inst, input, output, input_len);
+    }
+  else
+    {
+      /* Do without filter */
+
+      for (i = 0; i < output_sz; i++)
+        {
+          output[i] = input[i * dec->inst.M];
+        }
+    }
+
+  return output_sz;
+}
+
+/** decimator_tapnumf() */
+
+int decimator_tapnumf(decimator_instancef_t *dec)
+{
+  return dec->inst.numTaps;
+}
+
+/** decimator_deletef() */
+
+void decimator_deletef(decimator_instancef_t *dec)
+{
+  if (dec)
+    {
+      if (dec->inst.numTaps)
+        {
+          free(dec->inst.pState);
+          free((void *)dec->inst.pCoeffs);
+        }
+
+      free(dec);
+    }
+}
+
+/****************************************************************************
+ * Decimation Filter (q15)
+ ****************************************************************************/
+
+/** create_decimatorq15() */
+
+decimator_instanceq15_t *create_decimatorq15(int fs, int dec_factor,
+    int tr_width, int blocksz)
+{
+  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  return create_decimatorq15_tap(fs, dec_factor, tap_number(fs, tr_width),
+                                 blocksz);
+}
+
+/** create_decimatorq15_tap() */
+
+decimator_instanceq15_t *create_decimatorq15_tap(int fs, int dec_factor,
+    int taps, int blocksz)
+{
+  decimator_instanceq15_t *S;
+  float *coeffs = NULL;
+  q15_t *qcoeffs = NULL;
+  q15_t *state = NULL;
+
+  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  S = (decimator_instanceq15_t *)malloc(sizeof(decimator_instanceq15_t));
+  if (S == NULL)
+    {
+      return NULL;
+    }
+
+  if (taps <= 0)
+    {
+      S->inst.numTaps = 0;
+      S->inst.M = dec_factor;
+      return S;
+    }
+
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_lpf(1.f / (float)(2 * dec_factor), taps);
+  qcoeffs = (q15_t *)malloc(sizeof(q15_t) * taps);
+  state = (q15_t *)malloc(sizeof(q15_t) * (taps + blocksz - 1));
+  if (coeffs == NULL || qcoeffs == NULL || state == NULL)
+    {
+      goto error;
+    }
+
+  arm_float_to_q15(coeffs, qcoeffs, taps);
+
+  if (arm_fir_decimate_init_q15(&S->inst, taps, dec_factor, qcoeffs, state,
+                                blocksz) != ARM_MATH_SUCCESS)
+    {
+      goto error;
+    }
+
+  free(coeffs);
+  return S;
+
+error:
+  free(state);
+  free(qcoeffs);
+  free(coeffs);
+  free(S);
+  return NULL;
+}
+
+/** decimator_executeq15() */
+
+int decimator_executeq15(decimator_instanceq15_t *dec, q15_t *input,
+    int input_len, q15_t *output, int output_len)
+{
+  int i;
+  int output_sz = input_len / dec->inst.M;
+
+  if (output_len < output_sz)
+    {
+      return -1;
+    }
+
+  if (dec->inst.numTaps)
+    {
+      arm_fir_decimate_fast_q15(&dec->inst, input, output, input_len);
+    }
+  else
+    {
+      /* Do without filter */
+
+      for (i = 0; i < output_sz; i++)
+        {
+          output[i] = input[i * dec->inst.M];
+        }
+    }
+
+  return output_sz;
+}
+
+/** decimator_tapnumq15() */
+
+int decimator_tapnumq15(decimator_instanceq15_t *dec)
+{
+  return dec->inst.numTaps;
+}
+
+/** decimator_deleteq15() */
+
+void decimator_deleteq15(decimator_instanceq15_t *dec)
+{
+  if (dec)
+    {
+      if (dec->inst.numTaps)
+        {
+          free(dec->inst.pState);
+          free((void *)dec->inst.pCoeffs);
+        }
+
+      free(dec);
+    }
+}
+
+/****************************************************************************
+ * Decimation Filter (q31)
+ ****************************************************************************/
+
+/** create_decimatorq31() */
+
+decimator_instanceq31_t *create_decimatorq31(int fs, int dec_factor,
+    int tr_width, int blocksz)
+{
+  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  return create_decimatorq31_tap(fs, dec_factor, tap_number(fs, tr_width),
+                                 blocksz);
+}
+
+/** create_decimatorq31_tap() */
+
+decimator_instanceq31_t *create_decimatorq31_tap(int fs, int dec_factor,
+    int taps, int blocksz)
+{
+  decimator_instanceq31_t *S;
+  float *coeffs = NULL;
+  q31_t *qcoeffs = NULL;
+  q31_t *state = NULL;
+
+  if ((dec_factor <= 0) || (fs <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  S = (decimator_instanceq31_t *)malloc(sizeof(decimator_instanceq31_t));
+  if (S == NULL)
+    {
+      return NULL;
+    }
+
+  if (taps <= 0)
+    {
+      S->inst.numTaps = 0;
+      S->inst.M = dec_factor;
+      return S;
+    }
+
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  coeffs = fir_coeffs_lpf(1.f / (float)(2 * dec_factor), taps);
+  qcoeffs = (q31_t *)malloc(sizeof(q31_t) * taps);
+  state = (q31_t *)malloc(sizeof(q31_t) * (taps + blocksz - 1));
+  if (coeffs == NULL || qcoeffs == NULL || state == NULL)
+    {
+      goto error;
+    }
+
+  arm_float_to_q31(coeffs, qcoeffs, taps);
+
+  if (arm_fir_decimate_init_q31(&S->inst, taps, dec_factor, qcoeffs, state,
+                                blocksz) != ARM_MATH_SUCCESS)
+    {
+      goto error;
+    }
+
+  free(coeffs);
+  return S;
+
+error:
+  free(state);
+  free(qcoeffs);
+  free(coeffs);
+  free(S);
+  return NULL;
+}
+
+/** decimator_executeq31() */
+
+int decimator_executeq31(decimator_instanceq31_t *dec, q31_t *input,
+    int input_len, q31_t *output, int output_len)
+{
+  int i;
+  int output_sz = input_len / dec->inst.M;
+
+  if (output_len < output_sz)
+    {
+      return -1;
+    }
+
+  if (dec->inst.numTaps)
+    {
+      arm_fir_decimate_fast_q31(&dec->inst, input, output, input_len);
+    }
+  else
+    {
+      /* Do without filter */
+
+      for (i = 0; i < output_sz; i++)
+        {
+          output[i] = input[i * dec->inst.M];
+        }
+    }
+
+  return output_sz;
+}
+
+/** decimator_tapnumq31() */
+
+int decimator_tapnumq31(decimator_instanceq31_t *dec)
+{
+  return dec->inst.numTaps;
+}
+
+/** decimator_deleteq31() */
+
+void decimator_deleteq31(decimator_instanceq31_t *dec)
+{
+  if (dec)
+    {
+      if (dec->inst.numTaps)
+        {
+          free(dec->inst.pState);
+          free((void *)dec->inst.pCoeffs);
+        }
+
+      free(dec);
+    }
+}
+
+/****************************************************************************
+ * Multistage Decimation Filter
+ ****************************************************************************/
+
+typedef struct
+{
+  int stages;
+  int factor[DECIMATOR_MAX_STAGES];
+  int taps[DECIMATOR_MAX_STAGES];
+  float cost;
+} decimator_plan_t;
+
+/* Search all ordered factorizations of the remaining decimation factor
+ * and keep the one with the fewest MACs per output sample.
+ *
+ * A stage outputting at rate Fo only has to remove components which
+ * alias into the final pass band [0, fp], so its stop band starts at
+ * Fo - fp and the transition band is Fo - 2 * fp around Fo / 2.
+ * Its cost per final output sample is taps * Fo / fs_out.
+ */
+
+static void search_decimator_plan(float fs, float fs_out, float fp,
+                                  int remain, decimator_plan_t *cur,
+                                  decimator_plan_t *best)
+{
+  int d;
+  int taps;
+  float fo;
+  float cost;
+
+  for (d = 2; d <= remain; d++)
+    {
+      if (remain % d)
+        {
+          continue;
+        }
+
+      fo = fs / d;
+      taps = tap_number_norm((fo - 2.f * fp) / fs);
+      cost = cur->cost + (float)taps * fo / fs_out;
+
+      if (cost >= best->cost)
+        {
+          continue;
+        }
+
+      cur->factor[cur->stages] = d;
+      cur->taps[cur->stages] = taps;
+      cur->stages++;
+      cur->cost = cost;
+
+      if (remain == d)
+        {
+          *best = *cur;
+        }
+      else if (cur->stages < DECIMATOR_MAX_STAGES)
+        {
+          search_decimator_plan(fo, fs_out, fp, remain / d, cur, best);
+        }
+
+      cur->stages--;
+      cur->cost = cost - (float)taps * fo / fs_out;
+    }
+}
+
+/** create_multistage_decimatorf() */
+
+multistage_decimatorf_t *create_multistage_decimatorf(int fs, int dec_factor,
+    int tr_width, int blocksz)
+{
+  multistage_decimatorf_t *S;
+  decimator_plan_t cur;
+  decimator_plan_t best;
+  float fs_out;
+  float fp;
+  int i;
+
+  if ((dec_factor <= 1) || (fs <= 0) || (tr_width <= 0) || (blocksz <= 0)
+      || (blocksz % dec_factor))
+    {
+      return NULL;
+    }
+
+  fs_out = (float)fs / (float)dec_factor;
+  fp = (fs_out - (float)tr_width) / 2.f;
+  if (fp < 0.f)
+    {
+      fp = 0.f;
+    }
+
+  memset(&cur, 0, sizeof(cur));
+  memset(&best, 0, sizeof(best));
+  best.cost = INFINITY;
+
+  search_decimator_plan((float)fs, fs_out, fp, dec_factor, &cur, &best);
+  if (best.stages == 0)
+    {
+      /* dec_factor has more prime factors than DECIMATOR_MAX_STAGES */
+
+      return NULL;
+    }
+
+  S = (multistage_decimatorf_t *)calloc(1, sizeof(multistage_decimatorf_t));
+  if (S == NULL)
+    {
+      return NULL;
+    }
+
+  S->M = dec_factor;
+  S->blocksz = blocksz;
+
+  for (i = 0; i < best.stages; i++)
+    {
+      S->stage[i] = create_decimatorf_tap(fs, best.factor[i], best.taps[i],
+                                          blocksz);
+      if (S->stage[i] == NULL)
+        {
+          goto error;
+        }
+
+      S->stages++;
+      blocksz /= best.factor[i];
+    }
+
+  if (S->stages > 1)
+    {
+      /* The output of the first stage is the largest. */
+
+      blocksz = S->blocksz / best.factor[0];
+      S->work[0] = (float *)malloc(sizeof(float) * blocksz);
+      S->work[1] = (float *)malloc(sizeof(float) * blocksz);
+      if (S->work[0] == NULL || S->work[1] == NULL)
+        {
+          goto error;
+        }
+    }
+
+  return S;
+
+error:
+  multistage_decimator_deletef(S);
+  return NULL;
+}
+
+/** multistage_decimator_executef() */
+
+int multistage_decimator_executef(multistage_decimatorf_t *dec, float *input,
+    int input_len, float *output, int output_len)
+{
+  int output_sz = input_len / dec->M;
+  int pos;
+  int i;
+  int len;
+  float *src;
+  float *dst;
+
+  if (output_len < output_sz)
+    {
+      return -1;
+    }
+
+  for (pos = 0; pos + dec->blocksz <= input_len; pos += dec->blocksz)
+    {
+      src = &input[pos];
+      len = dec->blocksz;
+
+      for (i = 0; i < dec->stages; i++)
+        {
+          dst = (i == dec->stages - 1) ? output : dec->work[i & 0x01];
+
+          arm_fir_decimate_f32(&dec->stage[i]->inst, src, dst, len);
+
+          len /= dec->stage[i]->inst.M;
+          src = dst;
+        }
+
+      output += len;
+    }
+
+  return output_sz;
+}
+
+/** multistage_decimator_stagesf() */
+
+int multistage_decimator_stagesf(multistage_decimatorf_t *dec)
+{
+  return dec->stages;
+}
+
+/** multistage_decimator_stageinfof() */
+
+int multistage_decimator_stageinfof(multistage_decimatorf_t *dec, int stage,
+    int *factor, int *taps)
+{
+  if ((stage < 0) || (stage >= dec->stages))
+    {
+      return -1;
+    }
+
+  *factor = dec->stage[stage]->inst.M;
+  *taps = dec->stage[stage]->inst.numTaps;
+
+  return 0;
+}
+
+/** multistage_decimator_deletef() */
+
+void multistage_decimator_deletef(multistage_decimatorf_t *dec)
+{
+  int i;
+
+  if (dec)
+    {
+      for (i = 0; i < dec->stages; i++)
+        {
+          decimator_deletef(dec->stage[i]);
+        }
+
+      free(dec->work[0]);
+      free(dec->work[1]);
+      free(dec);
+    }
+}
+
+/****************************************************************************
+ * Polyphase Resampler
+ ****************************************************************************/
+
+#ifdef CONFIG_DIGITAL_FILTER_RESAMPLER
+
+static int gcd(int a, int b)
+{
+  int t;
+
+  while (b)
+    {
+      t = a % b;
+      a = b;
+      b = t;
+    }
+
+  return a;
+}
+
+/** create_resamplerf() */
+
+resampler_instancef_t *create_resamplerf(int fs_in, int fs_out,
+    int tr_width, int blocksz)
+{
+  int L;
+
+  if ((tr_width <= 0) || (fs_in <= 0) || (fs_out <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  /* The prototype filter works at the interpolated rate fs_in * L. */
+
+  L = fs_out / gcd(fs_in, fs_out);
+
+  return create_resamplerf_tap(fs_in, fs_out,
+      tap_number_norm((float)tr_width / ((float)fs_in * (float)L)), blocksz);
+}
+
+/** create_resamplerf_tap() */
+
+resampler_instancef_t *create_resamplerf_tap(int fs_in, int fs_out,
+    int taps, int blocksz)
+{
+  resampler_instancef_t *S;
+  float *proto;
+  int g;
+  int p;
+  int k;
+  int idx;
+
+  if ((taps <= 0) || (fs_in <= 0) || (fs_out <= 0) || (blocksz <= 0))
+    {
+      return NULL;
+    }
+
+  taps = (taps & 0x01) ? taps : taps + 1;
+
+  S = (resampler_instancef_t *)calloc(1, sizeof(resampler_instancef_t));
+  if (S == NULL)
+    {
+      return NULL;
+    }
+
+  g = gcd(fs_in, fs_out);
+  S->L = fs_out / g;
+  S->M = fs_in / g;
+  S->taps = taps;
+  S->phase_taps = (taps + S->L - 1) / S->L;
+  S->blocksz = blocksz;
+
+  /* Cut off at the lower Nyquist frequency of input and output. */
+
+  proto = fir_coeffs_lpf(1.f / (2.f * (float)((S->L > S->M) ? S->L : S->M)),
+                         taps);
+  S->coeffs = (float *)calloc(S->L * S->phase_taps, sizeof(float));
+  S->state = (float *)calloc(S->phase_taps - 1 + blocksz, sizeof(float));
+  if (proto == NULL || S->coeffs == NULL || S->state == NULL)
+    {
+      free(proto);
+      resampler_deletef(S);
+      return NULL;
+    }
+
+  /* Split the prototype into L phases. Each phase is stored in reverse
+   * order so that it can be applied by a dot product to the history.
+   * Interpolation by L lowers the gain by L, so it is compensated.
+   */
+
+  for (p = 0; p < S->L; p++)
+    {
+      for (k = 0; k < S->phase_taps; k++)
+        {
+          idx = p + k * S->L;
+          if (idx < taps)
+            {
+              S->coeffs[p * S->phase_taps + (S->phase_taps - 1 - k)] =
+                proto[idx] * (float)S->L;
+            }
+        }
+    }
+
+  free(proto);
+
+  return S;
+}
+
+/** resampler_outlenf() */
+
+int resampler_outlenf(resampler_instancef_t *rs, int input_len)
+{
+  long long t0 = (long long)rs->pos * rs->L + rs->phase;
+  long long end = (long long)input_len * rs->L;
+
+  if (t0 >= end)
+    {
+      return 0;
+    }
+
+  return (int)((end - t0 - 1) / rs->M + 1);
+}
+
+/** resampler_executef() */
+
+int resampler_executef(resampler_instancef_t *rs, float *input, int input_len,
+    float *output, int output_len)
+{
+  int output_sz = resampler_outlenf(rs, input_len);
+  int hist = rs->phase_taps - 1;
+  int len;
+
+  if (output_len < output_sz)
+    {
+      return -1;
+    }
+
+  while (input_len > 0)
+    {
+      len = (input_len < rs->blocksz) ? input_len : rs->blocksz;
+
+      memcpy(&rs->state[hist], input, sizeof(float) * len);
+
+      /* state[pos + phase_taps - 1] is the current input sample. */
+
+      while (rs->pos < len)
+        {
+          arm_dot_prod_f32(&rs->coeffs[rs->phase * rs->phase_taps],
+                           &rs->state[rs->pos], rs->phase_taps, output++);
+
+          rs->phase += rs->M;
+          rs->pos += rs->phase / rs->L;
+          rs->phase %= rs->L;
+        }
+
+      rs->pos -= len;
+      memmove(rs->state, &rs->state[len], sizeof(float) * hist);
+
+      input += len;
+      input_len -= len;
+    }
+
+  return output_sz;
+}
+
+/** resampler_tapnumf() */
+
+int resampler_tapnumf(resampler_instancef_t *rs)
+{
+  return rs->taps;
+}
+
+/** resampler_deletef() */
+
+void resampler_deletef(resampler_instancef_t *rs)
+{
+  if (rs)
+    {
+      free(rs->coeffs);
+      free(rs->state);
+      free(rs);
+    }
+}
+
+#endif  /* CONFIG_DIGITAL_FILTER_RESAMPLER */
+
 #endif  /* CONFIG_DIGITAL_FILTER_DECIMATOR */
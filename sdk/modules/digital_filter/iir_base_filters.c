@@ -0,0 +1,512 @@
+/****************************************************************************
+ * modules/digital_filter/iir_base_filters.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <arm_math.h>
+
+#include <digital_filter/iir_filter.h>
+
+#ifdef CONFIG_DIGITAL_FILTER_IIR
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define IIR_MAX_ORDER   (32)
+#define BIQUAD_COEFFS   (5)   /* b0, b1, b2, -a1, -a2 */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum iir_type_e
+{
+  IIR_TYPE_LPF = 0,
+  IIR_TYPE_HPF,
+  IIR_TYPE_BPF,
+  IIR_TYPE_BEF,
+};
+
+typedef struct
+{
+  double re;
+  double im;
+} cplx_t;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static cplx_t cplx(double re, double im)
+{
+  cplx_t c;
+
+  c.re = re;
+  c.im = im;
+
+  return c;
+}
+
+static cplx_t cplx_add(cplx_t a, cplx_t b)
+{
+  return cplx(a.re + b.re, a.im + b.im);
+}
+
+static cplx_t cplx_sub(cplx_t a, cplx_t b)
+{
+  return cplx(a.re - b.re, a.im - b.im);
+}
+
+static cplx_t cplx_mul(cplx_t a, cplx_t b)
+{
+  return cplx(a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re);
+}
+
+static cplx_t cplx_div(cplx_t a, cplx_t b)
+{
+  double d = b.re * b.re + b.im * b.im;
+
+  return cplx((a.re * b.re + a.im * b.im) / d,
+              (a.im * b.re - a.re * b.im) / d);
+}
+
+static cplx_t cplx_conj(cplx_t a)
+{
+  return cplx(a.re, -a.im);
+}
+
+static cplx_t cplx_sqrt(cplx_t a)
+{
+  double r = sqrt(sqrt(a.re * a.re + a.im * a.im));
+  double th = atan2(a.im, a.re) / 2.0;
+
+  return cplx(r * cos(th), r * sin(th));
+}
+
+/* Analog low pass prototype pole (cut off 1 rad/s).
+ * eps == 0 gives Butterworth, otherwise Chebyshev type I.
+ */
+
+static cplx_t prototype_pole(int k, int order, double eps)
+{
+  double theta = M_PI * (2 * k + 1) / (2 * order);
+  double mu;
+
+  if (eps == 0.0)
+    {
+      return cplx(-sin(theta), cos(theta));
+    }
+
+  mu = asinh(1.0 / eps) / order;
+
+  return cplx(-sinh(mu) * sin(theta), cosh(mu) * cos(theta));
+}
+
+/* Bilinear transform. Analog frequencies are pre-warped as tan(pi*f/fs),
+ * so z = (1 + s) / (1 - s).
+ */
+
+static cplx_t bilinear(cplx_t s)
+{
+  return cplx_div(cplx_add(cplx(1.0, 0.0), s), cplx_sub(cplx(1.0, 0.0), s));
+}
+
+static void set_section(float *coeffs, const double *b, cplx_t p1, cplx_t p2,
+                        bool first_order)
+{
+  cplx_t z1 = bilinear(p1);
+  cplx_t z2 = bilinear(p2);
+
+  coeffs[0] = b[0];
+  coeffs[1] = b[1];
+  coeffs[2] = b[2];
+
+  /* CMSIS expects negated feedback coefficients. */
+
+  if (first_order)
+    {
+      coeffs[3] = z1.re;
+      coeffs[4] = 0.f;
+    }
+  else
+    {
+      coeffs[3] = cplx_add(z1, z2).re;
+      coeffs[4] = -cplx_mul(z1, z2).re;
+    }
+}
+
+/* Response of the cascade at z = exp(j * w) */
+
+static double cascade_gain(const float *coeffs, int stages, double w)
+{
+  cplx_t z1 = cplx(cos(w), -sin(w));   /* z^-1 */
+  cplx_t z2 = cplx_mul(z1, z1);        /* z^-2 */
+  cplx_t h = cplx(1.0, 0.0);
+  cplx_t num;
+  cplx_t den;
+  int i;
+
+  for (i = 0; i < stages; i++, coeffs += BIQUAD_COEFFS)
+    {
+      num = cplx_add(cplx(coeffs[0], 0.0),
+                     cplx_add(cplx_mul(cplx(coeffs[1], 0.0), z1),
+                              cplx_mul(cplx(coeffs[2], 0.0), z2)));
+      den = cplx_sub(cplx(1.0, 0.0),
+                     cplx_add(cplx_mul(cplx(coeffs[3], 0.0), z1),
+                              cplx_mul(cplx(coeffs[4], 0.0), z2)));
+      h = cplx_mul(h, cplx_div(num, den));
+    }
+
+  return sqrt(h.re * h.re + h.im * h.im);
+}
+
+/* Split the analog pole s of a band transform into a section.
+ * Complex prototype poles give two sections (s1, s1*) and (s2, s2*),
+ * a real prototype pole gives one section (s1, s2).
+ */
+
+static int set_band_sections(float *coeffs, const double *b, cplx_t q,
+                             double w0, bool real_pole)
+{
+  cplx_t d = cplx_sqrt(cplx_sub(cplx_mul(q, q), cplx(w0 * w0, 0.0)));
+  cplx_t s1 = cplx_add(q, d);
+  cplx_t s2 = cplx_sub(q, d);
+
+  if (real_pole)
+    {
+      set_section(coeffs, b, s1, s2, false);
+      return 1;
+    }
+
+  set_section(coeffs, b, s1, cplx_conj(s1), false);
+  set_section(coeffs + BIQUAD_COEFFS, b, s2, cplx_conj(s2), false);
+
+  return 2;
+}
+
+static iir_instancef_t * design_iir(int type, int fs, int f1, int f2,
+                                    int order, float ripple_db)
+{
+  static const double b_lpf[2][3] =
+    {
+      { 1.0,  2.0, 1.0 }, { 1.0,  1.0, 0.0 }
+    };
+  static const double b_hpf[2][3] =
+    {
+      { 1.0, -2.0, 1.0 }, { 1.0, -1.0, 0.0 }
+    };
+  static const double b_bpf[3] =
+    {
+      1.0, 0.0, -1.0
+    };
+
+  iir_instancef_t *S;
+  float *coeffs;
+  float *state;
+  double eps = 0.0;
+  double w1;
+  double w2;
+  double w0 = 0.0;
+  double bw = 0.0;
+  double b_bef[3];
+  double ref_w;
+  double target;
+  double gain;
+  cplx_t p;
+  bool real_pole;
+  int stages;
+  int n;
+  int k;
+
+  if ((fs <= 0) || (order <= 0) || (order > IIR_MAX_ORDER)
+      || (f1 <= 0) || (2 * f1 >= fs))
+    {
+      return NULL;
+    }
+
+  if ((type == IIR_TYPE_BPF || type == IIR_TYPE_BEF)
+      && ((f2 <= f1) || (2 * f2 >= fs)))
+    {
+      return NULL;
+    }
+
+  if (ripple_db < 0.f)
+    {
+      return NULL;
+    }
+  else if (ripple_db > 0.f)
+    {
+      eps = sqrt(pow(10.0, ripple_db / 10.0) - 1.0);
+    }
+
+  /* Pre-warped analog frequencies */
+
+  w1 = tan(M_PI * f1 / fs);
+  w2 = tan(M_PI * f2 / fs);
+
+  if (type == IIR_TYPE_LPF || type == IIR_TYPE_HPF)
+    {
+      stages = (order + 1) / 2;
+    }
+  else
+    {
+      stages = order;
+      w0 = sqrt(w1 * w2);
+      bw = w2 - w1;
+    }
+
+  S = (iir_instancef_t *)malloc(sizeof(iir_instancef_t));
+  coeffs = (float *)malloc(sizeof(float) * BIQUAD_COEFFS * stages);
+  state = (float *)malloc(sizeof(float) * 2 * stages);
+  if (S == NULL || coeffs == NULL || state == NULL)
+    {
+      free(S);
+      free(coeffs);
+      free(state);
+      return NULL;
+    }
+
+  /* Zeros of the band elimination filter are at the center frequency. */
+
+  b_bef[0] = 1.0;
+  b_bef[1] = -2.0 * cos(2.0 * atan(w0));
+  b_bef[2] = 1.0;
+
+  /* Use the prototype poles in the upper half plane and the real one. */
+
+  for (k = 0, n = 0; k < (order + 1) / 2; k++)
+    {
+      p = prototype_pole(k, order, eps);
+      real_pole = (2 * k + 1 == order);
+      if (real_pole)
+        {
+          p.im = 0.0;
+        }
+
+      switch (type)
+        {
+          case IIR_TYPE_LPF:
+            p = cplx_mul(p, cplx(w1, 0.0));
+            set_section(&coeffs[n * BIQUAD_COEFFS], b_lpf[real_pole],
+                        p, cplx_conj(p), real_pole);
+            n++;
+            break;
+
+          case IIR_TYPE_HPF:
+            p = cplx_div(cplx(w1, 0.0), p);
+            set_section(&coeffs[n * BIQUAD_COEFFS], b_hpf[real_pole],
+                        p, cplx_conj(p), real_pole);
+            n++;
+            break;
+
+          case IIR_TYPE_BPF:
+            n += set_band_sections(&coeffs[n * BIQUAD_COEFFS], b_bpf,
+                                   cplx_mul(p, cplx(bw / 2.0, 0.0)),
+                                   w0, real_pole);
+            break;
+
+          default:
+            n += set_band_sections(&coeffs[n * BIQUAD_COEFFS], b_bef,
+                                   cplx_div(cplx(bw / 2.0, 0.0), p),
+                                   w0, real_pole);
+            break;
+        }
+    }
+
+  /* Normalize the pass band gain. Even order Chebyshev filters start
+   * at the bottom of the ripple.
+   */
+
+  switch (type)
+    {
+      case IIR_TYPE_HPF:
+        ref_w = M_PI;
+        break;
+
+      case IIR_TYPE_BPF:
+        ref_w = 2.0 * atan(w0);
+        break;
+
+      default:
+        ref_w = 0.0;
+        break;
+    }
+
+  target = ((eps != 0.0) && !(order & 0x01)) ?
+           1.0 / sqrt(1.0 + eps * eps) : 1.0;
+
+  gain = target / cascade_gain(coeffs, stages, ref_w);
+  coeffs[0] *= gain;
+  coeffs[1] *= gain;
+  coeffs[2] *= gain;
+
+  arm_biquad_cascade_df2T_init_f32(S, stages, coeffs, state);
+
+  return S;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/** iir_create_lpff() */
+
+iir_instancef_t * iir_create_lpff(int fs, int cutoff_freq, int order)
+{
+  return design_iir(IIR_TYPE_LPF, fs, cutoff_freq, 0, order, 0.f);
+}
+
+/** iir_create_lpff_cheby() */
+
+iir_instancef_t * iir_create_lpff_cheby(int fs, int cutoff_freq, int order,
+    float ripple_db)
+{
+  if (ripple_db <= 0.f)
+    {
+      return NULL;
+    }
+
+  return design_iir(IIR_TYPE_LPF, fs, cutoff_freq, 0, order, ripple_db);
+}
+
+/** iir_create_hpff() */
+
+iir_instancef_t * iir_create_hpff(int fs, int cutoff_freq, int order)
+{
+  return design_iir(IIR_TYPE_HPF, fs, cutoff_freq, 0, order, 0.f);
+}
+
+/** iir_create_hpff_cheby() */
+
+iir_instancef_t * iir_create_hpff_cheby(int fs, int cutoff_freq, int order,
+    float ripple_db)
+{
+  if (ripple_db <= 0.f)
+    {
+      return NULL;
+    }
+
+  return design_iir(IIR_TYPE_HPF, fs, cutoff_freq, 0, order, ripple_db);
+}
+
+/** iir_create_bpff() */
+
+iir_instancef_t * iir_create_bpff(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order)
+{
+  return design_iir(IIR_TYPE_BPF, fs, lower_cutfreq, higher_cutfreq,
+                    order, 0.f);
+}
+
+/** iir_create_bpff_cheby() */
+
+iir_instancef_t * iir_create_bpff_cheby(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order, float ripple_db)
+{
+  if (ripple_db <= 0.f)
+    {
+      return NULL;
+    }
+
+  return design_iir(IIR_TYPE_BPF, fs, lower_cutfreq, higher_cutfreq,
+                    order, ripple_db);
+}
+
+/** iir_create_beff() */
+
+iir_instancef_t * iir_create_beff(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order)
+{
+  return design_iir(IIR_TYPE_BEF, fs, lower_cutfreq, higher_cutfreq,
+                    order, 0.f);
+}
+
+/** iir_create_beff_cheby() */
+
+iir_instancef_t * iir_create_beff_cheby(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order, float ripple_db)
+{
+  if (ripple_db <= 0.f)
+    {
+      return NULL;
+    }
+
+  return design_iir(IIR_TYPE_BEF, fs, lower_cutfreq, higher_cutfreq,
+                    order, ripple_db);
+}
+
+/** iir_get_stagenumf() */
+
+int iir_get_stagenumf(iir_instancef_t *iir)
+{
+  return iir->numStages;
+}
+
+/** iir_executef() */
+
+void iir_executef(iir_instancef_t *iir, float *input, float *output, int len)
+{
+  arm_biquad_cascade_df2T_f32(iir, input, output, len);
+}
+
+/** iir_resetf() */
+
+void iir_resetf(iir_instancef_t *iir)
+{
+  memset(iir->pState, 0, sizeof(float) * 2 * iir->numStages);
+}
+
+/** iir_deletef() */
+
+void iir_deletef(iir_instancef_t *iir)
+{
+  if (iir)
+    {
+      free(iir->pState);
+      free((void *)iir->pCoeffs);
+      free(iir);
+    }
+}
+
+#endif  /* CONFIG_DIGITAL_FILTER_IIR */
@@ -156,6 +156,12 @@ nn_variable_t *dnn_runtime_output_variable(dnn_runtime_t * rt,
                                               rt, data_index);
 }
 
+int dnn_runtime_profile(dnn_runtime_t * rt, dnn_layer_profile_t * profile,
+                        unsigned short profile_num)
+{
+  return -EPERM;
+}
+
 int dnn_asmp_mallinfo(unsigned char array_length, dnn_mallinfo_t * info_array)
 {
   return dnn_mpmgr_call_api(DNNRT_API_ASMP_MALLINFO, 2, array_length,
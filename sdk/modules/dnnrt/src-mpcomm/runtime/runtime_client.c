@@ -208,6 +208,13 @@ nn_variable_t *dnn_runtime_output_variable(dnn_runtime_t *rt,
                                              2, rt, data_index);
 }
 
+int dnn_runtime_profile(dnn_runtime_t *rt, dnn_layer_profile_t *profile,
+                        unsigned short profile_num)
+{
+  return dnn_supervisor_send_msg(DNNRT_MSG_NRT_PROFILE, 3, rt, profile,
+                                 profile_num);
+}
+
 int dnn_asmp_mallinfo(unsigned char array_length, dnn_mallinfo_t *info_array)
 {
   return dnn_supervisor_send_msg(DNNRT_MSG_NRT_ASMP_MALLINFO, 2,
@@ -57,6 +57,7 @@ typedef enum
   DNNRT_MSG_NRT_OUTPUT_BUFFER,
   DNNRT_MSG_NRT_OUTPUT_VARIABLE,
   DNNRT_MSG_NRT_ASMP_MALLINFO,
+  DNNRT_MSG_NRT_PROFILE,
 } dnn_msg_id_t;
 
 typedef struct dnn_msg
@@ -50,12 +50,44 @@
 #include "dnn_controller.h"
 #include "dnn_exec_function.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Cycle counter of the Cortex-M4 Data Watchpoint and Trace unit */
+
+#define DEMCR                 (*(volatile uint32_t *)0xe000edfc)
+#define DEMCR_TRCENA          (1 << 24)
+#define DWT_CTRL              (*(volatile uint32_t *)0xe0001000)
+#define DWT_CTRL_CYCCNTENA    (1 << 0)
+#define DWT_CYCCNT            (*(volatile uint32_t *)0xe0001004)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef struct dnn_alloc_callback
+{
+  nn_function_type_t type;
+  rt_return_value_t (*alloc)(nn_network_t *net, void *function_context);
+} dnn_alloc_callback_t;
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
 static dnn_controller_context_t dnn_controller_ctx;
 
+static const dnn_alloc_callback_t dnn_alloc_callbacks[] =
+{
+  {NN_FUNCTION_CONVOLUTION, dnnrt_convolution_alloc},
+  {NN_FUNCTION_CONVOLUTION_0, dnnrt_convolution_alloc},
+  {NN_FUNCTION_AFFINE, dnnrt_affine_alloc},
+  {NN_FUNCTION_MAX_POOLING, dnnrt_max_pooling_alloc},
+  {NN_FUNCTION_RELU, dnnrt_relu_alloc},
+  {NN_FUNCTION_BATCH_NORMALIZATION, dnnrt_batch_normalization_alloc},
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -116,10 +148,187 @@ static void dnn_initialize_helpers(void)
     }
 }
 
+static void dnn_cycle_counter_enable(void)
+{
+  DEMCR |= DEMCR_TRCENA;
+  DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+static void dnn_graph_destroy(dnn_graph_t *graph)
+{
+  if (graph->layers)
+    {
+      dnn_controller_free(graph->layers);
+    }
+
+  if (graph->profile)
+    {
+      dnn_controller_free(graph->profile);
+    }
+
+  dnn_controller_free(graph);
+}
+
+/* Build the execution plan of a runtime. Each function gets a layer, and
+ * the elementwise functions following it are chained to the layer, so that
+ * they can run in the same tasks without another barrier.
+ */
+
+static dnn_graph_t *dnn_graph_create(rt_context_pointer rt_ctx)
+{
+  rt_context_t *c = (rt_context_t *)rt_ctx;
+  dnn_graph_t *graph;
+  int n = c->num_of_functions;
+  int i;
+  int j;
+
+  if (n <= 0)
+    {
+      return NULL;
+    }
+
+  graph = (dnn_graph_t *)dnn_controller_malloc(sizeof(dnn_graph_t));
+  if (graph == NULL)
+    {
+      return NULL;
+    }
+
+  memset(graph, 0, sizeof(dnn_graph_t));
+  graph->rt_ctx = rt_ctx;
+  graph->func_num = n;
+  graph->layers =
+    (dnn_layer_t *)dnn_controller_malloc(sizeof(dnn_layer_t) * n);
+  graph->profile = (dnn_layer_profile_t *)
+    dnn_controller_malloc(sizeof(dnn_layer_profile_t) * n);
+  if (graph->layers == NULL || graph->profile == NULL)
+    {
+      dnn_graph_destroy(graph);
+      return NULL;
+    }
+
+  memset(graph->profile, 0, sizeof(dnn_layer_profile_t) * n);
+
+  for (i = 0; i < n; ++i)
+    {
+      dnn_layer_setup(&graph->layers[i], &c->functions[i].func);
+      graph->profile[i].function_type = c->functions[i].info->type;
+    }
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = i + 1; j < n; ++j)
+        {
+          if (dnn_layer_chain(&graph->layers[i], &c->functions[j].func))
+            {
+              break;
+            }
+        }
+    }
+
+  return graph;
+}
+
+static dnn_graph_t *dnn_graph_find(void *rt_ctx)
+{
+  dnn_controller_context_t *ctx = dnn_controller_get_context();
+  dnn_graph_t *graph;
+
+  for (graph = ctx->graphs; graph != NULL; graph = graph->next)
+    {
+      if (graph->rt_ctx == rt_ctx)
+        {
+          return graph;
+        }
+    }
+
+  return NULL;
+}
+
+static void dnn_graph_register(dnn_graph_t *graph)
+{
+  dnn_controller_context_t *ctx = dnn_controller_get_context();
+
+  graph->next = ctx->graphs;
+  ctx->graphs = graph;
+}
+
+static void dnn_graph_unregister(void *rt_ctx)
+{
+  dnn_controller_context_t *ctx = dnn_controller_get_context();
+  dnn_graph_t **prev = &ctx->graphs;
+  dnn_graph_t *graph;
+
+  for (graph = ctx->graphs; graph != NULL; graph = graph->next)
+    {
+      if (graph->rt_ctx == rt_ctx)
+        {
+          *prev = graph->next;
+          dnn_graph_destroy(graph);
+          return;
+        }
+
+      prev = &graph->next;
+    }
+}
+
+/* Run the layers in order and record the cycles each of them took on the
+ * controller. A chained function is accounted to the layer it ran in.
+ */
+
+static int dnn_graph_forward(dnn_graph_t *graph)
+{
+  dnn_layer_t *layer;
+  dnn_layer_profile_t *profile;
+  rt_function_error_t ret;
+  uint32_t start;
+  int n;
+  int i;
+  int k;
+
+  for (i = 0; i < graph->func_num; i += n)
+    {
+      layer = &graph->layers[i];
+      profile = &graph->profile[i];
+      start = DWT_CYCCNT;
+
+      if (layer->type[0] == 0)
+        {
+          ret = layer->func[0]->exec_func(layer->func[0]);
+          layer->task_num = 1;
+          n = 1;
+        }
+      else
+        {
+          ret = dnn_layer_exec(layer, layer->chain_num);
+          n = layer->active_num;
+        }
+
+      if (ret != RT_FUNCTION_ERROR_NOERROR)
+        {
+          return -EIO;
+        }
+
+      profile->cycles = DWT_CYCCNT - start;
+      profile->task_num = layer->task_num;
+      profile->chained = 0;
+
+      for (k = 1; k < n; ++k)
+        {
+          profile[k].cycles = 0;
+          profile[k].task_num = layer->task_num;
+          profile[k].chained = 1;
+        }
+    }
+
+  return RT_RET_NOERROR;
+}
+
 static int dnn_runtime_initialize(dnn_runtime_t *rt,
                                   const nn_network_t *network)
 {
+  int i;
   int ret;
+  dnn_graph_t *graph;
   dnn_vbuffer_alloc_info_t alloc_info = {0};
   dnn_controller_context_t *ctx = dnn_controller_get_context();
 
@@ -165,37 +374,19 @@ static int dnn_runtime_initialize(dnn_runtime_t *rt,
 
   rt_context_pointer rt_ctx = (rt_context_pointer)(rt->impl_ctx);
 
-  ret = (int)rt_add_callback(rt_ctx, NN_FUNCTION_CONVOLUTION,
-                             dnnrt_convolution_alloc);
-  if (ret != RT_RET_NOERROR)
-    {
-      dnn_deallocate_chunks(&alloc_info);
-      rt_free_context(&rt->impl_ctx);
-      rt->impl_ctx = NULL;
-      dnn_destroy_unused_chunks();
-      return ret;
-    }
-
-  ret = (int)rt_add_callback(rt_ctx, NN_FUNCTION_CONVOLUTION_0,
-                             dnnrt_convolution_alloc);
-  if (ret != RT_RET_NOERROR)
-    {
-      dnn_deallocate_chunks(&alloc_info);
-      rt_free_context(&rt->impl_ctx);
-      rt->impl_ctx = NULL;
-      dnn_destroy_unused_chunks();
-      return ret;
-    }
-
-  ret = (int)rt_add_callback(rt_ctx, NN_FUNCTION_AFFINE,
-                             dnnrt_affine_alloc);
-  if (ret != RT_RET_NOERROR)
+  for (i = 0; i < (int)(sizeof(dnn_alloc_callbacks) /
+                         sizeof(dnn_alloc_callbacks[0])); ++i)
     {
-      dnn_deallocate_chunks(&alloc_info);
-      rt_free_context(&rt->impl_ctx);
-      rt->impl_ctx = NULL;
-      dnn_destroy_unused_chunks();
-      return ret;
+      ret = (int)rt_add_callback(rt_ctx, dnn_alloc_callbacks[i].type,
+                                 dnn_alloc_callbacks[i].alloc);
+      if (ret != RT_RET_NOERROR)
+        {
+          dnn_deallocate_chunks(&alloc_info);
+          rt_free_context(&rt->impl_ctx);
+          rt->impl_ctx = NULL;
+          dnn_destroy_unused_chunks();
+          return ret;
+        }
     }
 
   dnn_scratch_buffer_request_size(0);
@@ -214,6 +405,16 @@ static int dnn_runtime_initialize(dnn_runtime_t *rt,
 
   dnn_initialize_helpers();
 
+  /* Without a plan, forward falls back to the serial function loop */
+
+  graph = dnn_graph_create(rt_ctx);
+  if (graph != NULL)
+    {
+      dnn_graph_register(graph);
+    }
+
+  dnn_cycle_counter_enable();
+
   return ret;
 }
 
@@ -224,6 +425,7 @@ static int dnn_runtime_finalize(dnn_runtime_t *rt)
       return -EINVAL;
     }
 
+  dnn_graph_unregister(rt->impl_ctx);
   dnn_scratch_buffer_destroy();
 
   return (int)rt_free_context((rt_context_pointer *)&(rt->impl_ctx));
@@ -251,9 +453,44 @@ static int dnn_runtime_forward(dnn_runtime_t *rt,
       c->variables[c->input_variable_ids[i]].data = (void *)inputs[i];
     }
 
+  dnn_graph_t *graph = dnn_graph_find(ctx);
+  if (graph != NULL)
+    {
+      return dnn_graph_forward(graph);
+    }
+
   return (int)rt_forward(ctx);
 }
 
+static int dnn_runtime_profile(dnn_runtime_t *rt,
+                               dnn_layer_profile_t *profile,
+                               unsigned short profile_num)
+{
+  if (rt == NULL)
+    {
+      return -EINVAL;
+    }
+
+  dnn_graph_t *graph = dnn_graph_find(rt->impl_ctx);
+  if (graph == NULL)
+    {
+      return -ENOENT;
+    }
+
+  if (profile != NULL)
+    {
+      if (profile_num > graph->func_num)
+        {
+          profile_num = graph->func_num;
+        }
+
+      memcpy(profile, graph->profile,
+             sizeof(dnn_layer_profile_t) * profile_num);
+    }
+
+  return graph->func_num;
+}
+
 static int dnn_runtime_input_num(dnn_runtime_t *rt)
 {
   if (rt == NULL)
@@ -470,6 +707,13 @@ void dnn_controller_handle_msg(void *data)
                                            (unsigned char)dnn_msg->arg[1]);
         break;
 
+      case DNNRT_MSG_NRT_PROFILE:
+        dnn_msg->ret =
+          dnn_runtime_profile((dnn_runtime_t *)dnn_msg->arg[0],
+                              (dnn_layer_profile_t *)dnn_msg->arg[1],
+                              (unsigned short)dnn_msg->arg[2]);
+        break;
+
       default:
         dnn_msg->ret = -EINVAL;
         break;
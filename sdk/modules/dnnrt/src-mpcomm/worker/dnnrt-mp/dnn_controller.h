@@ -42,6 +42,7 @@
 
 #include "dnn_variable_buffer.h"
 #include "dnn_scratch_buffer.h"
+#include "dnn_exec_function.h"
 
 /****************************************************************************
  * Public Types
@@ -52,6 +53,16 @@ typedef struct dnn_runtime
   void *impl_ctx;
 } dnn_runtime_t;
 
+/* Keep in sync with dnn_layer_profile_t in dnnrt/runtime.h */
+
+typedef struct dnn_layer_profile
+{
+  unsigned short function_type;
+  unsigned char task_num;
+  unsigned char chained;
+  unsigned long cycles;
+} dnn_layer_profile_t;
+
 typedef enum
 {
   DNNRT_MSG_NRT_INIT,
@@ -68,6 +79,8 @@ typedef enum
   DNNRT_MSG_NRT_OUTPUT_SHAPE,
   DNNRT_MSG_NRT_OUTPUT_BUFFER,
   DNNRT_MSG_NRT_OUTPUT_VARIABLE,
+  DNNRT_MSG_NRT_ASMP_MALLINFO,
+  DNNRT_MSG_NRT_PROFILE,
 } dnn_msg_id_t;
 
 typedef enum
@@ -75,6 +88,10 @@ typedef enum
   DNN_HELPER_MSG_INIT,
   DNN_HELPER_EXEC_AFFINE,
   DNN_HELPER_EXEC_CONVOLUTION,
+  DNN_HELPER_EXEC_MAX_POOLING,
+  DNN_HELPER_EXEC_RELU,
+  DNN_HELPER_EXEC_BATCH_NORMALIZATION,
+  DNN_HELPER_EXEC_LAYER,
 } dnn_helper_msg_id_t;
 
 typedef struct dnn_msg
@@ -84,12 +101,26 @@ typedef struct dnn_msg
   int ret;
 } dnn_msg_t;
 
+/* Execution plan of a runtime: one layer per function, where a layer can
+ * absorb the functions following it, and the timing of the last forward.
+ */
+
+typedef struct dnn_graph
+{
+  void *rt_ctx;
+  int func_num;
+  dnn_layer_t *layers;
+  dnn_layer_profile_t *profile;
+  struct dnn_graph *next;
+} dnn_graph_t;
+
 typedef struct dnn_controller_context
 {
   uint8_t helpers_num;
   dnn_shared_chunk_t *chunks;
   dnn_vbuffer_alloc_info_t *alloc_info;
   void *helpers_exec_function[MAX_HELPERS_NUM];
+  dnn_graph_t *graphs;
 } dnn_controller_context_t;
 
 /****************************************************************************
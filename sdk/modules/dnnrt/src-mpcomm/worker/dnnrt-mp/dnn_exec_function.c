@@ -38,7 +38,6 @@
  ****************************************************************************/
 
 #include <errno.h>
-#include <math.h>
 #include <string.h>
 
 #include <mpcomm/mpcomm.h>
@@ -46,6 +45,7 @@
 #include "dnn_controller.h"
 #include "dnn_exec_function.h"
 
+#include <nnablart/functions.h>
 #include <implements/neural_network/affine/affine_internal.h>
 #include <implements/neural_network/convolution/convolution_internal.h>
 
@@ -53,85 +53,131 @@
  * Private Functions
  ****************************************************************************/
 
-static int controller_exec_function(rt_function_t *rt_func,
-                                    int func_type,
-                                    int begin,
-                                    int end)
+static rt_function_error_t exec_function_task(rt_function_t *rt_func,
+                                              int func_type,
+                                              int begin,
+                                              int end)
 {
   switch (func_type)
     {
       case DNN_HELPER_EXEC_AFFINE:
-        dnnrt_exec_affine(rt_func, begin, end);
-        break;
+        return dnnrt_exec_affine(rt_func, begin, end);
       case DNN_HELPER_EXEC_CONVOLUTION:
-        dnnrt_exec_convolution(rt_func, begin, end);
-        break;
+        return dnnrt_exec_convolution(rt_func, begin, end);
+      case DNN_HELPER_EXEC_MAX_POOLING:
+        return dnnrt_exec_max_pooling(rt_func, begin, end);
+      case DNN_HELPER_EXEC_RELU:
+        return dnnrt_exec_relu(rt_func, begin, end);
+      case DNN_HELPER_EXEC_BATCH_NORMALIZATION:
+        return dnnrt_exec_batch_normalization(rt_func, begin, end);
       default:
-        break;
+        return RT_FUNCTION_ERROR_UNIMPLEMENTED;
     }
-
-  return 0;
 }
 
-static int exec_dnn_tasks(rt_function_t *rt_func,
-                          int func_type,
-                          dnn_task_t tasks[],
-                          int task_num)
+/* Run the tasks and return the first error of them. The controller's own
+ * task is checked before the helpers' ones, but all the helpers are waited
+ * for, because they use dnn_msg on this stack.
+ */
+
+static rt_function_error_t exec_dnn_tasks(dnn_layer_t *layer,
+                                          dnn_task_t tasks[],
+                                          int task_num)
 {
   int i;
+  int ret;
   dnn_msg_t dnn_msg[MAX_HELPERS_NUM];
 
-  for (i = 0; i < task_num; ++i)
+  /* The last task runs on the controller while the helpers run the
+   * others, so only task_num - 1 helpers are involved.
+   */
+
+  for (i = 0; i < task_num - 1; ++i)
     {
-      if (i < mpcomm_get_helpers_num())
-        {
-          dnn_msg[i].id = func_type;
-          dnn_msg[i].arg[0] = (int)rt_func;
-          dnn_msg[i].arg[1] = tasks[i].begin;
-          dnn_msg[i].arg[2] = tasks[i].end;
-          mpcomm_send_helper(i, MEM_V2P(&dnn_msg[i]));
-        }
-      else
+      dnn_msg[i].id = DNN_HELPER_EXEC_LAYER;
+      dnn_msg[i].arg[0] = (int)MEM_V2P(layer);
+      dnn_msg[i].arg[1] = tasks[i].begin;
+      dnn_msg[i].arg[2] = tasks[i].end;
+      mpcomm_send_helper(i, MEM_V2P(&dnn_msg[i]));
+    }
+
+  ret = dnn_layer_exec_task(layer, tasks[i].begin, tasks[i].end);
+
+  for (i = 0; i < task_num - 1; ++i)
+    {
+      mpcomm_wait_helper_done(i);
+      if (ret == RT_FUNCTION_ERROR_NOERROR)
         {
-          controller_exec_function(rt_func, func_type,
-                                   tasks[i].begin,
-                                   tasks[i].end);
+          ret = dnn_msg[i].ret;
         }
     }
 
-  mpcomm_wait_helpers_done();
-
-  return 0;
+  return (rt_function_error_t)ret;
 }
 
 static int split_load(int total, dnn_task_t *tasks, int task_num)
 {
-  if (total <= 0)
+  int i;
+  int offset = 0;
+  int load;
+  int rem;
+
+  if (total <= 0 || task_num <= 0)
     {
       return -EINVAL;
     }
 
-  int load = (int)ceilf((float)total / task_num);
-  int i;
-  int offset = 0;
+  /* Spread the remainder over the first tasks so that loads differ by
+   * at most one unit.
+   */
 
-  memset(tasks, 0, sizeof(dnn_task_t) * task_num);
+  load = total / task_num;
+  rem = total % task_num;
 
   for (i = 0; i < task_num; ++i)
     {
       tasks[i].begin = offset;
-      offset += load;
+      offset += load + (i < rem ? 1 : 0);
       tasks[i].end = offset;
-
-      if ((total - offset) < load)
-        {
-          load = total - offset;
-        }
     }
 
   return 0;
 }
 
+/* Cost of one element of an elementwise function */
+
+static int elementwise_cost(int type)
+{
+  return type == DNN_HELPER_EXEC_BATCH_NORMALIZATION ? 2 : 1;
+}
+
+static int calc_task_num(dnn_layer_t *layer)
+{
+  int task_num = mpcomm_get_helpers_num() + 1;
+  int64_t unit_cost = layer->unit_cost;
+  int64_t max_tasks;
+  int i;
+
+  for (i = 1; i < layer->active_num; ++i)
+    {
+      unit_cost += (int64_t)layer->inner * elementwise_cost(layer->type[i]);
+    }
+
+  max_tasks = unit_cost * layer->outer * layer->units / DNN_TASK_MIN_COST;
+
+  if (task_num > max_tasks)
+    {
+      task_num = max_tasks > 0 ? (int)max_tasks : 1;
+    }
+
+  if (task_num > layer->units)
+    {
+      task_num = layer->units;
+    }
+
+  return task_num;
+}
+
 static int var_buf_size(rt_variable_t *var)
 {
   int elem_size = 0;
@@ -156,35 +202,317 @@ static int var_buf_size(rt_variable_t *var)
   return elem_size * calc_shape_size(var->shape);
 }
 
+static int var_overlaps(rt_variable_t *a, rt_variable_t *b)
+{
+  uint8_t *pa = (uint8_t *)a->data;
+  uint8_t *pb = (uint8_t *)b->data;
+  int sa = var_buf_size(a);
+  int sb = var_buf_size(b);
+
+  if (sa == 0 || sb == 0)
+    {
+      return pa != NULL && pb != NULL;
+    }
+
+  return pa < pb + sb && pb < pa + sa;
+}
+
+static int var_is_same(rt_variable_t *a, rt_variable_t *b)
+{
+  return a->data == b->data && var_buf_size(a) == var_buf_size(b) &&
+         var_buf_size(a) != 0;
+}
+
+/* A chained function k writes the elements of its task only, while the
+ * other tasks are still reading every input of the chain. Its output must
+ * therefore either be disjoint from all of them, or be exactly an earlier
+ * output of the chain (elementwise in-place update).
+ */
+
+static int chain_output_is_safe(dnn_layer_t *layer, int k)
+{
+  rt_variable_t *y = layer->func[k]->outputs[0];
+  rt_variable_t *v;
+  rt_function_t *f;
+  int i;
+  int j;
+
+  for (j = 0; j <= k; ++j)
+    {
+      f = layer->func[j];
+
+      for (i = 0; i < (int)f->num_of_inputs; ++i)
+        {
+          v = f->inputs[i];
+
+          /* Only the first input of a chained function is produced by
+           * this chain, element by element.
+           */
+
+          if (var_overlaps(y, v) &&
+              (j == 0 || i != 0 || !var_is_same(y, v)))
+            {
+              return 0;
+            }
+        }
+
+      v = f->outputs[0];
+      if (j < k && var_overlaps(y, v) && !var_is_same(y, v))
+        {
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+static int exec_type(rt_function_t *f)
+{
+  if (f->exec_func == dnn_controller_exec_affine)
+    {
+      return DNN_HELPER_EXEC_AFFINE;
+    }
+  else if (f->exec_func == dnn_controller_exec_convolution)
+    {
+      return DNN_HELPER_EXEC_CONVOLUTION;
+    }
+  else if (f->exec_func == dnn_controller_exec_max_pooling)
+    {
+      return DNN_HELPER_EXEC_MAX_POOLING;
+    }
+  else if (f->exec_func == dnn_controller_exec_relu)
+    {
+      return DNN_HELPER_EXEC_RELU;
+    }
+  else if (f->exec_func == dnn_controller_exec_batch_normalization)
+    {
+      return DNN_HELPER_EXEC_BATCH_NORMALIZATION;
+    }
+
+  return -1;
+}
+
+static rt_function_error_t exec_single_layer(rt_function_t *f)
+{
+  dnn_layer_t layer;
+
+  dnn_layer_setup(&layer, f);
+  return dnn_layer_exec(&layer, 1);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
-rt_function_error_t dnn_controller_exec_affine(rt_function_t *f)
+int dnn_layer_setup(dnn_layer_t *layer, rt_function_t *f)
+{
+  int type = exec_type(f);
+  int ndim;
+
+  memset(layer, 0, sizeof(dnn_layer_t));
+  layer->func[0] = f;
+  layer->chain_num = 1;
+  layer->active_num = 1;
+
+  if (type < 0)
+    {
+      return -ENOTSUP;
+    }
+
+  layer->type[0] = type;
+
+  switch (type)
+    {
+      case DNN_HELPER_EXEC_AFFINE:
+        {
+          affine_private_t *p =
+            (affine_private_t
+                 *)(((affine_local_context_t *)(f->local_context))->data);
+
+          layer->outer = p->base_loop_size;
+          layer->units = p->output_loop_size;
+          layer->inner = 1;
+          layer->unit_cost = p->input_loop_size;
+        }
+        break;
+
+      case DNN_HELPER_EXEC_CONVOLUTION:
+        {
+          convolution_local_context_t *c =
+            (convolution_local_context_t *)f->local_context;
+          convolution_private_t *p = (convolution_private_t *)(c->data);
+
+          /* Output channels within a group are the only axis the CHW
+           * kernels can split, as each call writes whole output planes.
+           */
+
+          layer->outer = p->in_var.shape.data[0] * c->group;
+          layer->units = p->out_var.shape.data[I];
+          layer->inner = p->out_var.shape.data[H] * p->out_var.shape.data[W];
+          layer->unit_cost = layer->inner * p->in_var.shape.data[I] *
+                             p->w_var.shape.data[H] *
+                             p->w_var.shape.data[W];
+        }
+        break;
+
+      case DNN_HELPER_EXEC_MAX_POOLING:
+        {
+          max_pooling_local_context_t *c =
+            (max_pooling_local_context_t *)f->local_context;
+          rt_list_t *shape = &f->outputs[0]->shape;
+
+          /* Every output row of every plane is a unit, which tiles both
+           * channels and the spatial axis.
+           */
+
+          ndim = shape->size;
+          layer->outer = 1;
+          layer->units = calc_shape_size(*shape) / shape->data[ndim - 1];
+          layer->inner = shape->data[ndim - 1];
+          layer->unit_cost = layer->inner * c->kernel.data[0] *
+                             c->kernel.data[1];
+        }
+        break;
+
+      default:
+        layer->outer = 1;
+        layer->units = calc_shape_size(f->outputs[0]->shape);
+        layer->inner = 1;
+        layer->unit_cost = elementwise_cost(type);
+        break;
+    }
+
+  if (layer->outer <= 0 || layer->units <= 0 || layer->inner <= 0)
+    {
+      layer->type[0] = 0;
+      return -EINVAL;
+    }
+
+  return 0;
+}
+
+int dnn_layer_chain(dnn_layer_t *layer, rt_function_t *f)
 {
-  affine_private_t *p =
-      (affine_private_t
-           *)(((affine_local_context_t *)(f->local_context))->data);
-  memset(p->output->data, 0, var_buf_size(p->output));
+  rt_function_t *prev = layer->func[layer->chain_num - 1];
+  int type = exec_type(f);
+  int size = layer->outer * layer->units * layer->inner;
+
+  if (layer->type[0] == 0 || layer->chain_num >= DNN_MAX_CHAIN_NUM)
+    {
+      return -ENOSPC;
+    }
+
+  if (type != DNN_HELPER_EXEC_RELU &&
+      type != DNN_HELPER_EXEC_BATCH_NORMALIZATION)
+    {
+      return -ENOTSUP;
+    }
+
+  /* The function must consume exactly the elements produced by the
+   * previous one.
+   */
+
+  if (f->inputs[0] != prev->outputs[0] ||
+      calc_shape_size(f->inputs[0]->shape) != size ||
+      calc_shape_size(f->outputs[0]->shape) != size)
+    {
+      return -EINVAL;
+    }
+
+  layer->func[layer->chain_num] = f;
+  layer->type[layer->chain_num] = type;
+  layer->chain_num++;
 
+  return 0;
+}
+
+rt_function_error_t dnn_layer_exec(dnn_layer_t *layer, int chain)
+{
   dnn_task_t tasks[MAX_HELPERS_NUM + 1];
-  int task_num = mpcomm_get_helpers_num() + 1;
-  split_load(p->output_loop_size, tasks, task_num);
+  int i;
+
+  if (layer->type[0] == 0)
+    {
+      return RT_FUNCTION_ERROR_NOERROR;
+    }
+
+  if (chain > layer->chain_num)
+    {
+      chain = layer->chain_num;
+    }
+
+  for (i = 1; i < chain; ++i)
+    {
+      if (!chain_output_is_safe(layer, i))
+        {
+          break;
+        }
+    }
+
+  layer->active_num = i;
+
+  if (layer->type[0] == DNN_HELPER_EXEC_AFFINE)
+    {
+      affine_private_t *p =
+        (affine_private_t
+             *)(((affine_local_context_t *)(layer->func[0]->local_context))
+                    ->data);
+      memset(p->output->data, 0, var_buf_size(p->output));
+    }
+
+  layer->task_num = calc_task_num(layer);
+  split_load(layer->units, tasks, layer->task_num);
+
+  return exec_dnn_tasks(layer, tasks, layer->task_num);
+}
+
+int dnn_layer_exec_task(dnn_layer_t *layer, int begin, int end)
+{
+  int size = layer->units * layer->inner;
+  rt_function_error_t ret;
+  int i;
+  int o;
+
+  ret = exec_function_task(layer->func[0], layer->type[0], begin, end);
+
+  /* Chained functions are elementwise, so run them over the elements of
+   * the units in each outer block.
+   */
 
-  return exec_dnn_tasks(f, DNN_HELPER_EXEC_AFFINE, tasks, task_num);
+  for (i = 1; i < layer->active_num && ret == RT_FUNCTION_ERROR_NOERROR; ++i)
+    {
+      for (o = 0; o < layer->outer && ret == RT_FUNCTION_ERROR_NOERROR; ++o)
+        {
+          ret = exec_function_task(layer->func[i], layer->type[i],
+                                   o * size + begin * layer->inner,
+                                   o * size + end * layer->inner);
+        }
+    }
+
+  return ret;
+}
+
+rt_function_error_t dnn_controller_exec_affine(rt_function_t *f)
+{
+  return exec_single_layer(f);
 }
 
 rt_function_error_t dnn_controller_exec_convolution(rt_function_t *f)
 {
-  convolution_local_context_t *c =
-      (convolution_local_context_t *)f->local_context;
-  convolution_private_t *p = (convolution_private_t *)(c->data);
+  return exec_single_layer(f);
+}
 
-  memset(p->out_var.v->data, 0, var_buf_size(p->out_var.v));
+rt_function_error_t dnn_controller_exec_max_pooling(rt_function_t *f)
+{
+  return exec_single_layer(f);
+}
 
-  dnn_task_t tasks[MAX_HELPERS_NUM + 1];
-  int task_num = mpcomm_get_helpers_num() + 1;
-  split_load(p->out_var.shape.data[I], tasks, task_num);
+rt_function_error_t dnn_controller_exec_relu(rt_function_t *f)
+{
+  return exec_single_layer(f);
+}
 
-  return exec_dnn_tasks(f, DNN_HELPER_EXEC_CONVOLUTION, tasks, task_num);
+rt_function_error_t dnn_controller_exec_batch_normalization(rt_function_t *f)
+{
+  return exec_single_layer(f);
 }
@@ -40,9 +40,29 @@
  * Included Files
  ****************************************************************************/
 
+#include <stdint.h>
+
 #include <nnablart/network.h>
 #include <nnablart/runtime.h>
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Maximum number of functions executed as one layer: a partitioned
+ * function followed by elementwise ones (e.g. Convolution, BatchNorm and
+ * ReLU).
+ */
+
+#define DNN_MAX_CHAIN_NUM (3)
+
+/* Minimum amount of work (in multiply-accumulates or element operations)
+ * worth one task. Smaller layers use fewer CPUs, as dispatching a task and
+ * waiting for it costs more than computing it.
+ */
+
+#define DNN_TASK_MIN_COST (4 * 1024)
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -53,6 +73,27 @@ typedef struct dnn_task
   int end;
 } dnn_task_t;
 
+/* A layer is a function whose output is split into units (output channels,
+ * output rows or elements), optionally followed by chained functions that
+ * only read the same elements of the preceding output. Each task runs its
+ * units through the whole chain, so no barrier is needed in between.
+ *
+ * The output of the head function is viewed as [outer][units][inner].
+ */
+
+typedef struct dnn_layer
+{
+  rt_function_t *func[DNN_MAX_CHAIN_NUM];
+  uint8_t type[DNN_MAX_CHAIN_NUM];
+  uint8_t chain_num;  /* Number of functions chainable to this layer */
+  uint8_t active_num; /* Number of functions run by the current tasks */
+  uint8_t task_num;   /* Number of tasks used by the last execution */
+  int outer;
+  int units;
+  int inner;
+  int unit_cost;      /* Cost of one unit over the active functions */
+} dnn_layer_t;
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -60,11 +101,32 @@ typedef struct dnn_task
 rt_function_error_t dnnrt_exec_convolution(rt_function_t *f,
                                            int begin, int end);
 rt_function_error_t dnnrt_exec_affine(rt_function_t *f, int begin, int end);
+rt_function_error_t dnnrt_exec_max_pooling(rt_function_t *f,
+                                           int begin, int end);
+rt_function_error_t dnnrt_exec_relu(rt_function_t *f, int begin, int end);
+rt_function_error_t dnnrt_exec_batch_normalization(rt_function_t *f,
+                                                   int begin, int end);
 rt_function_error_t dnn_controller_exec_affine(rt_function_t *f);
 rt_function_error_t dnn_controller_exec_convolution(rt_function_t *f);
+rt_function_error_t dnn_controller_exec_max_pooling(rt_function_t *f);
+rt_function_error_t dnn_controller_exec_relu(rt_function_t *f);
+rt_function_error_t dnn_controller_exec_batch_normalization(rt_function_t *f);
 rt_return_value_t dnnrt_affine_alloc(nn_network_t *net,
                                      void *function_context);
 rt_return_value_t dnnrt_convolution_alloc(nn_network_t *net,
                                           void *function_context);
+rt_return_value_t dnnrt_max_pooling_alloc(nn_network_t *net,
+                                          void *function_context);
+rt_return_value_t dnnrt_relu_alloc(nn_network_t *net,
+                                   void *function_context);
+rt_return_value_t dnnrt_batch_normalization_alloc(nn_network_t *net,
+                                                  void *function_context);
+
+/* Layer execution */
+
+int dnn_layer_setup(dnn_layer_t *layer, rt_function_t *f);
+int dnn_layer_chain(dnn_layer_t *layer, rt_function_t *f);
+rt_function_error_t dnn_layer_exec(dnn_layer_t *layer, int chain);
+int dnn_layer_exec_task(dnn_layer_t *layer, int begin, int end);
 
 #endif /* _DNNRT_MPCOMM_WORKER_DNN_EXEC_FUNCTION_H_ */
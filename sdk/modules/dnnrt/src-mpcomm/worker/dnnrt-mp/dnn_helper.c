@@ -57,14 +57,9 @@ static int dnn_helper_initialize(void *scratch_buffer)
   return 0;
 }
 
-static int dnn_helper_exec_affine(rt_function_t *f, int begin, int end)
+static int dnn_helper_exec_layer(dnn_layer_t *layer, int begin, int end)
 {
-  return dnnrt_exec_affine(f, begin, end);
-}
-
-static int dnn_helper_exec_convolution(rt_function_t *f, int begin, int end)
-{
-  return dnnrt_exec_convolution(f, begin, end);
+  return dnn_layer_exec_task(layer, begin, end);
 }
 
 /****************************************************************************
@@ -80,15 +75,10 @@ void dnn_helper_handle_msg(void *data)
       case DNN_HELPER_MSG_INIT:
         dnn_msg->ret = dnn_helper_initialize((void *)dnn_msg->arg[0]);
         break;
-      case DNN_HELPER_EXEC_AFFINE:
-        dnn_msg->ret =
-          dnn_helper_exec_affine((rt_function_t *)dnn_msg->arg[0],
-                                 dnn_msg->arg[1], dnn_msg->arg[2]);
-        break;
-      case DNN_HELPER_EXEC_CONVOLUTION:
+      case DNN_HELPER_EXEC_LAYER:
         dnn_msg->ret =
-          dnn_helper_exec_convolution((rt_function_t *)dnn_msg->arg[0],
-                                      dnn_msg->arg[1], dnn_msg->arg[2]);
+          dnn_helper_exec_layer((dnn_layer_t *)dnn_msg->arg[0],
+                                dnn_msg->arg[1], dnn_msg->arg[2]);
         break;
       default:
         dnn_msg->ret = -EINVAL;
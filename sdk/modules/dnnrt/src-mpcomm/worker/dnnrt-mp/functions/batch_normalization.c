@@ -0,0 +1,184 @@
+/****************************************************************************
+ * modules/dnnrt/src-mpcomm/worker/dnnrt-mp/functions/batch_normalization.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <math.h>
+#include <stddef.h>
+#include <nnablart/functions.h>
+#include <nnablart/runtime.h>
+#include <context.h>
+#include <runtime_internal.h>
+#include "dnn_exec_function.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define X (0)        // x input
+#define BETA (1)     // beta
+#define GAMMA (2)    // gamma
+#define MEAN (3)     // mean
+#define VARIANCE (4) // variance
+#define Y (0)        // y output
+
+#define CHANNEL_AXIS (1)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Number of elements following the channel axis */
+
+static int inner_size(rt_variable_t *x)
+{
+  int size = 1;
+  int i;
+
+  for (i = CHANNEL_AXIS + 1; i < x->shape.size; i++)
+    {
+      size *= x->shape.data[i];
+    }
+
+  return size;
+}
+
+static inline int validate_params(rt_function_t *f)
+{
+  batch_normalization_local_context_t *c =
+      (batch_normalization_local_context_t *)f->local_context;
+  rt_variable_t *x = f->inputs[X];
+  int channels;
+  int i;
+
+  /* Only inference with stored statistics over the channel axis */
+
+  if (c->batch_stat || c->axes.size != 1 ||
+      c->axes.data[0] != CHANNEL_AXIS || f->num_of_inputs != 5 ||
+      x->shape.size <= CHANNEL_AXIS)
+    {
+      return 0;
+    }
+
+  if (x->type != NN_DATA_TYPE_FLOAT ||
+      f->outputs[Y]->type != NN_DATA_TYPE_FLOAT ||
+      calc_shape_size(x->shape) != calc_shape_size(f->outputs[Y]->shape))
+    {
+      return 0;
+    }
+
+  channels = x->shape.data[CHANNEL_AXIS];
+
+  for (i = BETA; i <= VARIANCE; i++)
+    {
+      if (f->inputs[i]->type != NN_DATA_TYPE_FLOAT ||
+          calc_shape_size(f->inputs[i]->shape) != channels)
+        {
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/* Normalize elements [begin, end) of x in flat order */
+
+rt_function_error_t dnnrt_exec_batch_normalization(rt_function_t *f,
+                                                   int begin, int end)
+{
+  batch_normalization_local_context_t *c =
+      (batch_normalization_local_context_t *)f->local_context;
+  const float *x = (const float *)f->inputs[X]->data;
+  const float *beta = (const float *)f->inputs[BETA]->data;
+  const float *gamma = (const float *)f->inputs[GAMMA]->data;
+  const float *mean = (const float *)f->inputs[MEAN]->data;
+  const float *var = (const float *)f->inputs[VARIANCE]->data;
+  float *y = (float *)f->outputs[Y]->data;
+  int channels = f->inputs[X]->shape.data[CHANNEL_AXIS];
+  int inner = inner_size(f->inputs[X]);
+  int i = begin;
+
+  while (i < end)
+    {
+      /* Process the rest of the current channel plane with its scale and
+       * shift folded once.
+       */
+
+      int ch = (i / inner) % channels;
+      int stop = (i / inner + 1) * inner;
+      float scale = gamma[ch] / sqrtf(var[ch] + c->eps);
+      float shift = beta[ch] - mean[ch] * scale;
+
+      if (stop > end)
+        {
+          stop = end;
+        }
+
+      for (; i < stop; i++)
+        {
+          y[i] = x[i] * scale + shift;
+        }
+    }
+
+  return RT_FUNCTION_ERROR_NOERROR;
+}
+
+rt_return_value_t dnnrt_batch_normalization_alloc(nn_network_t *net,
+                                                  void *function_context)
+{
+  rt_function_context_t *func = (rt_function_context_t *)function_context;
+
+  if ((int)func->info->impl != 0)
+    {
+      return RT_RET_FUNCTION_DONT_MATCH;
+    }
+
+  allocate_function_context(net, func->info, function_context);
+
+  if (!validate_params(&func->func))
+    {
+      return RT_RET_FUNCTION_MATCH;
+    }
+
+  func->func.exec_func = dnn_controller_exec_batch_normalization;
+
+  return RT_RET_FUNCTION_MATCH;
+}
@@ -0,0 +1,259 @@
+/****************************************************************************
+ * modules/dnnrt/src-mpcomm/worker/dnnrt-mp/functions/max_pooling.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <nnablart/functions.h>
+#include <nnablart/runtime.h>
+#include <context.h>
+#include <runtime_internal.h>
+#include "dnn_exec_function.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define X (0) // x input
+#define Y (0) // y output
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef struct max_pooling_geometry
+{
+  int in_h;
+  int in_w;
+  int out_h;
+  int out_w;
+  int kernel_h;
+  int kernel_w;
+  int stride_h;
+  int stride_w;
+  int pad_h;
+  int pad_w;
+} max_pooling_geometry_t;
+
+typedef int16_t fixed16_t;
+typedef int8_t fixed8_t;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void get_geometry(rt_function_t *f, max_pooling_geometry_t *g)
+{
+  max_pooling_local_context_t *c =
+      (max_pooling_local_context_t *)f->local_context;
+  rt_list_t *in_shape = &f->inputs[X]->shape;
+  rt_list_t *out_shape = &f->outputs[Y]->shape;
+
+  g->in_h = in_shape->data[in_shape->size - 2];
+  g->in_w = in_shape->data[in_shape->size - 1];
+  g->out_h = out_shape->data[out_shape->size - 2];
+  g->out_w = out_shape->data[out_shape->size - 1];
+  g->kernel_h = c->kernel.data[0];
+  g->kernel_w = c->kernel.data[1];
+  g->stride_h = c->stride.data[0];
+  g->stride_w = c->stride.data[1];
+  g->pad_h = c->pad.size == 2 ? c->pad.data[0] : 0;
+  g->pad_w = c->pad.size == 2 ? c->pad.data[1] : 0;
+}
+
+/* The window of an output pixel is clipped to the input, so padding never
+ * takes part in the max. Rows are numbered over all the planes.
+ * The same loop serves every data type, so it is generated per type.
+ */
+
+#define DEFINE_MAX_POOLING(name, type)                                      \
+static rt_function_error_t dnnrt_exec_max_pooling_##name(rt_function_t *f,  \
+                                                         int begin,         \
+                                                         int end)           \
+{                                                                           \
+  max_pooling_geometry_t g;                                                 \
+  const type *x = (const type *)f->inputs[X]->data;                         \
+  type *y = (type *)f->outputs[Y]->data;                                    \
+  int r;                                                                    \
+                                                                            \
+  get_geometry(f, &g);                                                      \
+                                                                            \
+  for (r = begin; r < end; ++r)                                             \
+    {                                                                       \
+      int plane = r / g.out_h;                                              \
+      int iy0 = (r % g.out_h) * g.stride_h - g.pad_h;                       \
+      int iy1 = iy0 + g.kernel_h;                                           \
+      const type *in = x + plane * g.in_h * g.in_w;                         \
+      type *out = y + r * g.out_w;                                          \
+      int ox;                                                               \
+                                                                            \
+      iy0 = iy0 < 0 ? 0 : iy0;                                              \
+      iy1 = iy1 > g.in_h ? g.in_h : iy1;                                    \
+                                                                            \
+      for (ox = 0; ox < g.out_w; ++ox)                                      \
+        {                                                                   \
+          int ix0 = ox * g.stride_w - g.pad_w;                              \
+          int ix1 = ix0 + g.kernel_w;                                       \
+          int iy;                                                           \
+          int ix;                                                           \
+          type m;                                                           \
+                                                                            \
+          ix0 = ix0 < 0 ? 0 : ix0;                                          \
+          ix1 = ix1 > g.in_w ? g.in_w : ix1;                                \
+          m = in[iy0 * g.in_w + ix0];                                       \
+                                                                            \
+          for (iy = iy0; iy < iy1; ++iy)                                    \
+            {                                                               \
+              const type *row = in + iy * g.in_w;                           \
+                                                                            \
+              for (ix = ix0; ix < ix1; ++ix)                                \
+                {                                                           \
+                  m = row[ix] > m ? row[ix] : m;                            \
+                }                                                           \
+            }                                                               \
+                                                                            \
+          out[ox] = m;                                                      \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+  return RT_FUNCTION_ERROR_NOERROR;                                         \
+}
+
+DEFINE_MAX_POOLING(fixed16, fixed16_t)
+DEFINE_MAX_POOLING(fixed8, fixed8_t)
+DEFINE_MAX_POOLING(float, float)
+
+static inline int validate_params(rt_function_t *f)
+{
+  max_pooling_local_context_t *c =
+      (max_pooling_local_context_t *)f->local_context;
+  rt_variable_t *x = f->inputs[X];
+  rt_variable_t *y = f->outputs[Y];
+  max_pooling_geometry_t g;
+  int i;
+
+  if (x->type != y->type ||
+      (x->type != NN_DATA_TYPE_FLOAT && x->fp_pos != y->fp_pos))
+    {
+      return 0;
+    }
+
+  if (x->type != NN_DATA_TYPE_FLOAT && x->type != NN_DATA_TYPE_INT16 &&
+      x->type != NN_DATA_TYPE_INT8)
+    {
+      return 0;
+    }
+
+  if (x->shape.size < 3 || x->shape.size != y->shape.size ||
+      c->kernel.size != 2 || c->stride.size != 2 ||
+      (c->pad.size != 0 && c->pad.size != 2))
+    {
+      return 0;
+    }
+
+  for (i = 0; i < x->shape.size - 2; ++i)
+    {
+      if (x->shape.data[i] != y->shape.data[i])
+        {
+          return 0;
+        }
+    }
+
+  get_geometry(f, &g);
+
+  if (g.out_h <= 0 || g.out_w <= 0 ||
+      g.kernel_h <= 0 || g.kernel_w <= 0 ||
+      g.stride_h <= 0 || g.stride_w <= 0)
+    {
+      return 0;
+    }
+
+  /* Every window must cover at least one input pixel */
+
+  if (g.pad_h >= g.kernel_h || g.pad_w >= g.kernel_w ||
+      (g.out_h - 1) * g.stride_h - g.pad_h >= g.in_h ||
+      (g.out_w - 1) * g.stride_w - g.pad_w >= g.in_w)
+    {
+      return 0;
+    }
+
+  return 1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+rt_function_error_t dnnrt_exec_max_pooling(rt_function_t *f,
+                                           int begin, int end)
+{
+  if (f->inputs[X]->type == NN_DATA_TYPE_FLOAT)
+    {
+      return dnnrt_exec_max_pooling_float(f, begin, end);
+    }
+  else if (f->inputs[X]->type == NN_DATA_TYPE_INT16)
+    {
+      return dnnrt_exec_max_pooling_fixed16(f, begin, end);
+    }
+  else
+    {
+      return dnnrt_exec_max_pooling_fixed8(f, begin, end);
+    }
+}
+
+rt_return_value_t dnnrt_max_pooling_alloc(nn_network_t *net,
+                                          void *function_context)
+{
+  rt_function_context_t *func = (rt_function_context_t *)function_context;
+
+  if ((int)func->info->impl != 0)
+    {
+      return RT_RET_FUNCTION_DONT_MATCH;
+    }
+
+  allocate_function_context(net, func->info, function_context);
+
+  if (!validate_params(&func->func))
+    {
+      return RT_RET_FUNCTION_MATCH;
+    }
+
+  func->func.exec_func = dnn_controller_exec_max_pooling;
+
+  return RT_RET_FUNCTION_MATCH;
+}
@@ -0,0 +1,172 @@
+/****************************************************************************
+ * modules/dnnrt/src-mpcomm/worker/dnnrt-mp/functions/relu.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <nnablart/functions.h>
+#include <nnablart/runtime.h>
+#include <context.h>
+#include <runtime_internal.h>
+#include "dnn_exec_function.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define X (0) // x input
+#define Y (0) // y output
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef int16_t fixed16_t;
+typedef int8_t fixed8_t;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static rt_function_error_t dnnrt_exec_relu_fixed16(rt_function_t *f,
+                                                   int begin, int end)
+{
+  const fixed16_t *x = (const fixed16_t *)f->inputs[X]->data;
+  fixed16_t *y = (fixed16_t *)f->outputs[Y]->data;
+  int i;
+
+  for (i = begin; i < end; i++)
+    {
+      y[i] = x[i] > 0 ? x[i] : 0;
+    }
+
+  return RT_FUNCTION_ERROR_NOERROR;
+}
+
+static rt_function_error_t dnnrt_exec_relu_fixed8(rt_function_t *f,
+                                                  int begin, int end)
+{
+  const fixed8_t *x = (const fixed8_t *)f->inputs[X]->data;
+  fixed8_t *y = (fixed8_t *)f->outputs[Y]->data;
+  int i;
+
+  for (i = begin; i < end; i++)
+    {
+      y[i] = x[i] > 0 ? x[i] : 0;
+    }
+
+  return RT_FUNCTION_ERROR_NOERROR;
+}
+
+static rt_function_error_t dnnrt_exec_relu_float(rt_function_t *f,
+                                                 int begin, int end)
+{
+  const float *x = (const float *)f->inputs[X]->data;
+  float *y = (float *)f->outputs[Y]->data;
+  int i;
+
+  for (i = begin; i < end; i++)
+    {
+      y[i] = x[i] > 0.0f ? x[i] : 0.0f;
+    }
+
+  return RT_FUNCTION_ERROR_NOERROR;
+}
+
+static inline int validate_params(rt_function_t *f)
+{
+  rt_variable_t *x = f->inputs[X];
+  rt_variable_t *y = f->outputs[Y];
+
+  if (x->type != y->type ||
+      calc_shape_size(x->shape) != calc_shape_size(y->shape))
+    {
+      return 0;
+    }
+
+  if (x->type == NN_DATA_TYPE_FLOAT)
+    {
+      return 1;
+    }
+
+  /* The fixed point kernels copy the raw values */
+
+  return (x->type == NN_DATA_TYPE_INT16 || x->type == NN_DATA_TYPE_INT8) &&
+         x->fp_pos == y->fp_pos;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+rt_function_error_t dnnrt_exec_relu(rt_function_t *f, int begin, int end)
+{
+  if (f->inputs[X]->type == NN_DATA_TYPE_FLOAT)
+    {
+      return dnnrt_exec_relu_float(f, begin, end);
+    }
+  else if (f->inputs[X]->type == NN_DATA_TYPE_INT16)
+    {
+      return dnnrt_exec_relu_fixed16(f, begin, end);
+    }
+  else
+    {
+      return dnnrt_exec_relu_fixed8(f, begin, end);
+    }
+}
+
+rt_return_value_t dnnrt_relu_alloc(nn_network_t *net, void *function_context)
+{
+  rt_function_context_t *func = (rt_function_context_t *)function_context;
+
+  if ((int)func->info->impl != 0)
+    {
+      return RT_RET_FUNCTION_DONT_MATCH;
+    }
+
+  allocate_function_context(net, func->info, function_context);
+
+  if (!validate_params(&func->func))
+    {
+      return RT_RET_FUNCTION_MATCH;
+    }
+
+  func->func.exec_func = dnn_controller_exec_relu;
+
+  return RT_RET_FUNCTION_MATCH;
+}
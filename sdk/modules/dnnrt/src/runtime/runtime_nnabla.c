@@ -283,6 +283,12 @@ void *dnn_scratch_buf(void)
   return s_dnn_gctx.scratch_buf;
 }
 
+int dnn_runtime_profile(dnn_runtime_t * rt, dnn_layer_profile_t * profile,
+                        unsigned short profile_num)
+{
+  return -EPERM;
+}
+
 int dnn_asmp_mallinfo(unsigned char array_length, dnn_mallinfo_t * info_array)
 {
   return -EPERM;
@@ -45,6 +45,7 @@
 #include <audiolite/al_nodecomm.h>
 #include <audiolite/al_inputnode.h>
 #include <audiolite/al_outputnode.h>
+#include <audiolite/al_profile.h>
 
 /****************************************************************************
  * Class Definitions
@@ -65,10 +66,23 @@ class audiolite_component : public audiolite_nodecomm_if
     int _outnum;
     int _state;
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    const char *_profname;
+    struct al_profile_time_s _prof_ondata;
+    audiolite_component *_profnext;
+#endif
+
     int search_inputidx(audiolite_inputnode *node);
     static int operate_cb(mossfw_callback_op_t *op, unsigned long arg);
     void set_operatorname(const char *name);
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    /* Override to add statistics of a derived class to the snapshot */
+
+    virtual void get_subprofile(struct al_profile_s *prof) {};
+    virtual void reset_subprofile() {};
+#endif
+
     audiolite_mem *pop_data(int no = 0, int *used = NULL)
     {
       return (_ins && _innum > no) ? _ins[no]->pop_data(used) : NULL;
@@ -137,10 +151,25 @@ class audiolite_component : public audiolite_nodecomm_if
     int unbind(audiolite_inputnode *in);
     int unbindall();
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    /* Profiling */
+
+    void set_profname(const char *name);
+    int get_profile(struct al_profile_s *prof);
+    void reset_profile();
+#endif
+
     virtual int start();
     virtual void stop();
     virtual void suspend();
     virtual int resume();
+
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+  friend void audiolite_profile_register(audiolite_component *comp);
+  friend void audiolite_profile_unregister(audiolite_component *comp);
+  friend void audiolite_profile_dump(void);
+  friend void audiolite_profile_reset(void);
+#endif
 };
 
 #endif /* __INCLUDE_AUDIOLITE_COMPONENT_H */
@@ -64,12 +64,23 @@ class audiolite_decoder : public audiolite_component
     volatile bool _isplay;
     volatile bool _ispause;
     volatile bool _is_thrdrun;
+    bool _runner_evt;
+    mossfw_lock_t _evtlock;
+    mossfw_condition_t _evtcond;
 
     int start_thread(const char *name);
     void stop_thread();
     virtual void decode_runner() = 0;
 
+    /* Block decode_runner() until notify_runner() is called
+     * or the thread is stopped.
+     */
+
+    void wait_runner();
+    void notify_runner();
+
     static void *inject_worker(void *arg);
+    static void pool_event(void *arg);
 
   public:
     audiolite_decoder(const char *name,
@@ -86,11 +97,23 @@ class audiolite_decoder : public audiolite_component
     virtual int pause_decode() = 0;
     virtual int resume_decode() = 0;
 
-    void set_stream(audiolite_stream *st) { _stream = st; };
-    void set_outputmempool(audiolite_mempoolapbuf *pool)
+    void set_stream(audiolite_stream *st)
+    {
+      _stream = st;
+      notify_runner();
+    };
+
+    void set_outputmempool(audiolite_mempoolapbuf *pool);
+
+    /* Time profile of the pool which carries decoded samples.
+     * first_sample_latency() on it gives start-to-first-sample time.
+     */
+
+    audiolite_timeprofile *output_profile()
     {
-      _omempool = pool;
-    }
+      return _omempool ? (audiolite_timeprofile *)_omempool
+                       : (audiolite_timeprofile *)_pool;
+    };
 };
 
 #endif  /* __INCLUDE_AUDIOLITE_DECODER_H */
@@ -69,6 +69,7 @@
 #define AL_EVENT_MP3DECERROR       (-24)
 #define AL_EVENT_MP3DEC_WRONGTYPE  (-25)
 #define AL_EVENT_WRONGVERSION      (-26)
+#define AL_EVENT_FRAMEINFO         (-27)
 
 class audiolite_component;
 
@@ -45,6 +45,7 @@
 
 #include <audiolite/al_memalloc.h>
 #include <audiolite/al_nodecomm.h>
+#include <audiolite/al_profile.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -78,6 +79,11 @@ class audiolite_inputnode
 
     audiolite_inputnode *_nextnode;
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    int _prof_depth;
+    int _prof_maxdepth;
+#endif
+
   public:
     audiolite_inputnode(audiolite_component *cmp, int depth = DEFAULT_INPUT_QDEPTH);
     ~audiolite_inputnode();
@@ -90,6 +96,21 @@ class audiolite_inputnode
     void release_allstoredbuff();
     audiolite_mem *pop_data(int *used);
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    void add_depth(int n)
+    {
+      al_profile_depth_add(&_prof_depth, &_prof_maxdepth, n);
+    };
+
+    void get_depth(int *depth, int *maxdepth)
+    {
+      *depth = _prof_depth;
+      *maxdepth = _prof_maxdepth;
+    };
+
+    void reset_maxdepth() { _prof_maxdepth = _prof_depth; };
+#endif
+
   friend class audiolite_outputnode;
   friend class audiolite_component;
   friend int audiolite_start(audiolite_outputnode *node);
@@ -72,8 +72,16 @@ class audiolite_timeprofile
     struct timeval timekeeper;
     int min_remain;
     uint32_t max_zero_timeus;
-
-    audiolite_timeprofile(void)
+    struct timeval latency_keeper;
+    uint32_t first_sample_us;
+    bool wait_first_sample;
+    int prefetch_fill;
+    int min_prefetch_fill;
+
+    audiolite_timeprofile(void) : first_sample_us(0),
+                                  wait_first_sample(false),
+                                  prefetch_fill(0),
+                                  min_prefetch_fill(-1)
     {
       reflesh(0);
     };
@@ -85,18 +93,53 @@ class audiolite_timeprofile
     void measure_start();
     void measure_stop();
 
+    /* Start-to-first-sample latency */
+
+    void latency_start();
+    void latency_stop();
+
+    /* Bytes prefetched by a read-ahead stream */
+
+    void update_prefetch(int fill);
+
     uint32_t zero_time() { return max_zero_timeus; };
     int minimum_remain() { return min_remain; };
+    uint32_t first_sample_latency() { return first_sample_us; };
+    int prefetch_level() { return prefetch_fill; };
+    int minimum_prefetch() { return min_prefetch_fill; };
 };
 
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Called when a memory block is returned or the pool is enabled */
+
+typedef void (*audiolite_poolevent_t)(void *arg);
+
 /****************************************************************************
  * class: audiolite_mempool
  ****************************************************************************/
 
 class audiolite_mempool : public audiolite_timeprofile
 {
+  protected:
+    audiolite_poolevent_t _evtcb;
+    void *_evtarg;
+
+    void notify_event()
+    {
+      if (_evtcb) _evtcb(_evtarg);
+    };
+
   public:
+    audiolite_mempool(void) : _evtcb(NULL), _evtarg(NULL){};
     virtual ~audiolite_mempool(){};
+    void set_eventcallback(audiolite_poolevent_t cb, void *arg)
+    {
+      _evtcb = cb;
+      _evtarg = arg;
+    };
     virtual audiolite_mem *allocate(bool blocking = true) = 0;
     virtual void memfree(audiolite_mem *mem) = 0;
     virtual void disable_pool() = 0;
@@ -158,6 +201,10 @@ class audiolite_memapbuf : public audiolite_mem
     struct ap_buffer_s _abuf;
 
   public:
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    uint32_t qstamp;  /* Time pushed in audiolite_workermemq */
+#endif
+
     audiolite_memapbuf(void);
     void setup_instance(int sz, char *mem,
                                 audiolite_mempool *pool);
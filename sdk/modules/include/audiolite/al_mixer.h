@@ -0,0 +1,148 @@
+/****************************************************************************
+ * modules/include/audiolite/al_mixer.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_AUDIOLITE_MIXER_H
+#define __INCLUDE_AUDIOLITE_MIXER_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <mossfw/mossfw_lock.h>
+#include <audiolite/al_component.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define AL_MIXER_DEFAULT_INPUTS   (2)
+#define AL_MIXER_DEFAULT_RAMPMS   (10)
+#define AL_MIXER_MAX_GAIN         (4.f)
+
+/****************************************************************************
+ * Class Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * class: audiolite_mixer
+ *
+ * Sums 16bit PCM of all bound inputs into output 0. All inputs should be
+ * in the system sampling rate and channels (use audiolite_resampler in
+ * front of an input if not).
+ *
+ * An input joins the mix when its first data comes, and leaves it when
+ * memory with EOF is mixed or its previous component is stopped. Other
+ * inputs keep playing in both cases. Output memory has EOF when the last
+ * mixing input reaches EOF.
+ *
+ * Memory with non-zero timestamp (in micro seconds) is placed on the
+ * timeline of the mixer: the gap from the previous data is filled with
+ * silence, or overlapped samples are dropped. Zero timestamp means
+ * the data follows the previous data of the input.
+ *
+ * Output memory pool should be set by set_mempool() before start.
+ ****************************************************************************/
+
+class audiolite_mixer : public audiolite_component
+{
+  protected:
+    struct mixin_s
+    {
+      audiolite_mem *mem;   /* Memory being mixed */
+      int ofst;             /* Read offset in mem (bytes) */
+      int wpos;             /* Mixed frames in the output memory */
+      int64_t skip;         /* >0: silence frames, <0: frames to drop */
+      bool active;
+      bool ended;
+      bool stopreq;
+      float gain;
+      float target;
+      float step;
+      int ramp;             /* Remaining frames of the gain ramp */
+      int rampreq;          /* Requested ramp length, -1 for none */
+    };
+
+    struct mixin_s *_in;
+    audiolite_mem *_outmem;
+    float *_acc;
+    int _accsz;
+    uint64_t _outframes;
+    int64_t _anchor_us;
+    bool _anchored;
+    bool _running;
+    mossfw_lock_t _lock;
+
+    void join_input(int idx);
+    void leave_input(int idx);
+    void place_mem(int idx, audiolite_mem *mem);
+    bool fetch_mem(int idx);
+    int frontier(int idx);
+    void apply_request(int idx);
+    void mix_input(int idx, int frames, int chs);
+    void flush_output(int frames, int chs, bool eof);
+    void release_all();
+
+  public:
+    audiolite_mixer(int inputs = AL_MIXER_DEFAULT_INPUTS);
+    virtual ~audiolite_mixer();
+
+    /* Gain is from 0.0 to AL_MIXER_MAX_GAIN. It is changed linearly
+     * in ramp_ms to avoid click noise.
+     */
+
+    int set_gain(int idx, float gain, int ramp_ms = AL_MIXER_DEFAULT_RAMPMS);
+    float get_gain(int idx);
+
+    /* Inherited methods from audiolite_component */
+
+    using audiolite_component::start;
+    using audiolite_component::stop;
+
+    int start(audiolite_inputnode *node);
+    void stop(audiolite_inputnode *node);
+    virtual void on_data();
+    virtual int on_starting(audiolite_inputnode *inode,
+                            audiolite_outputnode *onode);
+    virtual void on_started(audiolite_inputnode *inode,
+                            audiolite_outputnode *onode);
+    virtual void on_stop(audiolite_inputnode *inode,
+                         audiolite_outputnode *onode);
+};
+
+#endif /* __INCLUDE_AUDIOLITE_MIXER_H */
@@ -69,6 +69,11 @@ class audiolite_mp3dec : public audiolite_decoder
   protected:
     void decode_runner();
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    virtual void get_subprofile(struct al_profile_s *prof);
+    virtual void reset_subprofile();
+#endif
+
   public:
     audiolite_mp3dec();
     ~audiolite_mp3dec();
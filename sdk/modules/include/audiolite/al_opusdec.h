@@ -0,0 +1,74 @@
+/****************************************************************************
+ * modules/include/audiolite/al_opusdec.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_AUDIOLITE_OPUSDEC_H
+#define __INCLUDE_AUDIOLITE_OPUSDEC_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <audiolite/al_workerdec.h>
+#include <audiolite/alworker_opusdec.h>
+
+/****************************************************************************
+ * Class Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * class: audiolite_opusdec
+ *
+ * Decodes Opus packets on a sub-core. The packets are framed as
+ * AL_OPUSDEC_FRAMING_LEN8 (default) or AL_OPUSDEC_FRAMING_LEN32.
+ * Decoded PCM has the system channels, and the system sampling rate
+ * if Opus supports it (8k, 12k, 16k, 24k or 48kHz), otherwise 48kHz.
+ ****************************************************************************/
+
+class audiolite_opusdec : public audiolite_workerdec
+{
+  protected:
+    int _framing;
+
+    virtual void set_playopt(al_comm_msgopt_t *opt);
+
+  public:
+    audiolite_opusdec();
+    virtual ~audiolite_opusdec();
+
+    void set_framing(int framing) { _framing = framing; };
+};
+
+#endif /* __INCLUDE_AUDIOLITE_OPUSDEC_H */
@@ -40,6 +40,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <mossfw/mossfw_component.h>
 
 #include <audiolite/al_memalloc.h>
@@ -70,6 +72,10 @@ class audiolite_outputnode
     mossfw_output_t *_output;
     mossfw_lock_t _lock;
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    void add_depth(int n);
+#endif
+
   public:
     audiolite_outputnode(audiolite_component *cmp);
     ~audiolite_outputnode();
@@ -0,0 +1,142 @@
+/****************************************************************************
+ * modules/include/audiolite/al_profile.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_AUDIOLITE_PROFILE_H
+#define __INCLUDE_AUDIOLITE_PROFILE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define AL_PROFILE_MAXINPUTS  (4)
+
+/****************************************************************************
+ * Class Pre-definitions
+ ****************************************************************************/
+
+class audiolite_component;
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Statistics of a duration in micro seconds */
+
+struct al_profile_time_s
+{
+  uint32_t count;
+  uint64_t total_us;
+  uint32_t max_us;
+  uint32_t last_us;
+};
+
+/* Snapshot of a component */
+
+struct al_profile_s
+{
+  const char *name;
+
+  /* Time spent in on_data() */
+
+  struct al_profile_time_s on_data;
+
+  /* Number of memory queued on each input node */
+
+  int innum;
+  int in_depth[AL_PROFILE_MAXINPUTS];
+  int in_maxdepth[AL_PROFILE_MAXINPUTS];
+
+  /* Round trip of input/output memory on a worker (sub-core) */
+
+  struct al_profile_time_s wk_in;
+  struct al_profile_time_s wk_out;
+};
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+static inline void al_profile_time_add(struct al_profile_time_s *t,
+                                       uint32_t us)
+{
+  t->count++;
+  t->total_us += us;
+  t->last_us = us;
+  if (t->max_us < us)
+    {
+      t->max_us = us;
+    }
+}
+
+static inline void al_profile_depth_add(int *depth, int *maxdepth, int n)
+{
+  int d = __atomic_add_fetch(depth, n, __ATOMIC_RELAXED);
+  int cur = __atomic_load_n(maxdepth, __ATOMIC_RELAXED);
+
+  while (d > cur &&
+         !__atomic_compare_exchange_n(maxdepth, &cur, d, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/* Free running clock in micro seconds for profiling */
+
+uint32_t audiolite_profile_us(void);
+
+/* Print profiles of all components. Needs CONFIG_AUDIO_LITE_PROFILE. */
+
+void audiolite_profile_dump(void);
+
+/* Clear profiles of all components */
+
+void audiolite_profile_reset(void);
+
+/* Components add themselves to the list printed by the dump */
+
+void audiolite_profile_register(audiolite_component *comp);
+void audiolite_profile_unregister(audiolite_component *comp);
+
+#endif /* __INCLUDE_AUDIOLITE_PROFILE_H */
@@ -0,0 +1,105 @@
+/****************************************************************************
+ * modules/include/audiolite/al_resampler.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_AUDIOLITE_RESAMPLER_H
+#define __INCLUDE_AUDIOLITE_RESAMPLER_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <audiolite/al_workercomp.h>
+#include <audiolite/al_workercmd.h>
+#include <audiolite/alworker_resampler.h>
+
+/****************************************************************************
+ * Class Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * class: audiolite_resampler
+ *
+ * Converts 16bit PCM from any sampling rate to the system sampling rate
+ * on a sub-core. Input rate is taken from the first input memory
+ * (audiolite_mem::get_fs()) unless set_inputrate() is called.
+ * Output memory pool should be set by set_mempool() before start.
+ ****************************************************************************/
+
+class audiolite_resampler : public audiolite_workercomp
+{
+  protected:
+    class resampler_msglistener : public audiolite_stdworker_msglistener
+    {
+      public:
+        virtual ~resampler_msglistener(){};
+        void bootup(audiolite_workercomp *wcomp, al_wtask_t *wtask,
+                    int version, void *d);
+        void error(audiolite_workercomp *wcomp, al_wtask_t *wtask,
+                   int id, int ercode);
+        void info(audiolite_workercomp *wcomp, al_wtask_t *wtask,
+                  int id, int chs, int fs, int layer, int rate);
+    };
+
+    resampler_msglistener _msglsnr;
+    int _inhz;
+    int _quality;
+    int _actual_quality;
+    bool _play_sent;
+
+  public:
+    audiolite_resampler();
+    virtual ~audiolite_resampler();
+
+    /* Set 0 to use the rate stored in input memory */
+
+    void set_inputrate(int hz) { _inhz = hz; };
+
+    /* AL_RESAMPLER_QUALITY_MIN to AL_RESAMPLER_QUALITY_MAX */
+
+    void set_quality(int q) { _quality = q; };
+
+    /* Quality level actually used by the worker. -1 until started. */
+
+    int quality() { return _actual_quality; };
+
+    /* Inherited methods from audiolite_workercomp */
+
+    virtual void on_data();
+    virtual int on_starting(audiolite_inputnode *inode,
+                            audiolite_outputnode *onode);
+};
+
+#endif /* __INCLUDE_AUDIOLITE_RESAMPLER_H */
@@ -42,10 +42,12 @@
 
 #include <nuttx/config.h>
 
+#include <errno.h>
 #include <stdio.h>
 
 #include <mossfw/mossfw_lock.h>
 #include <audiolite/al_memalloc.h>
+#include <audiolite/al_thread.h>
 
 /****************************************************************************
  * Class Definitions
@@ -80,25 +82,209 @@ class audiolite_stream
  * class: audiolite_filestream
  ****************************************************************************/
 
-class audiolite_filestream : public audiolite_stream
+class audiolite_filestream : public audiolite_stream,
+                             audiolite_runnable_if
 {
   private:
     FILE *_fp;
     bool _self_open;
+    bool _rdmode;
     mossfw_lock_t _lock;
 
+    /* Read-ahead. _lock is held during file access of the thread. */
+
+    audiolite_thread _rathd;
+    audiolite_timeprofile *_raprof;
+    char *_rabuf;
+    int *_ralen;
+    int _radepth;
+    int _rablksz;
+    int _rahead;
+    int _rafilled;
+    int _rahofst;
+    long _rapos;
+    uint32_t _ragen;
+    volatile bool _rarun;
+    bool _raeof;
+    mossfw_lock_t _ralock;
+    mossfw_condition_t _racond;
+
     int open_file(const char *fname, const char *flg);
+    int ra_reset(long pos);
+    int ra_read(char *data, int sz);
+    int ra_level();
+    bool ra_ended();
 
   public:
-    audiolite_filestream() : _fp(NULL), _self_open(false)
+    audiolite_filestream();
+    ~audiolite_filestream();
+
+    /* Read files in another thread with depth blocks of blksz bytes.
+     * depth 0 disables it. Fill level of the blocks is put on prof
+     * if it is given. A stream opened by wfile() can't read ahead.
+     */
+
+    int set_readahead(int depth = CONFIG_ALFSTREAM_RADEPTH,
+                      int blksz = CONFIG_ALFSTREAM_RABLKSZ,
+                      audiolite_timeprofile *prof = NULL);
+
+    int rfile(const char *fname);
+    int wfile(const char *fname);
+    int set_file(FILE *fp);
+
+    void close();
+    int filesize();
+    int seek(int size);
+    int seekcur(int size);
+    int seekend(int size);
+    bool has_file();
+
+    int read_data(void *data, int sz, int toms);
+    int write_data(void *data, int sz, int toms);
+    int receive_data(audiolite_mem *mem, int ofst, int toms);
+    int send_data(audiolite_mem *mem, int ofst, int toms);
+
+    /* Inherited methods from audiolite_runnable_if */
+
+    int run(void *arg);
+    void before_stop(void *arg);
+};
+
+/****************************************************************************
+ * class: audiolite_memstream
+ *
+ * Stream on a RAM buffer. set_buffer() gives data to read, and
+ * set_wbuffer() gives an area to write.
+ ****************************************************************************/
+
+class audiolite_memstream : public audiolite_stream
+{
+  private:
+    char *_buf;
+    int _size;
+    int _stored;
+    int _pos;
+    bool _writable;
+    mossfw_lock_t _lock;
+
+    int set_pos(int pos);
+
+  public:
+    audiolite_memstream() : _buf(NULL), _size(0), _stored(0), _pos(0),
+                            _writable(false)
     {
       mossfw_lock_init(&_lock);
     };
-    ~audiolite_filestream();
+    ~audiolite_memstream();
+
+    int set_buffer(const void *buf, int sz);
+    int set_wbuffer(void *buf, int sz);
+    int storedsize() { return _stored; };
+
+    int rfile(const char *fname) { return -ENOTSUP; };
+    int wfile(const char *fname) { return -ENOTSUP; };
+
+    void close();
+    int filesize();
+    int seek(int size);
+    int seekcur(int size);
+    int seekend(int size);
+    bool has_file();
+
+    int read_data(void *data, int sz, int toms);
+    int write_data(void *data, int sz, int toms);
+    int receive_data(audiolite_mem *mem, int ofst, int toms);
+    int send_data(audiolite_mem *mem, int ofst, int toms);
+};
+
+/****************************************************************************
+ * class: audiolite_fdstream
+ *
+ * Stream on a file descriptor such as a socket or a pipe.
+ * toms of read/write is a timeout in milli seconds. Negative value waits
+ * until all of the size is done or the peer is closed, and 0 does not
+ * wait at all. -EAGAIN is returned if no data is done in the time.
+ * On a descriptor without seek, seek() and seekcur() can only skip
+ * forward by reading the data.
+ ****************************************************************************/
+
+class audiolite_fdstream : public audiolite_stream
+{
+  private:
+    int _fd;
+    bool _self_open;
+    bool _seekable;
+    bool _eof;
+    int _pos;
+    mossfw_lock_t _lock;
+
+    int open_fd(const char *fname, int flags);
+    int wait_fd(int events, int toms);
+    int skip(int size);
+
+  public:
+    audiolite_fdstream() : _fd(-1), _self_open(false), _seekable(false),
+                           _eof(false), _pos(0)
+    {
+      mossfw_lock_init(&_lock);
+    };
+    ~audiolite_fdstream();
 
     int rfile(const char *fname);
     int wfile(const char *fname);
-    int set_file(FILE *fp);
+    int set_fd(int fd);
+
+    void close();
+    int filesize();
+    int seek(int size);
+    int seekcur(int size);
+    int seekend(int size);
+    bool has_file();
+
+    int read_data(void *data, int sz, int toms);
+    int write_data(void *data, int sz, int toms);
+    int receive_data(audiolite_mem *mem, int ofst, int toms);
+    int send_data(audiolite_mem *mem, int ofst, int toms);
+};
+
+/****************************************************************************
+ * class: audiolite_ringstream
+ *
+ * Stream on a ring buffer between a producer thread (write_data) and a
+ * decoder (read_data). The producer calls set_eos() after the last data,
+ * then the reader gets EOF when the ring becomes empty. toms works as
+ * the same as audiolite_fdstream.
+ ****************************************************************************/
+
+class audiolite_ringstream : public audiolite_stream
+{
+  private:
+    char *_buf;
+    int _size;
+    int _rpos;
+    int _stored;
+    int _rtotal;
+    bool _ownbuf;
+    bool _eos;
+    bool _closed;
+    mossfw_lock_t _lock;
+    mossfw_condition_t _cond;
+
+    int wait_locked(struct timespec *limit);
+    int skip(int size);
+
+  public:
+    audiolite_ringstream(int size);
+    audiolite_ringstream(void *buf, int size);
+    ~audiolite_ringstream();
+
+    void set_eos();
+    void reset();
+    int remaining();
+    int space();
+
+    int rfile(const char *fname) { return -ENOTSUP; };
+    int wfile(const char *fname) { return -ENOTSUP; };
 
     void close();
     int filesize();
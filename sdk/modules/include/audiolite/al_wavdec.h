@@ -57,14 +57,20 @@ class audiolite_wavdec : public audiolite_decoder
     int _chnum;
     int _bitlen;
     int _samplerate;
+    int _fmttype;
+    int _blksize;
+    uint32_t _data_remain;
     bool _eof;
 
     void decode_runner();
     int parse_wavhdr();
+    int parse_fmtchunk(uint32_t size);
+    int read_pcm16(audiolite_mem *mem);
 
   public:
     audiolite_wavdec() : audiolite_decoder("wavdec"),
                          _chnum(-1), _bitlen(-1), _samplerate(-1),
+                         _fmttype(-1), _blksize(0), _data_remain(0),
                          _eof(false) {};
     ~audiolite_wavdec(){};
 
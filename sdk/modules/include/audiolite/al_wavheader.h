@@ -51,8 +51,14 @@
 #define FMTCNK_ID "fmt "
 #define FMTCNK_SZ (16)
 #define FMT_WAV   (1)
+#define FMT_FLOAT (3)
+#define FMT_EXTENSIBLE (0xfffe)
 #define DATACNK_ID "data"
 
+#define FMTCNK_EXTSZ (40)
+#define RIFF_HDRSZ   (12)
+#define CHUNK_HDRSZ  (8)
+
 /****************************************************************************
  * Public Data Types
  ****************************************************************************/
@@ -74,4 +80,32 @@ struct al_wavhdr
   uint32_t data_chunk_size;
 };
 
+/* Header of each chunk in RIFF WAVE file.
+ * Chunks are placed on 2 bytes alignment.
+ */
+
+struct al_chunkhdr
+{
+  uint8_t chunk_id[4];
+  uint32_t chunk_size;
+};
+
+/* Contents of "fmt " chunk including WAVE_FORMAT_EXTENSIBLE fields.
+ * Only the first FMTCNK_SZ bytes are valid for PCM/IEEE float format.
+ */
+
+struct al_wavfmt
+{
+  uint16_t wave_format_type;
+  uint16_t channel;
+  uint32_t samples_per_sec;
+  uint32_t bytes_per_sec;
+  uint16_t block_size;
+  uint16_t bits_per_sample;
+  uint16_t ext_size;
+  uint16_t valid_bits;
+  uint32_t channel_mask;
+  uint8_t sub_format[16];  /* First 2 bytes are format type */
+};
+
 #endif /* __INCLUDE_AUDIOLITE_WAVHEADER_H */
@@ -45,6 +45,7 @@
 #include <nuttx/queue.h>
 #include <mossfw/mossfw_lock.h>
 #include <audiolite/al_memalloc.h>
+#include <audiolite/al_profile.h>
 #include <audiolite/alworker_comm.h>
 
 /****************************************************************************
@@ -78,6 +79,9 @@ class audiolite_workermemq
     mossfw_lock_t _lock;
     mossfw_condition_t _cond;
     struct dq_queue_s _mem_proc;
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    struct al_profile_time_s _prof;
+#endif
 
   public:
     audiolite_workermemq(int maxsz);
@@ -91,6 +95,16 @@ class audiolite_workermemq
     audiolite_memapbuf *pop(unsigned char *addr);
     int get_qsize() { return _max_qsz; };
     int current_sz() { return dq_count(&_mem_proc); };
+
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    /* Call with memory which came back from the worker to measure
+     * the time since push().
+     */
+
+    void record_roundtrip(audiolite_memapbuf *mem);
+    void get_profile(struct al_profile_time_s *prof);
+    void reset_profile();
+#endif
 };
 
 /****************************************************************************
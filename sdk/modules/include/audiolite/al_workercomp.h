@@ -102,6 +102,11 @@ class audiolite_workercomp : public audiolite_component, audiolite_runnable_if
     int start_worker();
     void stop_worker();
 
+#ifdef CONFIG_AUDIO_LITE_PROFILE
+    virtual void get_subprofile(struct al_profile_s *prof);
+    virtual void reset_subprofile();
+#endif
+
   public:
     audiolite_workercomp(const char *workername,
                          int inqsz,
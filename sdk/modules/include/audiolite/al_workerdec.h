@@ -0,0 +1,155 @@
+/****************************************************************************
+ * modules/include/audiolite/al_workerdec.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_AUDIOLITE_WORKERDEC_H
+#define __INCLUDE_AUDIOLITE_WORKERDEC_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <audiolite/al_workercomp.h>
+#include <audiolite/al_workercmd.h>
+#include <audiolite/al_stream.h>
+
+/****************************************************************************
+ * Class Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * class: audiolite_workerdec
+ *
+ * Base of decoder components which run their codec on a sub-core worker
+ * built with alworker_commfw. Compressed data is read from the stream set
+ * by set_stream() into memories of set_inputmempool(), and decoded PCM
+ * comes back in memories of the pool set by set_mempool().
+ * The stream is read on the injection thread of the component, so a slow
+ * stream does not hold back messages from the worker.
+ * As a source component, it is started by start() like audiolite_decoder.
+ ****************************************************************************/
+
+class audiolite_workerdec : public audiolite_workercomp
+{
+  protected:
+    class workerdec_msglistener : public audiolite_stdworker_msglistener
+    {
+      public:
+        virtual ~workerdec_msglistener(){};
+        void bootup(audiolite_workercomp *wcomp, al_wtask_t *wtask,
+                    int version, void *d);
+        void error(audiolite_workercomp *wcomp, al_wtask_t *wtask,
+                   int id, int ercode);
+        void info(audiolite_workercomp *wcomp, al_wtask_t *wtask,
+                  int id, int chs, int fs, int layer, int rate);
+        void done(audiolite_workercomp *wcomp, al_wtask_t *wtask, int id);
+        audiolite_memapbuf *release_inmem(audiolite_workercomp *wcomp,
+                                          al_wtask_t *wtask,
+                                          audiolite_memapbuf *mem,
+                                          int size);
+        audiolite_memapbuf *release_outmem(audiolite_workercomp *wcomp,
+                                           al_wtask_t *wtask,
+                                           audiolite_memapbuf *mem);
+    };
+
+    workerdec_msglistener _declsnr;
+    audiolite_stream *_stream;
+    audiolite_mempoolapbuf *_imempool;
+
+    /* Input memories waiting to be filled by the injection thread */
+
+    audiolite_workermemq _rdq;
+
+    bool _runner_evt;
+    mossfw_lock_t _evtlock;
+    mossfw_condition_t _evtcond;
+    int _version;
+    volatile bool _frame_eof;
+    int _dec_chs;
+    int _dec_fs;
+    int _dec_kbps;
+
+    void read_stream(audiolite_memapbuf *mem);
+    void flush_readq();
+
+    /* Block run() until notify_runner() is called. It is called when
+     * an input memory is queued, an output memory is freed or the
+     * thread is stopped.
+     */
+
+    void wait_runner();
+    void notify_runner();
+
+    static void pool_event(void *arg);
+
+    /* Called just before the start message is sent to the worker.
+     * Set decoder specific options into opt->usr[].
+     */
+
+    virtual void set_playopt(al_comm_msgopt_t *opt) {};
+
+  public:
+    audiolite_workerdec(const char *workername, int version,
+                        int inqsz, int outqsz);
+    virtual ~audiolite_workerdec();
+
+    void set_stream(audiolite_stream *st) { _stream = st; };
+    void set_inputmempool(audiolite_mempoolapbuf *pool)
+    {
+      _imempool = pool;
+    };
+
+    /* Format of decoded PCM reported by the worker. 0 until decoded. */
+
+    int decoded_channels() { return _dec_chs; };
+    int decoded_samplingrate() { return _dec_fs; };
+    int decoded_kbps() { return _dec_kbps; };
+
+    /* Inherited methods from audiolite_workercomp */
+
+    virtual int on_starting(audiolite_inputnode *inode,
+                            audiolite_outputnode *onode);
+    virtual void on_canceled(audiolite_inputnode *inode,
+                             audiolite_outputnode *onode);
+    virtual void on_stopping(audiolite_inputnode *inode,
+                             audiolite_outputnode *onode);
+
+    /* Inherited methods from audiolite_runnable_if */
+
+    virtual int run(void *arg);
+    virtual void before_stop(void *arg);
+};
+
+#endif /* __INCLUDE_AUDIOLITE_WORKERDEC_H */
@@ -0,0 +1,64 @@
+/****************************************************************************
+ * modules/include/audiolite/alworker_aacdec.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __AUDIOLITE_INCLUDE_ALWORKER_AACDEC_H
+#define __AUDIOLITE_INCLUDE_ALWORKER_AACDEC_H
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Common definitions between the aacdec worker and
+ * audiolite_aacdec component.
+ */
+
+#define AL_AACDEC_WORKER_VERSION  (1)
+
+#define AL_AACDEC_MAXCHS          (2)
+#define AL_AACDEC_IMEM_QSIZE      (8)
+#define AL_AACDEC_OMEM_QSIZE      (8)
+
+/* One AAC-LC frame has 1024 samples per channel, and its size is up to
+ * 6144 bits per channel. ADTS header adds 7 or 9 bytes to it.
+ */
+
+#define AL_AACDEC_FRAMESAMPLES    (1024)
+#define AL_AACDEC_MAXFRAMEBYTES   (768 * AL_AACDEC_MAXCHS + 9)
+
+/* Audio object type reported as layer of frame information */
+
+#define AL_AACDEC_PROFILE_LC      (1)
+
+#endif  /* __AUDIOLITE_INCLUDE_ALWORKER_AACDEC_H */
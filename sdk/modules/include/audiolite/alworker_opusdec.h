@@ -0,0 +1,78 @@
+/****************************************************************************
+ * modules/include/audiolite/alworker_opusdec.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __AUDIOLITE_INCLUDE_ALWORKER_OPUSDEC_H
+#define __AUDIOLITE_INCLUDE_ALWORKER_OPUSDEC_H
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Common definitions between the opusdec worker and
+ * audiolite_opusdec component.
+ */
+
+#define AL_OPUSDEC_WORKER_VERSION (1)
+
+#define AL_OPUSDEC_MAXCHS         (2)
+#define AL_OPUSDEC_IMEM_QSIZE     (8)
+#define AL_OPUSDEC_OMEM_QSIZE     (8)
+
+/* Largest packet and frame the worker can decode.
+ * A frame is up to 60ms at 48kHz.
+ */
+
+#define AL_OPUSDEC_MAXPACKET      (1500)
+#define AL_OPUSDEC_MAXFRAME       (2880)
+
+/* Framing of Opus packets in the stream.
+ *
+ * AL_OPUSDEC_FRAMING_LEN8 :
+ *   1 byte packet length and the packet. This is the format which
+ *   audio recorder of this SDK stores.
+ * AL_OPUSDEC_FRAMING_LEN32 :
+ *   4 bytes packet length, 4 bytes final range of the encoder and
+ *   the packet, in big endian. This is the format of opus_demo, and
+ *   audio recorder stores it with CONFIG_AUDIOUTILS_UNUSE_ORIGINAL_OPUS_FORMAT.
+ */
+
+#define AL_OPUSDEC_FRAMING_LEN8   (0)
+#define AL_OPUSDEC_FRAMING_LEN32  (1)
+
+/* Index of al_comm_msgopt_t::usr[] in SYS_PLAY message */
+
+#define AL_OPUSDEC_OPT_FRAMING    (0)
+
+#endif  /* __AUDIOLITE_INCLUDE_ALWORKER_OPUSDEC_H */
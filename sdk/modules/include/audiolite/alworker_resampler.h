@@ -0,0 +1,69 @@
+/****************************************************************************
+ * modules/include/audiolite/alworker_resampler.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __AUDIOLITE_INCLUDE_ALWORKER_RESAMPLER_H
+#define __AUDIOLITE_INCLUDE_ALWORKER_RESAMPLER_H
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Common definitions between the resampler worker and
+ * audiolite_resampler component.
+ */
+
+#define AL_RESAMPLER_WORKER_VERSION (1)
+
+#define AL_RESAMPLER_MAXCHS         (8)
+#define AL_RESAMPLER_IMEM_QSIZE     (8)
+#define AL_RESAMPLER_OMEM_QSIZE     (8)
+
+/* Quality level (0 to 10). Higher needs more CPU time.
+ * If the filter of the level does not fit in the worker,
+ * the worker chooses lower level automatically.
+ */
+
+#define AL_RESAMPLER_QUALITY_MIN     (0)
+#define AL_RESAMPLER_QUALITY_LOW     (1)
+#define AL_RESAMPLER_QUALITY_MEDIUM  (3)
+#define AL_RESAMPLER_QUALITY_HIGH    (5)
+#define AL_RESAMPLER_QUALITY_MAX     (10)
+
+/* Index of al_comm_msgopt_t::usr[] in SYS_PLAY message */
+
+#define AL_RESAMPLER_OPT_INHZ       (0)
+#define AL_RESAMPLER_OPT_QUALITY    (1)
+
+#endif  /* __AUDIOLITE_INCLUDE_ALWORKER_RESAMPLER_H */
@@ -40,6 +40,7 @@
  * Included Files
  ****************************************************************************/
 
+#include <audiolite/al_aacdec.h>
 #include <audiolite/al_audiodrv.h>
 #include <audiolite/al_component.h>
 #include <audiolite/al_debug.h>
@@ -50,10 +51,14 @@
 #include <audiolite/al_inputcomp.h>
 #include <audiolite/al_inputnode.h>
 #include <audiolite/al_memalloc.h>
+#include <audiolite/al_mixer.h>
 #include <audiolite/al_mp3dec.h>
 #include <audiolite/al_nodecomm.h>
+#include <audiolite/al_opusdec.h>
 #include <audiolite/al_outputcomp.h>
 #include <audiolite/al_outputnode.h>
+#include <audiolite/al_profile.h>
+#include <audiolite/al_resampler.h>
 #include <audiolite/al_stream.h>
 #include <audiolite/al_wavdec.h>
 #include <audiolite/al_wavenc.h>
@@ -62,7 +67,11 @@
 #include <audiolite/al_thread.h>
 #include <audiolite/al_workercmd.h>
 #include <audiolite/al_workercomp.h>
+#include <audiolite/al_workerdec.h>
+#include <audiolite/alworker_aacdec.h>
 #include <audiolite/alworker_comm.h>
+#include <audiolite/alworker_opusdec.h>
+#include <audiolite/alworker_resampler.h>
 #include <audiolite/sprmp3dec_qsize.h>
 
 #endif /* __INCLUDE_AUDIOLITE_H */
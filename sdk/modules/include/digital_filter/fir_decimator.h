@@ -62,6 +62,29 @@ typedef struct
   arm_fir_decimate_instance_f32 inst;
 } decimator_instancef_t;
 
+typedef struct
+{
+  arm_fir_decimate_instance_q15 inst;
+} decimator_instanceq15_t;
+
+typedef struct
+{
+  arm_fir_decimate_instance_q31 inst;
+} decimator_instanceq31_t;
+
+/** Maximum number of stages of multistage decimator */
+
+#define DECIMATOR_MAX_STAGES  (4)
+
+typedef struct
+{
+  int stages;       /**< Number of stages */
+  int M;            /**< Total decimation factor */
+  int blocksz;      /**< Input samples in one calculation */
+  decimator_instancef_t *stage[DECIMATOR_MAX_STAGES];
+  float *work[2];   /**< Output buffers of intermediate stages */
+} multistage_decimatorf_t;
+
 /** @} fir_decimator_datatype */
 
 #else
@@ -148,6 +171,223 @@ int decimator_tapnumf(decimator_instancef_t *dec);
  */
 void decimator_deletef(decimator_instancef_t *dec);
 
+/**
+ * @name q15 fixed-point decimators
+ *
+ * Same as the float version, but input and output are q15_t.
+ * The coefficients are designed in float and quantized at create time.
+ * arm_fir_decimate_fast_q15() is used for the calculation.
+ * @{
+ */
+
+/**
+ * Create q15 FIR Decimator intance
+ *
+ * @param [in] fs: Sampling rate of input signals.
+ * @param [in] dec_factor: Decimation factor.
+ * @param [in] tr_width: Transition frequency band width of Low Pass Filter(Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return decimator_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of decimator_instanceq15_t, so you
+ *       free when you finished to use the filter by decimator_deleteq15().
+ */
+decimator_instanceq15_t *create_decimatorq15(int fs, int dec_factor,
+    int tr_width, int blocksz);
+
+/**
+ * Create q15 FIR Decimator intance with Tap size
+ *
+ * @param [in] fs: Sampling rate of input signals.
+ * @param [in] dec_factor: Decimation factor.
+ * @param [in] taps: Tap size of FIR filter.
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return decimator_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of decimator_instanceq15_t, so you
+ *       free when you finished to use the filter by decimator_deleteq15().
+ */
+decimator_instanceq15_t *create_decimatorq15_tap(int fs, int dec_factor,
+    int taps, int blocksz);
+
+/**
+ * Execute q15 Decimation
+ *
+ * @param [in] dec: Instance of decimator_instanceq15_t.
+ * @param [in] input: q15_t array of input data.
+ * @param [in] input_len: Length of input array. This size must be multiple of
+ *                  blocksz set by create_decimatorq15().
+ * @param [out] output: q15_t array of output data.
+ * @param [in] output_len: Length of output array.
+ *
+ * @return Decimated data length, means size of output data.
+ */
+int decimator_executeq15(decimator_instanceq15_t *dec, q15_t *input,
+    int input_len, q15_t *output, int output_len);
+
+/**
+ * Get tap number of q15 Decimator instance
+ *
+ * @param [in] dec: Instance of decimator_instanceq15_t.
+ *
+ * @return Tap number of the FIR filter.
+ */
+int decimator_tapnumq15(decimator_instanceq15_t *dec);
+
+/**
+ * Delete q15 Decimator instance
+ *
+ * @param [in] dec: Instance of decimator_instanceq15_t.
+ */
+void decimator_deleteq15(decimator_instanceq15_t *dec);
+
+/** @} */
+
+/**
+ * @name q31 fixed-point decimators
+ *
+ * Same as the float version, but input and output are q31_t.
+ * The coefficients are designed in float and quantized at create time.
+ * arm_fir_decimate_fast_q31() is used for the calculation.
+ * @{
+ */
+
+/**
+ * Create q31 FIR Decimator intance
+ *
+ * @param [in] fs: Sampling rate of input signals.
+ * @param [in] dec_factor: Decimation factor.
+ * @param [in] tr_width: Transition frequency band width of Low Pass Filter(Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return decimator_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of decimator_instanceq31_t, so you
+ *       free when you finished to use the filter by decimator_deleteq31().
+ */
+decimator_instanceq31_t *create_decimatorq31(int fs, int dec_factor,
+    int tr_width, int blocksz);
+
+/**
+ * Create q31 FIR Decimator intance with Tap size
+ *
+ * @param [in] fs: Sampling rate of input signals.
+ * @param [in] dec_factor: Decimation factor.
+ * @param [in] taps: Tap size of FIR filter.
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return decimator_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of decimator_instanceq31_t, so you
+ *       free when you finished to use the filter by decimator_deleteq31().
+ */
+decimator_instanceq31_t *create_decimatorq31_tap(int fs, int dec_factor,
+    int taps, int blocksz);
+
+/**
+ * Execute q31 Decimation
+ *
+ * @param [in] dec: Instance of decimator_instanceq31_t.
+ * @param [in] input: q31_t array of input data.
+ * @param [in] input_len: Length of input array. This size must be multiple of
+ *                  blocksz set by create_decimatorq31().
+ * @param [out] output: q31_t array of output data.
+ * @param [in] output_len: Length of output array.
+ *
+ * @return Decimated data length, means size of output data.
+ */
+int decimator_executeq31(decimator_instanceq31_t *dec, q31_t *input,
+    int input_len, q31_t *output, int output_len);
+
+/**
+ * Get tap number of q31 Decimator instance
+ *
+ * @param [in] dec: Instance of decimator_instanceq31_t.
+ *
+ * @return Tap number of the FIR filter.
+ */
+int decimator_tapnumq31(decimator_instanceq31_t *dec);
+
+/**
+ * Delete q31 Decimator instance
+ *
+ * @param [in] dec: Instance of decimator_instanceq31_t.
+ */
+void decimator_deleteq31(decimator_instanceq31_t *dec);
+
+/** @} */
+
+/**
+ * Create Multistage FIR Decimator instance
+ *
+ * dec_factor is split into up to DECIMATOR_MAX_STAGES stages so that
+ * the number of MACs per output sample is the smallest. Earlier stages
+ * get relaxed transition bands because only the final pass band must be
+ * protected from aliasing.
+ *
+ * @param [in] fs: Sampling rate of input signals.
+ * @param [in] dec_factor: Total decimation factor.
+ * @param [in] tr_width: Transition frequency band width of the final
+ *                       Low Pass Filter(Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time.
+ *                      It must be multiple of dec_factor. (samples)
+ *
+ * @return multistage_decimatorf_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of multistage_decimatorf_t,
+ *       so you free when you finished to use the filter by
+ *       multistage_decimator_deletef().
+ */
+multistage_decimatorf_t *create_multistage_decimatorf(int fs, int dec_factor,
+    int tr_width, int blocksz);
+
+/**
+ * Execute Multistage Decimation
+ *
+ * @param [in] dec: Instance of multistage_decimatorf_t.
+ * @param [in] input: float array of input data.
+ * @param [in] input_len: Length of input array. This size must be multiple of
+ *                  blocksz set by create_multistage_decimatorf().
+ * @param [out] output: float array of output data.
+ * @param [in] output_len: Length of output array.
+ *
+ * @return Decimated data length, means size of output data.
+ *         -1 if output_len is too small.
+ */
+int multistage_decimator_executef(multistage_decimatorf_t *dec, float *input,
+    int input_len, float *output, int output_len);
+
+/**
+ * Get number of stages of Multistage Decimator instance
+ *
+ * @param [in] dec: Instance of multistage_decimatorf_t.
+ *
+ * @return Number of stages.
+ */
+int multistage_decimator_stagesf(multistage_decimatorf_t *dec);
+
+/**
+ * Get decimation factor and tap number of a stage
+ *
+ * @param [in] dec: Instance of multistage_decimatorf_t.
+ * @param [in] stage: Index of the stage. (0 origin)
+ * @param [out] factor: Decimation factor of the stage.
+ * @param [out] taps: Tap number of the stage.
+ *
+ * @return 0 on success, -1 if stage is out of range.
+ */
+int multistage_decimator_stageinfof(multistage_decimatorf_t *dec, int stage,
+    int *factor, int *taps);
+
+/**
+ * Delete Multistage Decimator instance
+ *
+ * @param [in] dec: Instance of multistage_decimatorf_t.
+ */
+void multistage_decimator_deletef(multistage_decimatorf_t *dec);
+
 /** @} fir_decimator_funcs */
 
 #  undef EXTERN
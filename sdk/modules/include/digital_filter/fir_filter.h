@@ -63,6 +63,18 @@
  */
 typedef arm_fir_instance_f32 fir_instancef_t;
 
+/**
+ * @typedef fir_instanceq15_t
+ * Wrap type of arm_fir_instance_q15
+ */
+typedef arm_fir_instance_q15 fir_instanceq15_t;
+
+/**
+ * @typedef fir_instanceq31_t
+ * Wrap type of arm_fir_instance_q31
+ */
+typedef arm_fir_instance_q31 fir_instanceq31_t;
+
 /** @} fir_datatype */
 
 #else
@@ -262,6 +274,375 @@ void firabs_executef(fir_instancef_t *fir, float *input, float *output, int len)
  */
 void fir_deletef(fir_instancef_t *fir);
 
+/**
+ * @name q15 fixed-point filters
+ *
+ * Same as the float version, but input and output are q15_t.
+ * The coefficients are designed in float and quantized at create time.
+ * arm_fir_fast_q15() is used for the calculation, so scale the input down
+ * by log2(tap number) bits if the accumulated sum can overflow.
+ * @{
+ */
+
+/**
+ * Create q15 FIR Low Pass Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_lpfq15(int fs, int cutoff_freq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q15 FIR Low Pass Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_lpfq15_tap(int fs, int cutoff_freq,
+    int taps, int blocksz);
+
+/**
+ * Create q15 FIR High Pass Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_hpfq15(int fs, int cutoff_freq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q15 FIR High Pass Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_hpfq15_tap(int fs, int cutoff_freq,
+    int taps, int blocksz);
+
+/**
+ * Create q15 FIR Band Pass Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_bpfq15(int fs, int lower_cutfreq, int higher_cutfreq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q15 FIR Band Pass Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_bpfq15_tap(int fs, int lower_cutfreq, int higher_cutfreq,
+    int taps, int blocksz);
+
+/**
+ * Create q15 FIR Band Elimination Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_befq15(int fs, int lower_cutfreq, int higher_cutfreq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q15 FIR Band Elimination Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq15_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq15_t, so you
+ *       free when you finished to use the filter by fir_deleteq15().
+ */
+fir_instanceq15_t * fir_create_befq15_tap(int fs, int lower_cutfreq, int higher_cutfreq,
+    int taps, int blocksz);
+
+/**
+ * Get tap number of created q15 FIR filter instance
+ *
+ * @param [in] fir: Target instance of fir_instanceq15_t to get tap number from.
+ *
+ * @return Tap number.
+ *         (q15 filters have an even tap number. A zero last tap is added.)
+ */
+int fir_get_tapnumq15(fir_instanceq15_t *fir);
+
+/**
+ * Execute q15 FIR filter
+ *
+ * @param [in] fir: Instance of fir_instanceq15_t.
+ * @param [in] input: q15_t array of input data.
+ * @param [out] output: q15_t array of output data.
+ * @param [in] len: Length of arrays. This size must be multiple of blocksz set
+ *                  by fir_create_xxxq15().
+ */
+void fir_executeq15(fir_instanceq15_t *fir, q15_t *input, q15_t *output,
+    int len);
+
+/**
+ * Execute q15 FIR filter and calculate the avsolute value
+ *
+ * @param [in] fir: Instance of fir_instanceq15_t.
+ * @param [in] input: q15_t array of input data.
+ * @param [out] output: q15_t array of output data.
+ * @param [in] len: Length of arrays. This size must be multiple of blocksz set
+ *                  by fir_create_xxxq15().
+ */
+void firabs_executeq15(fir_instanceq15_t *fir, q15_t *input, q15_t *output,
+    int len);
+
+/**
+ * Delete q15 FIR instance
+ *
+ * @param [in] fir: Instance of fir_instanceq15_t.
+ */
+void fir_deleteq15(fir_instanceq15_t *fir);
+
+/** @} */
+
+/**
+ * @name q31 fixed-point filters
+ *
+ * Same as the float version, but input and output are q31_t.
+ * The coefficients are designed in float and quantized at create time.
+ * arm_fir_fast_q31() is used for the calculation, so scale the input down
+ * by log2(tap number) bits if the accumulated sum can overflow.
+ * @{
+ */
+
+/**
+ * Create q31 FIR Low Pass Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_lpfq31(int fs, int cutoff_freq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q31 FIR Low Pass Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_lpfq31_tap(int fs, int cutoff_freq,
+    int taps, int blocksz);
+
+/**
+ * Create q31 FIR High Pass Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_hpfq31(int fs, int cutoff_freq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q31 FIR High Pass Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cuttoff_freq: Cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_hpfq31_tap(int fs, int cutoff_freq,
+    int taps, int blocksz);
+
+/**
+ * Create q31 FIR Band Pass Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_bpfq31(int fs, int lower_cutfreq, int higher_cutfreq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q31 FIR Band Pass Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_bpfq31_tap(int fs, int lower_cutfreq, int higher_cutfreq,
+    int taps, int blocksz);
+
+/**
+ * Create q31 FIR Band Elimination Filter coefficients
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] tr_width: Transition frequency band width. (Hz)
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_befq31(int fs, int lower_cutfreq, int higher_cutfreq,
+    int tr_width, int blocksz);
+
+/**
+ * Create q31 FIR Band Elimination Filter coefficients with Tap size
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz)
+ * @param [in] taps: Tap size
+ * @param [in] blocksz: Block size to execute filter calcuation in one time. (samples)
+ *
+ * @return fir_instanceq31_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of fir_instanceq31_t, so you
+ *       free when you finished to use the filter by fir_deleteq31().
+ */
+fir_instanceq31_t * fir_create_befq31_tap(int fs, int lower_cutfreq, int higher_cutfreq,
+    int taps, int blocksz);
+
+/**
+ * Get tap number of created q31 FIR filter instance
+ *
+ * @param [in] fir: Target instance of fir_instanceq31_t to get tap number from.
+ *
+ * @return Tap number.
+ */
+int fir_get_tapnumq31(fir_instanceq31_t *fir);
+
+/**
+ * Execute q31 FIR filter
+ *
+ * @param [in] fir: Instance of fir_instanceq31_t.
+ * @param [in] input: q31_t array of input data.
+ * @param [out] output: q31_t array of output data.
+ * @param [in] len: Length of arrays. This size must be multiple of blocksz set
+ *                  by fir_create_xxxq31().
+ */
+void fir_executeq31(fir_instanceq31_t *fir, q31_t *input, q31_t *output,
+    int len);
+
+/**
+ * Execute q31 FIR filter and calculate the avsolute value
+ *
+ * @param [in] fir: Instance of fir_instanceq31_t.
+ * @param [in] input: q31_t array of input data.
+ * @param [out] output: q31_t array of output data.
+ * @param [in] len: Length of arrays. This size must be multiple of blocksz set
+ *                  by fir_create_xxxq31().
+ */
+void firabs_executeq31(fir_instanceq31_t *fir, q31_t *input, q31_t *output,
+    int len);
+
+/**
+ * Delete q31 FIR instance
+ *
+ * @param [in] fir: Instance of fir_instanceq31_t.
+ */
+void fir_deleteq31(fir_instanceq31_t *fir);
+
+/** @} */
+
 /** @} fir_funcs */
 
 #  undef EXTERN
@@ -0,0 +1,187 @@
+/****************************************************************************
+ * modules/include/digital_filter/fir_resampler.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file fir_resampler.h
+ */
+
+#ifndef __INCLUDE_FILTERS_FIR_RESAMPLER_H
+#define __INCLUDE_FILTERS_FIR_RESAMPLER_H
+
+/**
+ * @defgroup fir_resampler FIR Polyphase Resampler
+ * @{
+ *
+ * Rational rate (L/M) sampling rate converter using a polyphase FIR
+ * filter. Only the taps of the phase needed for each output sample are
+ * calculated, so the cost is (taps / L) MACs per output sample.
+ */
+
+#include <nuttx/config.h>
+
+#ifdef CONFIG_EXTERNALS_CMSIS_DSP
+#include <arm_math.h>
+
+/**
+ * @defgroup fir_resampler_datatype Data Types
+ * @{
+ */
+
+typedef struct
+{
+  int L;              /**< Interpolation factor */
+  int M;              /**< Decimation factor */
+  int taps;           /**< Tap number of the prototype filter */
+  int phase_taps;     /**< Tap number of each phase (taps / L) */
+  int blocksz;        /**< Maximum input samples in one calculation */
+  int phase;          /**< Phase of the next output sample */
+  int pos;            /**< Input index of the next output sample */
+  float *coeffs;      /**< Coefficients ordered by phase */
+  float *state;       /**< Input history and the current block */
+} resampler_instancef_t;
+
+/** @} fir_resampler_datatype */
+
+#else
+#error "FIR filter needs CMSIS DSP library"
+#endif
+
+#  ifdef __cplusplus
+#    define EXTERN extern "C"
+extern "C"
+{
+#  else
+#    define EXTERN extern
+#  endif
+
+/********************************************************************************
+ * Public Function Prototypes
+ ********************************************************************************/
+
+/**
+ * @defgroup fir_resampler_funcs Functions
+ * @{
+ */
+
+/**
+ * Create Resampler instance
+ *
+ * Conversion ratio is reduced to L/M by the greatest common divisor of
+ * fs_in and fs_out. (ex. 48000 -> 16000 is 1/3, 1920 -> 100 is 5/96)
+ *
+ * @param [in] fs_in: Sampling rate of input signals.
+ * @param [in] fs_out: Sampling rate of output signals.
+ * @param [in] tr_width: Transition frequency band width of Low Pass Filter(Hz)
+ * @param [in] blocksz: Maximum input samples in one calculation. (samples)
+ *
+ * @return resampler_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of resampler_instancef_t,
+ *       so you free when you finished to use the filter by resampler_deletef().
+ */
+resampler_instancef_t *create_resamplerf(int fs_in, int fs_out,
+    int tr_width, int blocksz);
+
+/**
+ * Create Resampler instance with Tap size
+ *
+ * @param [in] fs_in: Sampling rate of input signals.
+ * @param [in] fs_out: Sampling rate of output signals.
+ * @param [in] taps: Tap size of the prototype FIR filter, which works at
+ *                   fs_in * L.
+ * @param [in] blocksz: Maximum input samples in one calculation. (samples)
+ *
+ * @return resampler_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of resampler_instancef_t,
+ *       so you free when you finished to use the filter by resampler_deletef().
+ */
+resampler_instancef_t *create_resamplerf_tap(int fs_in, int fs_out,
+    int taps, int blocksz);
+
+/**
+ * Execute Resampling
+ *
+ * Input of any length can be given. It is processed blocksz samples at
+ * a time and the filter state is carried over to the next call.
+ *
+ * @param [in] rs: Instance of resampler_instancef_t.
+ * @param [in] input: float array of input data.
+ * @param [in] input_len: Length of input array.
+ * @param [out] output: float array of output data.
+ * @param [in] output_len: Length of output array.
+ *
+ * @return Resampled data length, means size of output data.
+ *         -1 if output_len is too small. (Nothing is processed.)
+ */
+int resampler_executef(resampler_instancef_t *rs, float *input, int input_len,
+    float *output, int output_len);
+
+/**
+ * Get the number of output samples of the next execution
+ *
+ * @param [in] rs: Instance of resampler_instancef_t.
+ * @param [in] input_len: Length of input array.
+ *
+ * @return Data length which resampler_executef() outputs for input_len.
+ */
+int resampler_outlenf(resampler_instancef_t *rs, int input_len);
+
+/**
+ * Get tap number of Resampler instance
+ *
+ * @param [in] rs: Instance of resampler_instancef_t.
+ *
+ * @return Tap number of the prototype FIR filter.
+ */
+int resampler_tapnumf(resampler_instancef_t *rs);
+
+/**
+ * Delete Resampler instance
+ *
+ * @param [in] rs: Instance of resampler_instancef_t.
+ */
+void resampler_deletef(resampler_instancef_t *rs);
+
+/** @} fir_resampler_funcs */
+
+#  undef EXTERN
+#  ifdef __cplusplus
+}
+#  endif
+
+/** @} fir_resampler */
+
+#endif  /* __INCLUDE_FILTERS_FIR_RESAMPLER_H */
@@ -0,0 +1,260 @@
+/****************************************************************************
+ * modules/include/digital_filter/iir_filter.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file iir_filter.h
+ */
+
+#ifndef __INCLUDE_FILTERS_IIR_FILTER_H
+#define __INCLUDE_FILTERS_IIR_FILTER_H
+
+/**
+ * @defgroup iir_filter IIR Filter
+ * @{
+ *
+ * IIR filters as a cascade of biquads (Direct Form II Transposed)
+ * using CMSIS DSP. Butterworth and Chebyshev type I designs are
+ * available. A sharp low cut off needs only a few biquads, where an FIR
+ * filter needs hundreds of taps.
+ */
+
+#include <nuttx/config.h>
+
+#ifdef CONFIG_EXTERNALS_CMSIS_DSP
+#include <arm_math.h>
+
+/**
+ * @defgroup iir_datatype Data Types
+ * @{
+ */
+
+/**
+ * @typedef iir_instancef_t
+ * Wrap type of arm_biquad_cascade_df2T_instance_f32
+ */
+typedef arm_biquad_cascade_df2T_instance_f32 iir_instancef_t;
+
+/** @} iir_datatype */
+
+#else
+#error "IIR filter needs CMSIS DSP library"
+#endif
+
+#  ifdef __cplusplus
+#    define EXTERN extern "C"
+extern "C"
+{
+#  else
+#    define EXTERN extern
+#  endif
+
+/********************************************************************************
+ * Public Function Prototypes
+ ********************************************************************************/
+
+/**
+ * @defgroup iir_funcs Functions
+ * @{
+ */
+
+/**
+ * Create Butterworth IIR Low Pass Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cutoff_freq: Cut off frequency. (Hz, -3dB)
+ * @param [in] order: Filter order. (order + 1) / 2 biquads are used.
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_lpff(int fs, int cutoff_freq, int order);
+
+/**
+ * Create Chebyshev type I IIR Low Pass Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cutoff_freq: Pass band edge frequency. (Hz)
+ * @param [in] order: Filter order. (order + 1) / 2 biquads are used.
+ * @param [in] ripple_db: Pass band ripple. (dB)
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_lpff_cheby(int fs, int cutoff_freq, int order,
+    float ripple_db);
+
+/**
+ * Create Butterworth IIR High Pass Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cutoff_freq: Cut off frequency. (Hz, -3dB)
+ * @param [in] order: Filter order. (order + 1) / 2 biquads are used.
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_hpff(int fs, int cutoff_freq, int order);
+
+/**
+ * Create Chebyshev type I IIR High Pass Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] cutoff_freq: Pass band edge frequency. (Hz)
+ * @param [in] order: Filter order. (order + 1) / 2 biquads are used.
+ * @param [in] ripple_db: Pass band ripple. (dB)
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_hpff_cheby(int fs, int cutoff_freq, int order,
+    float ripple_db);
+
+/**
+ * Create Butterworth IIR Band Pass Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz, -3dB)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz, -3dB)
+ * @param [in] order: Order of the low pass prototype. order biquads are used.
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_bpff(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order);
+
+/**
+ * Create Chebyshev type I IIR Band Pass Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower pass band edge frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher pass band edge frequency. (Hz)
+ * @param [in] order: Order of the low pass prototype. order biquads are used.
+ * @param [in] ripple_db: Pass band ripple. (dB)
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_bpff_cheby(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order, float ripple_db);
+
+/**
+ * Create Butterworth IIR Band Elimination (Notch) Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower cut off frequency. (Hz, -3dB)
+ * @param [in] higher_cutfreq: Higher cut off frequency. (Hz, -3dB)
+ * @param [in] order: Order of the low pass prototype. order biquads are used.
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_beff(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order);
+
+/**
+ * Create Chebyshev type I IIR Band Elimination (Notch) Filter
+ *
+ * @param [in] fs: Sampling rate of target signals.
+ * @param [in] lower_cutfreq: Lower pass band edge frequency. (Hz)
+ * @param [in] higher_cutfreq: Higher pass band edge frequency. (Hz)
+ * @param [in] order: Order of the low pass prototype. order biquads are used.
+ * @param [in] ripple_db: Pass band ripple. (dB)
+ *
+ * @return iir_instancef_t instance is returned on success, otherwise returns NULL.
+ *
+ * @note This function allocate memory for instance of iir_instancef_t, so you
+ *       free when you finished to use the filter by iir_deletef().
+ */
+iir_instancef_t * iir_create_beff_cheby(int fs, int lower_cutfreq,
+    int higher_cutfreq, int order, float ripple_db);
+
+/**
+ * Get number of biquad stages of created IIR filter instance
+ *
+ * @param [in] iir: Target instance of iir_instancef_t.
+ *
+ * @return Number of biquad stages.
+ */
+int iir_get_stagenumf(iir_instancef_t *iir);
+
+/**
+ * Execute IIR filter
+ *
+ * @param [in] iir: Instance of iir_instancef_t.
+ * @param [in] input: float array of input data.
+ * @param [out] output: float array of output data. It can be same as input.
+ * @param [in] len: Length of arrays. Any length can be given.
+ */
+void iir_executef(iir_instancef_t *iir, float *input, float *output, int len);
+
+/**
+ * Clear the filter state of IIR filter
+ *
+ * @param [in] iir: Instance of iir_instancef_t.
+ */
+void iir_resetf(iir_instancef_t *iir);
+
+/**
+ * Delete IIR instance
+ *
+ * @param [in] iir: Instance of iir_instancef_t.
+ */
+void iir_deletef(iir_instancef_t *iir);
+
+/** @} iir_funcs */
+
+#  undef EXTERN
+#  ifdef __cplusplus
+}
+#  endif
+
+/** @} iir_filter */
+
+#endif  /* __INCLUDE_FILTERS_IIR_FILTER_H */
@@ -91,6 +91,18 @@ typedef struct dnn_mallinfo
   size_t largest_bytes;
 } dnn_mallinfo_t;
 
+/**
+ * @typedef dnn_layer_profile_t
+ * structure to obtain execution time of a layer in the last forward
+ */
+typedef struct dnn_layer_profile
+{
+  unsigned short function_type; /**< nn_function_type_t of the layer */
+  unsigned char task_num;       /**< Number of CPUs the layer was split to */
+  unsigned char chained;        /**< 1 if run within the previous layer */
+  unsigned long cycles;         /**< CPU cycles including chained layers */
+} dnn_layer_profile_t;
+
 /** @} dnnrt_datatype */
 
 /********************************************************************************
@@ -312,6 +324,22 @@ int dnn_nuttx_mallinfo(dnn_mallinfo_t * info);
  */
 int dnn_asmp_mallinfo(unsigned char array_length, dnn_mallinfo_t * info_array);
 
+/**
+ * Obtain per-layer execution time of the last dnn_runtime_forward()
+ *
+ * @param [in,out] rt:          dnnrt_runtime_t object
+ * @param [out]    profile:     array to store one entry per layer, in
+ *                              network order. NULL to query the length.
+ * @param [in]     profile_num: number of elements in profile
+ *
+ * @return number of layers in the network on success.
+ *         -EPERM if CONFIG_DNN_RT_MPCOMM=n
+ * @note cycles are counted on the controller CPU, and a layer chained to
+ *       the previous one reports 0 as its time is included there.
+ */
+int dnn_runtime_profile(dnn_runtime_t * rt, dnn_layer_profile_t * profile,
+                        unsigned short profile_num);
+
 /** @} dnnrt_funcs */
 
 #  undef EXTERN
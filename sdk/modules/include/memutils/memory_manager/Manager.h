@@ -139,6 +139,106 @@ public:
   static uint32_t  getDynamicPoolWorkSize(const PoolAttr& attr) { return DYN_POOL_WORK_SIZE(attr); }
 #endif
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_RUNTIME_LAYOUT
+  /** The getter for the pool area size of a runtime layout.
+    * Space for alignment and fences is included.
+    * @param[in] pool_attr The pool table. (Terminated by id 0)
+    * @return uint32_t The size of pool area required by createRuntimePools().
+    */
+  static uint32_t  getRuntimePoolsAreaSize(const RuntimePoolAttr *pool_attr);
+
+  /** The getter for the work area size of a runtime layout.
+    * @param[in] pool_attr The pool table. (Terminated by id 0)
+    * @return uint32_t The size of work area required by createRuntimePools().
+    */
+  static uint32_t  getRuntimePoolsWorkSize(const RuntimePoolAttr *pool_attr);
+
+  /** The memory layout creation method from a table built at runtime.
+    * The pools are placed in pool_area in table order. Destroy them with
+    * destroyStaticPools(sec_no) before creating another layout.
+    * @param[in] sec_no     A section number.
+    * @param[in] layout_no  A layout number set to getCurrentLayoutNo().
+    * @param[in] pool_attr  The pool table. (Terminated by id 0)
+    * @param[in] pool_area  The area where pools are placed.
+    * @param[in] pool_size  The size of pool_area.
+    * @param[in] work_area  The area for pool management data.
+    * @param[in] work_size  The size of work_area.
+    * @return ERR_OK        : success
+    * @return ERR_STS       : error, layout of sec_no is already created
+    * @return ERR_ARG       : error, bad pool definition
+    * @return ERR_DATA_SIZE : error, pool_area or work_area is too small
+    * @return ERR_ADR_ALIGN : error, work area is not 4bytes alignment
+    */
+  static err_t  createRuntimePools(uint8_t sec_no, NumLayout layout_no,
+                                   const RuntimePoolAttr *pool_attr,
+                                   void* pool_area, uint32_t pool_size,
+                                   void* work_area, uint32_t work_size);
+#endif
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+  /** The getter for the work area size of segment caches.
+    * @return uint32_t The size of work area required by attachSegCache().
+    */
+  static uint32_t  getSegCacheWorkSize();
+
+  /** Attach per-CPU segment caches to a pool.
+    * Allocation and free from task context are served by the cache of the
+    * running CPU and take the pool lock only on batch refill or flush.
+    * @param[in] id        The pool id. (BasicType static pool only)
+    * @param[in] work_area The area for caches. (4bytes alignment)
+    * @param[in] area_size The size of work_area.
+    * @return ERR_OK        : success
+    * @return ERR_ADR_ALIGN : error, work area is not 4bytes alignment
+    * @return ERR_DATA_SIZE : error, area_size less than getSegCacheWorkSize()
+    * @return ERR_ARG       : error, pool does not exist or is not BasicType
+    * @return ERR_STS       : error, caches are already attached,
+    *                         or pools are shared by multi-core
+    */
+  static err_t  attachSegCache(PoolId id, void* work_area, uint32_t area_size);
+
+  /** Return cached segments to the pool and detach the caches.
+    * Call this while no task is allocating from the pool.
+    * @param[in] id The pool id.
+    * @return void* The work area given to attachSegCache(), or NULL.
+    *               (NULL also if the pool does not exist)
+    */
+  static void*  detachSegCache(PoolId id);
+
+  /** The getter for the cache statistics of a pool.
+    * @param[in]  id    The pool id.
+    * @param[out] stats The statistics summed over all CPUs.
+    * @return ERR_OK  : success
+    * @return ERR_ARG : error, pool does not exist or is not BasicType
+    * @return ERR_STS : error, caches are not attached
+    */
+  static err_t  getSegCacheStats(PoolId id, SegCacheStats* stats);
+  static void   resetSegCacheStats(PoolId id);
+#endif
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  /** The getter for the statistics of a pool.
+    * @param[in]  id    The pool id.
+    * @param[out] stats The statistics.
+    * @return ERR_OK  : success
+    * @return ERR_ARG : error, stats is NULL
+    */
+  static err_t  getPoolStats(PoolId id, PoolStats* stats);
+
+  /** Store the statistics of the static pools of a section.
+    * @param[in]  sec       The section number.
+    * @param[out] stats     The array to store the statistics in pool ID order.
+    * @param[in]  num_stats The number of elements of stats.
+    * @return uint32_t The number of stored statistics.
+    */
+  static uint32_t  getStaticPoolsStats(uint8_t sec, PoolStats* stats, uint32_t num_stats);
+
+  /** Clear the counters and high-water marks of a pool.
+    * The segments in use are counted again as the new baseline.
+    * @param[in] id The pool id.
+    */
+  static void  resetPoolStats(PoolId id);
+#endif
+
   /* Get used memory segment information. */
 
   static uint32_t  getStaticPoolsUsedSegs(uint8_t sec,MemHandleBase* mhs, uint32_t num_mhs);
@@ -154,6 +254,13 @@ public:
   static PoolSize  getPoolSize(PoolId id) { return findPool(id)->getPoolSize(); }
   static NumSeg  getPoolNumSegs(PoolId id) { return findPool(id)->getPoolNumSegs(); }
   static NumSeg  getPoolNumAvailSegs(PoolId id) { return findPool(id)->getPoolNumAvailSegs(); }
+#ifdef USE_MEMMGR_RINGBUF_POOL
+  /** The getter for the largest size allocSeg() can reserve now.
+    * @param[in] id The pool id. (RingBufType only)
+    * @return PoolSize The largest contiguous free size.
+    */
+  static PoolSize  getRingBufPoolFreeSize(PoolId id);
+#endif
 #ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_USE_FENCE
   static bool  isPoolFenceEnable(PoolId id) { return findPool(id)->isPoolFenceEnable(); }
 #endif
@@ -177,6 +284,16 @@ private:
   Manager();  /* called from initFirst */
 
   static MemPool* createPool(const PoolSectionAttr& attr, FastMemAlloc& fma);
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_RUNTIME_LAYOUT
+  static void  destroyRuntimePools(MemPool** pools,
+                                   const RuntimePoolAttr* begin,
+                                   const RuntimePoolAttr* end);
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+  static MemPool* createSizeClassPool(const PoolSectionAttr& attr,
+                                      const SizeClassAttr* classes,
+                                      uint8_t num_classes, FastMemAlloc& fma);
+#endif
   static void  destroyPool(MemPool* pool);
   static void  initFixedAreaFences();
 
@@ -203,6 +320,21 @@ private:
     return p;
   }
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+  /* Returns the static pool object corresponding to the pool ID.
+   * Unlike getPoolObject(), an illegal pool ID returns NULL without
+   * asserting, so that the APIs can report it as an error.
+   */
+
+  static MemPool* lookupStaticPool(PoolId id) {
+    if (theManager == NULL || !isStaticPoolAvailable(id.sec) ||
+        id.pool >= theManager->m_pool_num[id.sec]) {
+      return NULL;
+    }
+    return theManager->m_static_pools[id.sec][id.pool];
+  }
+#endif
+
   /* Memory segment allocate/free/get information. */
 
   friend class MemHandleBase;
@@ -216,6 +348,9 @@ private:
   static PoolSize  getSegSize(const MemHandleBase& mh);
   static SegRefCnt getSegRefCnt(PoolId id, NumSeg seg_no) { return findPool(id)->getSegRefCnt(seg_no); }
   static void      incSegRefCnt(PoolId id, NumSeg seg_no) { findPool(id)->incSegRefCnt(seg_no); }
+#ifdef USE_MEMMGR_RINGBUF_POOL
+  static err_t     commitSeg(const MemHandleBase& mh, size_t size);
+#endif
 
 private:
   static Manager*  theManager;    /* for singleton */
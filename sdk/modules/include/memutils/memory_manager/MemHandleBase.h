@@ -113,6 +113,20 @@ public:
     return allocSeg(pool_id, size_for_check);
   }
 #endif
+#ifdef USE_MEMMGR_RINGBUF_POOL
+  /** Fix the size of the allocated segment after writing data.
+    * For RingBufType pools, the unused part of the newest reservation
+    * is given back to the pool. Other pools only check the size.
+    * @param[in] size The size actually used.
+    *  @return ERR_OK        : success
+    *  @return ERR_DATA_SIZE : error, size is over the allocated size
+    *  @return ERR_STS       : error, segment is not allocated
+    */
+  err_t commitSeg(size_t size) {
+    return isAvail() ? Manager::commitSeg(*this, size) : ERR_STS;
+  }
+#endif
+
   /** The free from a pool area for MemHandle.
     * @return void (If this handler did not allocate, this method do nothing.)
     */
@@ -133,6 +147,12 @@ public:
 
 private:
   friend class MemPool;
+#ifdef USE_MEMMGR_RINGBUF_POOL
+  friend class RingBufPool;
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+  friend class SizeClassPool;
+#endif
 
   struct SegInfo {
     PoolId    pool_id;
@@ -62,6 +62,10 @@
 #include "SpinLockManager.h"
 #endif
 
+#if defined(CONFIG_MEMUTILS_MEMORY_MANAGER_RINGBUF_POOL) && !defined(USE_MEMMGR_RINGBUF_POOL)
+#define USE_MEMMGR_RINGBUF_POOL
+#endif
+
 #define MEMMGR_SIGNATURE  "MML"
 
 class FastMemAlloc;  /* This class is outside the namespace. */
@@ -104,7 +108,10 @@ enum
 
   /** the type number of fixed pools. (Now only support this type.) */
   BasicType,
+  /** the type number of ring buffer pools. (Variable length segments.) */
   RingBufType,
+  /** the type number of size-class pools. (Runtime layout only.) */
+  SizeClassType,
   /** Number of types. */
   NumPoolTypes  /* number of pool types */
 };
@@ -202,6 +209,66 @@ struct PoolSectionAttr {
 #endif /* USE_MEMMGR_DEBUG_OUTPUT */
 }; /* struct PoolAttr */
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+/*****************************************************************
+ * Segment cache statistics (sum of all CPUs)
+ *****************************************************************/
+struct SegCacheStats {
+  uint32_t  alloc_hits;    /* allocations served by the cache */
+  uint32_t  alloc_misses;  /* allocations that needed a refill */
+  uint32_t  free_hits;     /* frees stored into the cache */
+  uint32_t  free_misses;   /* frees that needed a flush */
+  uint32_t  refills;       /* batch moves from pool to cache */
+  uint32_t  flushes;       /* batch moves from cache to pool */
+  NumSeg    cached_segs;   /* segments held by the caches now */
+}; /* struct SegCacheStats */
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE */
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+/*****************************************************************
+ * Pool statistics
+ *****************************************************************/
+struct PoolStats {
+  PoolId    id;            /* pool ID */
+  PoolType  type;          /* pool type */
+  NumSeg    num_segs;      /* number of segments */
+  NumSeg    used_segs;     /* segments in use now */
+  NumSeg    max_used_segs; /* high-water mark of used segments */
+  NumSeg    min_avail_segs;/* low-water mark of free segments */
+  uint32_t  alloc_count;   /* successful allocations */
+  uint32_t  free_count;    /* segments returned to the pool */
+  uint32_t  alloc_fails;   /* allocations failed by ERR_MEM_EMPTY */
+  uint32_t  max_hold_us;   /* longest time a segment was held (us) */
+}; /* struct PoolStats */
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS */
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_RUNTIME_LAYOUT
+/*****************************************************************
+ * Pool Attributes for runtime layout
+ *****************************************************************/
+const uint8_t  MaxSizeClasses = 8;
+
+/** Segment class of a SizeClassType pool */
+struct SizeClassAttr {
+  PoolSize  seg_size;  /* segment size (bytes) */
+  NumSeg    num_segs;  /* number of segments */
+}; /* struct SizeClassAttr */
+
+/** Pool definition of a runtime layout. */
+struct RuntimePoolAttr {
+  uint8_t   id;          /* pool ID (1 origin). ID 0 ends the table. */
+  PoolType  type;        /* BasicType, RingBufType or SizeClassType */
+  NumSeg    num_segs;    /* BasicType/RingBufType: number of segments */
+  uint8_t   num_classes; /* SizeClassType: number of classes */
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_USE_FENCE
+  bool      fence;
+#endif
+  uint32_t  align;       /* pool address alignment (power of 2) */
+  PoolSize  seg_size;    /* BasicType/RingBufType: segment size (bytes) */
+  const SizeClassAttr* classes; /* SizeClassType: classes, ascending size */
+}; /* struct RuntimePoolAttr */
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_RUNTIME_LAYOUT */
+
 inline bool operator == (PoolId id1, PoolId id2)
 {
   return (id1.sec == id2.sec && id1.pool == id2.pool);
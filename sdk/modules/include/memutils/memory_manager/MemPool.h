@@ -45,13 +45,32 @@
 
 namespace MemMgrLite {
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+class SegCache;
+#endif
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+/*****************************************************************
+ * Pool statistics counters (20bytes)
+ *****************************************************************/
+struct PoolCounters {
+	NumSeg		used_segs;	/* segments in use now */
+	NumSeg		max_used_segs;	/* high-water mark of used segments */
+	uint32_t	alloc_count;
+	uint32_t	free_count;
+	uint32_t	alloc_fails;
+	uint32_t	max_hold_us;
+}; /* struct PoolCounters */
+#endif
+
 /*****************************************************************
  * Memory pool base class (16 or 20bytes)
  *****************************************************************/
 class MemPool : CopyGuard {
 	friend class Manager;
 protected:
-	MemPool(const PoolSectionAttr& attr, FastMemAlloc& fma);
+	MemPool(const PoolSectionAttr& attr, FastMemAlloc& fma,
+		bool use_seg_no_que = true);
 	~MemPool();
 
   /* Since exceptions can not be used, constructor errors are
@@ -59,9 +78,15 @@ protected:
    */
 
 	bool isFailed() {
-		if (m_seg_no_que.que_area() == NULL || m_ref_cnt_array == NULL) {
+		if ((m_seg_no_que.que_area() == NULL && m_seg_no_que.capacity() != 0) ||
+		    m_ref_cnt_array == NULL) {
+			return true;
+		}
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+		if (m_alloc_time == NULL) {
 			return true;
 		}
+#endif
 		return false;
 	}
 
@@ -70,7 +95,23 @@ protected:
 	PoolAddr	getPoolAddr() const { return m_attr.addr; }
 	PoolSize	getPoolSize() const { return m_attr.size; }
 	NumSeg		getPoolNumSegs() const { return m_attr.num_segs; }
-	NumSeg		getPoolNumAvailSegs() const { return m_seg_no_que.size(); }
+	NumSeg		getPoolNumAvailSegs() const {
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+		if (getPoolType() == SizeClassType) {
+			return getSizeClassNumAvailSegs();
+		}
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+		return static_cast<NumSeg>(m_seg_no_que.size() + getNumCachedSegs());
+#else
+		return m_seg_no_que.size();
+#endif
+	}
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+	/* Free segments of SizeClassType are held by the class queues. */
+
+	NumSeg		getSizeClassNumAvailSegs() const;
+#endif
 #ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_USE_FENCE
 	bool		isPoolFenceEnable() const { return m_attr.fence; }
 	void		initPoolFence();
@@ -108,6 +149,40 @@ protected:
 
 	void	freeSeg(MemHandleBase& mh);
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+  /* Per-CPU segment cache.
+   * allocSegCached() and freeSegCached() must be called from task context
+   * and take the pool lock only when the cache needs a refill or flush.
+   * They return false without doing anything when no cache is attached.
+   */
+
+	bool		isSegCacheAttached() const { return m_seg_cache != NULL; }
+	void		attachSegCache(SegCache* cache);
+	SegCache*	detachSegCache();
+	NumSeg		getNumCachedSegs() const;
+	void		getSegCacheStats(SegCacheStats& stats) const;
+	void		resetSegCacheStats();
+
+	bool		allocSegCached(MemHandleProxy& proxy);
+	bool		freeSegCached(MemHandleBase& mh);
+#endif
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  /* Pool statistics.
+   * The note functions are called by each pool type when a segment
+   * is taken (reference counter 0 -> 1) or returned (1 -> 0).
+   * They update the counters atomically, so the caller may hold
+   * either the pool lock or only the preemption lock.
+   */
+
+	void		getPoolStats(PoolStats& stats) const;
+	void		resetPoolStats();
+
+	void		noteSegAlloc(NumSeg seg_no);
+	void		noteSegFree(NumSeg seg_no);
+	void		noteAllocFail();
+#endif
+
 protected:
   /* In the case of a static pool, it points to the corresponding part
    * of MemoryPoolLayouts.
@@ -119,6 +194,7 @@ protected:
 
   /* A queue (8 or 12 bytes) holding an usable segment number (1 origin).
    * It is necessary to separately prepare the area for queue data.
+   * SizeClassType does not use it, and its capacity is 0.
    */
 
 	RuntimeQue<NumSeg, NumSeg>	m_seg_no_que;
@@ -130,6 +206,19 @@ protected:
    */
 
 	SegRefCnt* const	m_ref_cnt_array;
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+  /* Per-CPU segment cache. NULL when not attached. */
+
+	SegCache*		m_seg_cache;
+#endif
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  /* Statistics counters and the time each segment was taken (us). */
+
+	PoolCounters		m_counters;
+	uint32_t* const		m_alloc_time;
+#endif
 }; /* class MemPool */
 
 } /* namespace MemMgrLite */
@@ -159,6 +159,33 @@ public:
   /* Transmission of message packet.(task context, address range parameter) */
   static err_t send(MsgQueId dest, MsgPri pri, MsgType type, MsgQueId reply, const void* param, size_t param_size);
 
+  /* Transmission of message packets.(task context, parameter array) */
+  /** Send objects to another task at once.
+   *  This method queues num packets under one lock and one semaphore post.
+   *  If the queue does not have num free packets, nothing is sent.
+   *  @param[in] dest   Destination id
+   *  @param[in] pri    Priority
+   *  @param[in] type   Message Type
+   *  @param[in] reply  Reply id
+   *  @param[in] params Array of objects to send
+   *  @param[in] num    Number of objects
+   *  @return err_t error code. (ERR_QUE_FULL if the queue is short)
+   */
+  template<typename T>
+  static err_t sendBatch(MsgQueId dest, MsgPri pri, MsgType type, MsgQueId reply, const T* params, uint16_t num)
+    {
+      FAR MsgQueBlock* que;
+      err_t            err_code = ERR_OK;
+
+      err_code = referMsgQueBlock(dest, &que);
+      if (err_code == ERR_OK)
+        {
+          return que->sendBatch(pri, type, reply, MsgPacket::MsgFlagWaitParam, params, num);
+        }
+
+      return err_code;
+    }
+
   /* Transmission of message packet.(non task context, no parameters) */
   static err_t sendIsr(MsgQueId dest, MsgPri pri, MsgType type, MsgQueId reply);
 
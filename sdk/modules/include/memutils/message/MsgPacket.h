@@ -87,6 +87,17 @@ public:
   /* Parameter is formatted with type. */
 
 	static const MsgFlags MsgFlagTypedParam = 0x40;
+
+  /* Not first packet of a batch send.
+   * The counting semaphore is posted only for the first packet.
+   */
+
+	static const MsgFlags MsgFlagBatchFollow = 0x20;
+
+  /* Received by a batch receive and not popped yet. */
+
+	static const MsgFlags MsgFlagBatchRecv = 0x10;
+
 	MsgPacketHeader(MsgType type, MsgQueId reply, MsgFlags flags, uint16_t size = 0) :
 		m_type(type),
 		m_reply(reply),
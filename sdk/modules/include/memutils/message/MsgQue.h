@@ -81,6 +81,15 @@ public:
 
 	MsgPacket* frontMsg() { return &front<MsgPacket>(); }
 	MsgPacket* backMsg()  { return &back<MsgPacket>(); }
+	MsgPacket* atMsg(uint16_t n) { return &writable_at<MsgPacket>(n); }
+
+  /* Return the packet area following msg in the queue (with wrap around). */
+
+	MsgPacket* nextMsg(MsgPacket* msg) {
+		uint8_t* top  = static_cast<uint8_t*>(getAddr(0));
+		uint8_t* next = reinterpret_cast<uint8_t*>(msg) + elem_size();
+		return reinterpret_cast<MsgPacket*>((next == top + capacity() * elem_size()) ? top : next);
+	}
 }; /* class MsgQue */
 
 #endif /* MSG_QUE_H_INCLUDED */
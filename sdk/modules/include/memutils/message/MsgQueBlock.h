@@ -85,6 +85,19 @@ public:
    */
   err_t recv(uint32_t ms, FAR MsgPacket **packet);
 
+  /** Receive Objects from another task in a batch.
+   * this method waits for the first packet like recv(ms, packet), and then
+   * takes the following packets of the same priority which are already
+   * ready, without waiting. Call pop() for each packet in received order.
+   * A shared queue receives one packet at a time.
+   * @param[in] ms timeout time(millisecond)
+   * @param[out] **packets the array of pointers of Massage packets.
+   * @param[in] max_num the number of elements of packets.
+   * @param[out] *num the number of received packets.
+   * @return err_t error code
+   */
+  err_t recv(uint32_t ms, FAR MsgPacket **packets, uint16_t max_num, FAR uint16_t *num);
+
   /* Discard message packet. */
 
   err_t pop();
@@ -157,6 +170,14 @@ protected:
 	template<typename T>
 	err_t send(MsgPri pri, MsgType type, MsgQueId reply, MsgFlags flags, const T& param);
 
+  /* Send num messages of the same type from task context.
+   * The queue is locked once and the counting semaphore is posted once.
+   * Nothing is sent if the queue does not have room for all of them.
+   */
+
+	template<typename T>
+	err_t sendBatch(MsgPri pri, MsgType type, MsgQueId reply, MsgFlags flags, const T* params, uint16_t num);
+
   /* Message transmission processing from ISR.
    * (Only to non-shared queue owned by own CPU)
    */
@@ -180,6 +201,12 @@ protected:
 
 	MsgPacket* pushHeader(MsgPri pri, const MsgPacketHeader& header);
 
+  /* Check if the head packet is a ready packet of a batch send,
+   * which can be received without the semaphore count.
+   */
+
+	bool isBatchFollowReady();
+
   /* Lock/Unlock Queue. */
 
 	void lock();
@@ -189,12 +216,18 @@ protected:
 		uint32_t	total_pending;
 		uint16_t	max_pending;
 		uint16_t	max_queuing[NumMsgPri];
+		uint8_t		max_batch_send;	/* Max packets of a batch send. (Saturated at 255) */
+		uint8_t		max_batch_recv;	/* Max packets of a batch receive. (Saturated at 255) */
 	public:
 		Tally() { clear(); }
 		void clear() { memset(this, 0x00, sizeof(*this)); }
 		void dump() const {
-			printf("tally: total_pending=%ld, max_pending=%d, max_queuing=%d, %d\n",
-				total_pending, max_pending, max_queuing[MsgPriNormal], max_queuing[MsgPriHigh]);
+			printf("tally: total_pending=%ld, max_pending=%d, max_queuing=%d, %d, max_batch=%d, %d\n",
+				total_pending, max_pending, max_queuing[MsgPriNormal], max_queuing[MsgPriHigh],
+				max_batch_send, max_batch_recv);
+		}
+		void updateBatch(uint8_t& max, uint16_t num) {
+			max = static_cast<uint8_t>(MAX(max, MIN(num, 0xff)));
 		}
 	};
 
@@ -447,6 +480,89 @@ err_t MsgQueBlock::send(MsgPri pri, MsgType type, MsgQueId reply, MsgFlags flags
   return (msg) ? ERR_OK : ERR_QUE_FULL;
 }
 
+/*****************************************************************
+ * Batch message sending process from task context
+ *****************************************************************/
+template<typename T>
+err_t MsgQueBlock::sendBatch(MsgPri pri, MsgType type, MsgQueId reply, MsgFlags flags, const T* params, uint16_t num)
+{
+  if (params == NULL || num == 0)
+    {
+      return ERR_ARG;
+    }
+
+  /* Check that the message fits in the element size of the queue */
+
+  bool type_check = MSG_PARAM_TYPE_MATCH_CHECK && MsgPacketInfo<T>::typed_param && isOwn();
+  size_t send_size = getSendSize(params[0], type_check);
+  if (send_size > getElemSize(pri))
+    {
+      return ERR_DATA_SIZE;
+    }
+
+  /* Put all the packet headers in the queue under one lock.
+   * Only the first packet is counted by the semaphore.
+   */
+
+  lock();
+
+  if (m_que[pri].rest() < num)
+    {
+      unlock();
+      return ERR_QUE_FULL;
+    }
+
+  MsgPacket* first = pushHeader(pri, MsgPacketHeader(type, reply, flags));
+  for (uint16_t i = 1; i < num; ++i)
+    {
+      (void)pushHeader(pri, MsgPacketHeader(type, reply, flags | MsgPacket::MsgFlagBatchFollow));
+    }
+  m_tally.updateBatch(m_tally.max_batch_send, num);
+
+  if (isShare())
+    {
+      MsgPacket* msg = first;
+      for (uint16_t i = 0; i < num; ++i, msg = m_que[pri].nextMsg(msg))
+        {
+          Dcache_flush_clear(msg, MEMUTILS_ROUND_UP(sizeof(MsgPacketHeader), CACHE_BLOCK_SIZE));
+        }
+    }
+
+  unlock();
+
+  /* Add parameters. The packets do not move until they are popped. */
+
+  MsgPacket* msg = first;
+  for (uint16_t i = 0; i < num; ++i, msg = m_que[pri].nextMsg(msg))
+    {
+      msg->setParam(params[i], type_check);
+
+      DUMP_MSG_SEQ_LOCK(MsgSeqLog('s', m_id, pri, m_que[pri].size(), msg));
+
+      if (!MsgPacketInfo<T>::null_param && isShare())
+        {
+          Dcache_flush_clear_sync(msg, MEMUTILS_ROUND_UP(send_size, CACHE_BLOCK_SIZE));
+        }
+    }
+
+  if (isShare() == false || isOwn())
+    {
+      /* Update total message count */
+
+      Chateau_SignalSemaphoreTask(m_count_sem);
+    }
+  else
+    {
+      /* Request to update the total number of messages
+       * by inter-CPU communication.
+       */
+
+      notifySend(m_owner, m_id);
+    }
+
+  return ERR_OK;
+}
+
 /*****************************************************************
  * Message transmission processing from ISR
  * (Only to non-shared queue owned by own CPU)
@@ -521,12 +637,30 @@ inline void MsgQueBlock::notifyRecv() {
 	Chateau_SignalSemaphoreIsr(m_count_sem);
 }
 
+/*****************************************************************
+ * Check if the head packet is a ready packet of a batch send
+ *****************************************************************/
+inline bool MsgQueBlock::isBatchFollowReady()
+{
+  lock();
+
+  MsgQue* que = &m_que[(m_que[MsgPriHigh].size()) ? MsgPriHigh : MsgPriNormal];
+  bool ready = !que->empty() &&
+    (que->frontMsg()->getFlags() &
+     (MsgPacket::MsgFlagBatchFollow | MsgPacket::MsgFlagWaitParam)) == MsgPacket::MsgFlagBatchFollow;
+
+  unlock();
+
+  return ready;
+}
+
 /*****************************************************************
  * Receive message packet
  *****************************************************************/
 inline err_t MsgQueBlock::recv(uint32_t ms, FAR MsgPacket **packet)
 {
   bool result;
+  bool counted;
 
   /* Check if own CPU is owned, and
    * check that the previously received packet is discarded.
@@ -539,7 +673,16 @@ inline err_t MsgQueBlock::recv(uint32_t ms, FAR MsgPacket **packet)
 
 retry:  /* Wait to receive. */
 
-  if (ms != TIME_FOREVER)
+  /* The following packets of a batch send have no semaphore count.
+   * If one of them is ready at the head, receive it without waiting.
+   */
+
+  counted = !isBatchFollowReady();
+  if (!counted)
+    {
+      result = true;
+    }
+  else if (ms != TIME_FOREVER)
     {
       timespec tm;
       tm.tv_sec = ms / 1000;
@@ -576,6 +719,21 @@ retry:  /* Wait to receive. */
       return ERR_QUE_EMP;
     }
 
+  /* Without a semaphore count, only a ready packet of a batch send
+   * can be received. (A higher priority packet may have arrived.)
+   */
+
+  if (!counted &&
+      (msg->getFlags() & (MsgPacket::MsgFlagBatchFollow | MsgPacket::MsgFlagWaitParam)) !=
+        MsgPacket::MsgFlagBatchFollow)
+    {
+      if (isShare())
+        {
+          unlock();
+        }
+      goto retry;
+    }
+
   /* If it waits for parameter writing,
    * it stores it and returns to waiting for message again.
    */
@@ -614,6 +772,15 @@ retry:  /* Wait to receive. */
       goto retry;
     }
 
+  /* If a count was consumed for a packet of a batch send,
+   * it belongs to another packet, so give it back.
+   */
+
+  if (counted && (msg->getFlags() & MsgPacket::MsgFlagBatchFollow))
+    {
+      ++m_pendingMsgCount;
+    }
+
   /* Update queue management area before cache flush. */
 
   uint16_t pending = m_pendingMsgCount;
@@ -643,6 +810,62 @@ retry:  /* Wait to receive. */
   return ERR_OK;
 }
 
+/*****************************************************************
+ * Receive message packets in a batch
+ *****************************************************************/
+inline err_t MsgQueBlock::recv(uint32_t ms, FAR MsgPacket **packets, uint16_t max_num, FAR uint16_t *num)
+{
+  if (packets == NULL || num == NULL || max_num == 0)
+    {
+      return ERR_ARG;
+    }
+
+  err_t err = recv(ms, &packets[0]);
+  if (err != ERR_OK)
+    {
+      return err;
+    }
+
+  uint16_t n = 1;
+
+  if (isShare() == false)
+    {
+      lock();
+
+      /* Take the ready packets following the first one.
+       * A packet of a single send needs its semaphore count.
+       */
+
+      while (n < max_num && n < m_cur_que->size())
+        {
+          MsgPacket* msg = m_cur_que->atMsg(n);
+          MsgFlags flags = msg->getFlags();
+
+          if (flags & MsgPacket::MsgFlagWaitParam)
+            {
+              break;
+            }
+
+          if (!(flags & MsgPacket::MsgFlagBatchFollow) &&
+              !Chateau_PollingWaitSemaphore(m_count_sem))
+            {
+              break;
+            }
+
+          msg->m_flags |= MsgPacket::MsgFlagBatchRecv;
+          packets[n++] = msg;
+        }
+
+      m_tally.updateBatch(m_tally.max_batch_recv, n);
+
+      unlock();
+    }
+
+  *num = n;
+
+  return ERR_OK;
+}
+
 /*****************************************************************
  * Discard message packet
  *****************************************************************/
@@ -692,7 +915,15 @@ inline err_t MsgQueBlock::pop()
       Dcache_flush_clear(msg, m_cur_que->elem_size());
     } /* flush is the fill value write after pop. */
 #endif
-  m_cur_que = NULL; /* Make the packet unreceived state. */
+  /* Make the packet unreceived state,
+   * unless the next packet was received in the same batch.
+   */
+
+  if (m_cur_que->empty() ||
+      !(m_cur_que->frontMsg()->getFlags() & MsgPacket::MsgFlagBatchRecv))
+    {
+      m_cur_que = NULL;
+    }
   unlock();
 
   return ERR_OK;
@@ -190,6 +190,7 @@ typedef sem_t	Chateau_sem_handle_t;
 #define Chateau_SignalSemaphoreIsr(h)   Chateau_SignalSemaphore(h)
 #define Chateau_TimedWaitSemaphore(h, tm) (nxsem_timedwait_uninterruptible(&h, &tm) == 0)
 #define Chateau_WaitSemaphore(h)        (nxsem_wait_uninterruptible(&h) == 0)
+#define Chateau_PollingWaitSemaphore(h) (nxsem_trywait(&h) == 0)
 
 #elif defined(NO_OS)
 /* 取り敢えず仮実装 */
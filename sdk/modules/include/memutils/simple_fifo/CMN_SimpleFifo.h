@@ -84,7 +84,8 @@ typedef struct {
 } CMN_SimpleFifoHandle;
 
 /*!
- * @brief Data handle used for CMN_SimpleFifoPeek().
+ * @brief Data handle used for CMN_SimpleFifoPeek() and
+ *        CMN_SimpleFifoReserve().
  * 
  * Data retrieved with any variations of peek API may be splited in to
  * 2 pieces because of data allocation in the FIFO internal
@@ -496,6 +497,93 @@ static inline size_t CMN_SimpleFifoPeek(
 
 //@}
 
+/*!
+ * @name Zero-copy Access
+ *
+ * The writer side reserves vacant regions with CMN_SimpleFifoReserve(),
+ * fills them directly (by CPU or DMA) and publishes the data with
+ * CMN_SimpleFifoCommit(). The reader side refers data with
+ * CMN_SimpleFifoPeek(), consumes it in place and frees the regions
+ * with CMN_SimpleFifoRelease().
+ *
+ * The writer updates only WP and the reader updates only RP, so one
+ * writer and one reader can work without any lock.
+ */
+//@{
+/*!
+ * @brief Retrieves vacant regions of the FIFO to write data directly.
+ *
+ * The FIFO is not modified. Data written to the regions is not
+ * visible to the reader until CMN_SimpleFifoCommit() is called.
+ * Like a peek handle, the regions may be splited in to 2 pieces.
+ *
+ * @param[in] pHandle Pointer to the control block of the FIFO. NULL
+ *            is NOT allowed.
+ *            - Assertion Failure
+ *                - NULL
+ *
+ * @param[out] pReserveHandle Pointer to the memory in which the
+ *             vacant regions are stored. On failure, cleared with
+ *             values meaning empty. NULL is NOT allowed.
+ *            - Assertion Failure
+ *                - NULL
+ *
+ * @param[in] sz Size of the region to reserve.
+ *
+ * @return
+ *  - On success, size of the reserved region.
+ *  - On failure (not enough space), 0 is returned.
+ */
+size_t CMN_SimpleFifoReserve(
+        const CMN_SimpleFifoHandle* pHandle,
+        CMN_SimpleFifoPeekHandle* pReserveHandle,
+        size_t sz);
+
+/*!
+ * @brief Adds data written into reserved regions to the FIFO.
+ *
+ * The data must be written before this call. If it is written by
+ * DMA, the transfer must be completed and the cache maintained.
+ *
+ * @param[in] pHandle Pointer to the control block of the FIFO. NULL
+ *            is NOT allowed.
+ *            - Assertion Failure
+ *                - NULL
+ *
+ * @param[in] sz Size of data to add. It must not exceed the size
+ *            returned by CMN_SimpleFifoReserve().
+ *
+ * @return
+ *  - On success, size of data added.
+ *  - On failure, 0 is returned and the FIFO is kept untouched.
+ */
+size_t CMN_SimpleFifoCommit(
+        CMN_SimpleFifoHandle* pHandle,
+        size_t sz);
+
+/*!
+ * @brief Removes data on the head of the FIFO without copying it.
+ *
+ * Used after CMN_SimpleFifoPeek() to free the regions which the
+ * reader consumed in place.
+ *
+ * @param[in] pHandle Pointer to the control block of the FIFO. NULL
+ *            is NOT allowed.
+ *            - Assertion Failure
+ *                - NULL
+ *
+ * @param[in] sz Size of data to remove.
+ *
+ * @return
+ *  - On success, size of data removed.
+ *  - On failure (not enough data), 0 is returned and the FIFO is
+ *    kept untouched.
+ */
+size_t CMN_SimpleFifoRelease(
+        CMN_SimpleFifoHandle* pHandle,
+        size_t sz);
+//@}
+
 /*!
  * @name Manupilation
  */
@@ -0,0 +1,262 @@
+/****************************************************************************
+ * modules/include/ringbuffer/ringbuffer_spsc.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __MODULES_INCLUDE_RINGBUFFER_RINGBUFFER_SPSC_H
+#define __MODULES_INCLUDE_RINGBUFFER_RINGBUFFER_SPSC_H
+
+/**
+ * @defgroup rb_spsc Library for Single Producer / Single Consumer
+ *                   Ring Buffer
+ *
+ * Lock-free ring buffer for one writer thread and one reader thread.
+ * The writer updates only the tail and the reader updates only the
+ * head, so no mutex is needed between them. The buffer size is a power
+ * of two and the position is calculated by masking.
+ *
+ * @{
+ * @file  ringbuffer_spsc.h
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <semaphore.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/** Timeout value to wait forever */
+
+#define RINGBUF_SPSC_WAIT_FOREVER  (-1)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct ringbuf_spsc_s
+{
+  FAR uint8_t *buf;      /**< Pointer to buffer */
+  size_t size;           /**< Buffer size (power of two) */
+  size_t mask;           /**< size - 1 */
+  volatile size_t head;  /**< Read count (updated by the reader only) */
+  volatile size_t tail;  /**< Write count (updated by the writer only) */
+  volatile int rwait;    /**< The reader is waiting for data */
+  volatile int wwait;    /**< The writer is waiting for space */
+  sem_t rsem;            /**< Posted when data is written */
+  sem_t wsem;            /**< Posted when data is read */
+};
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/** @name Functions */
+/** @{ */
+
+/**
+ * Allocates a new SPSC Ring Buffer.
+ *
+ * @param [in] size: Size of Ring Buffer to allocate.
+ *                   It is rounded up to a power of two.
+ *
+ * @return On success, the allocated Ring Buffer is returned.
+ * On failure, NULL is returned.
+ */
+
+FAR struct ringbuf_spsc_s *ringbuf_spsc_new(size_t size);
+
+/**
+ * Release a SPSC Ring Buffer.
+ *
+ * @param [in] rb: Pointer to a Ring Buffer to release.
+ *
+ */
+
+void ringbuf_spsc_free(FAR struct ringbuf_spsc_s *rb);
+
+/**
+ * Read from a SPSC Ring Buffer. (reader only)
+ *
+ * Waits until at least one byte is stored, then reads up to count
+ * bytes.
+ *
+ * @param [in] rb: Pointer to a Ring Buffer to read.
+ * @param [in] buf: Pointer to buffer to store data that read from
+ *                  a Ring Buffer.
+ * @param [in] count: Bytes to read.
+ * @param [in] timeout: Time to wait in milliseconds. 0 does not wait.
+ *                      RINGBUF_SPSC_WAIT_FOREVER waits forever.
+ *
+ * @return On success, The number of bytes read.
+ * On failure, negative value is returned according to <errno.h>.
+ * (-EAGAIN if timeout is 0 and the buffer is empty,
+ *  -ETIMEDOUT if timed out.)
+ */
+
+ssize_t ringbuf_spsc_read(FAR struct ringbuf_spsc_s *rb, FAR void *buf,
+                          size_t count, int timeout);
+
+/**
+ * Write to a SPSC Ring Buffer. (writer only)
+ *
+ * Waits until count bytes are free, then writes all of them.
+ *
+ * @param [in] rb: Pointer to a Ring Buffer to write.
+ * @param [in] buf: Pointer to buffer to stored data that write to
+ *                  a Ring Buffer.
+ * @param [in] count: Bytes to write.
+ * @param [in] timeout: Time to wait in milliseconds. 0 does not wait.
+ *                      RINGBUF_SPSC_WAIT_FOREVER waits forever.
+ *
+ * @return On success, The number of bytes written.
+ * On failure, negative value is returned according to <errno.h>.
+ * (-ENOSPC if count is larger than the buffer or timeout is 0 and
+ *  there is no space, -ETIMEDOUT if timed out.)
+ */
+
+ssize_t ringbuf_spsc_write(FAR struct ringbuf_spsc_s *rb,
+                           FAR const void *buf, size_t count, int timeout);
+
+/**
+ * Gets the free region to write directly. (writer only)
+ *
+ * Returns the continuous free region from the tail.
+ * Write data to it and call ringbuf_spsc_write_release().
+ *
+ * @param [in] rb: Pointer to a Ring Buffer.
+ * @param [out] ptr: Address of the free region.
+ *
+ * @return The number of bytes of the free region. (0 if full)
+ */
+
+size_t ringbuf_spsc_write_acquire(FAR struct ringbuf_spsc_s *rb,
+                                  FAR uint8_t **ptr);
+
+/**
+ * Makes data written by ringbuf_spsc_write_acquire() readable.
+ * (writer only)
+ *
+ * @param [in] rb: Pointer to a Ring Buffer.
+ * @param [in] count: Bytes written. It must not exceed the size
+ *                    returned by ringbuf_spsc_write_acquire().
+ *
+ * @return On success, count is returned.
+ * On failure, negative value is returned according to <errno.h>.
+ */
+
+ssize_t ringbuf_spsc_write_release(FAR struct ringbuf_spsc_s *rb,
+                                   size_t count);
+
+/**
+ * Gets the stored data to read directly. (reader only)
+ *
+ * Returns the continuous stored region from the head.
+ * Read data from it and call ringbuf_spsc_read_release().
+ *
+ * @param [in] rb: Pointer to a Ring Buffer.
+ * @param [out] ptr: Address of the stored data.
+ *
+ * @return The number of bytes of the stored data. (0 if empty)
+ */
+
+size_t ringbuf_spsc_read_acquire(FAR struct ringbuf_spsc_s *rb,
+                                 FAR uint8_t **ptr);
+
+/**
+ * Frees data referred by ringbuf_spsc_read_acquire(). (reader only)
+ *
+ * @param [in] rb: Pointer to a Ring Buffer.
+ * @param [in] count: Bytes consumed. It must not exceed the size
+ *                    returned by ringbuf_spsc_read_acquire().
+ *
+ * @return On success, count is returned.
+ * On failure, negative value is returned according to <errno.h>.
+ */
+
+ssize_t ringbuf_spsc_read_release(FAR struct ringbuf_spsc_s *rb,
+                                  size_t count);
+
+/**
+ * Gets the buffer size.
+ *
+ * @param [in] rb: Pointer to a Ring Buffer.
+ *
+ * @return The buffer size.
+ */
+
+size_t ringbuf_spsc_buffersize(FAR struct ringbuf_spsc_s *rb);
+
+/**
+ * Gets the number of bytes used.
+ *
+ * @param [in] rb: Pointer to a Ring Buffer.
+ *
+ * @return The number of bytes used.
+ */
+
+size_t ringbuf_spsc_bytesused(FAR struct ringbuf_spsc_s *rb);
+
+/**
+ * Gets the number of bytes free.
+ *
+ * @param [in] rb: Pointer to a Ring Buffer.
+ *
+ * @return The number of bytes free.
+ */
+
+size_t ringbuf_spsc_bytesavail(FAR struct ringbuf_spsc_s *rb);
+
+/** @} */
+
+/** @} */
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MODULES_INCLUDE_RINGBUFFER_RINGBUFFER_SPSC_H */
@@ -83,6 +83,18 @@ typedef struct tflm_config
   unsigned char cpu_num; /**< Number of CPUs involved in forward propagation */
 } tflm_config_t;
 
+/**
+ * @typedef tflm_arena_t
+ * structure to give a scratch region shared by several runtimes
+ */
+
+typedef struct tflm_arena
+{
+  void *scratch;       /**< Scratch region for non-persistent buffers */
+  int scratch_size;    /**< Size of the scratch region */
+  int persistent_size; /**< Size of the persistent region of the runtime */
+} tflm_arena_t;
+
 /**
  * @typedef tflm_mallinfo_t
  * structure to obtain memory allocation information
@@ -133,7 +145,9 @@ int tflm_finalize(void);
  *
  * @param [in,out] rt:      tflmrt_runtime_t object
  * @param [in]     network: pointer to a memory into which network is loaded
- * @param [in]     size:    tensor arena size
+ * @param [in]     size:    tensor arena size. <br>
+ *                          tflm_runtime_probe_arenasize() tells the
+ *                          minimal size for the network.
  *
  * @return 0 on success, otherwise returns error code in errno_t.
  *
@@ -141,13 +155,67 @@ int tflm_finalize(void);
  *       so applications don't have to give the network object to the other
  *       functions except this. <br>
  *       However, the runtime holds reference to the network object. <br>
- *       Applications must NOT free it until tflm_runtime_finalize().
+ *       Applications must NOT free it until tflm_runtime_finalize(). <br>
+ *       Tensors are allocated in the arena only here. Several
+ *       tflm_runtime_t objects can be kept initialized at once, each with
+ *       its own arena, to switch models without re-allocating tensors.
  */
 
 int tflm_runtime_initialize(tflm_runtime_t *rt,
                             const void *network,
                             int size);
 
+/**
+ * Instantiate a neural network as a tflm_runtime_t object which uses
+ * a scratch region shared with other tflm_runtime_t objects.
+ *
+ * @param [in,out] rt:      tflmrt_runtime_t object
+ * @param [in]     network: pointer to a memory into which network is loaded
+ * @param [in]     arena:   scratch region and persistent region size
+ *
+ * @return 0 on success, otherwise returns error code in errno_t.
+ *
+ * @note Only persistent data of the network (tensor information, op data
+ *       and variable tensors) is allocated for this runtime, with
+ *       tflm_arena_t::persistent_size bytes. <br>
+ *       Activations and scratch buffers are placed in
+ *       tflm_arena_t::scratch, which must be larger than the scratch size
+ *       of every runtime sharing it. Use tflm_runtime_probe_arenasize()
+ *       to get both sizes. <br>
+ *       Runtimes sharing a scratch region must be executed one by one.
+ *       Input and output buffers are in the scratch region too, so write
+ *       inputs just before tflm_runtime_forward() and read outputs
+ *       before forwarding another runtime. <br>
+ *       The scratch region is owned by the application, and must be kept
+ *       until tflm_runtime_finalize().
+ */
+
+int tflm_runtime_initialize_shared(tflm_runtime_t *rt,
+                                   const void *network,
+                                   const tflm_arena_t *arena);
+
+/**
+ * Determine the minimal tensor arena size for a neural network.
+ *
+ * @param [in]  network:         pointer to a memory into which network is
+ *                               loaded
+ * @param [in]  max_size:        size of a temporary arena to try
+ *                               allocating tensors. <br>
+ *                               If 0, the largest free block of the heap
+ *                               is used.
+ * @param [out] persistent_size: size of persistent region of the network.
+ *                               Can be NULL.
+ *
+ * @return minimal arena size to give to tflm_runtime_initialize() on
+ *         success, otherwise returns error code in errno_t.
+ *
+ * @note The scratch size for tflm_runtime_initialize_shared() is
+ *       the returned value minus persistent_size.
+ */
+
+int tflm_runtime_probe_arenasize(const void *network, int max_size,
+                                 int *persistent_size);
+
 /**
  * Free all the memory allocated to a tflm_runtime_t object
  *
@@ -179,6 +247,20 @@ int tflm_runtime_finalize(tflm_runtime_t *rt);
 int tflm_runtime_forward(tflm_runtime_t *rt, const void *inputs[],
                         unsigned char input_num);
 
+/**
+ * Execute forward propagation on input data already written into
+ * the buffers returned by tflm_runtime_input_buffer().
+ *
+ * @param [in,out] rt:        tflmrt_runtime_t object
+ *
+ * @return 0 on success, otherwise returns error code in errno_t.
+ * @note unlike tflm_runtime_forward(), no input data is copied. <br>
+ *       Producers such as camera or audio capture can fill the input
+ *       buffers directly, and this function runs the network on them.
+ */
+
+int tflm_runtime_forward_inplace(tflm_runtime_t *rt);
+
 /**
  * Return the size of tensorflow arena size.
  *
@@ -250,6 +332,25 @@ int tflm_runtime_input_shape(tflm_runtime_t *rt, unsigned char input_index,
 TfLiteTensor *tflm_runtime_input_variable(tflm_runtime_t *rt,
                                           unsigned char input_index);
 
+/**
+ * Return a writable pointer to a specified input
+ *
+ * @param [in,out] rt:          tflmrt_runtime_t object
+ * @param [in]     input_index: index to specify an input
+ * @return pointer to corresponding the input buffer if
+ *         input_index is valid, otherwise NULL.
+ * @note write input data taking the following points into account:
+ *   - input_index must be less than tflm_runtime_input_num(rt)
+ *   - length of the input buffer equals to
+ *     tflm_runtime_input_size(rt, input_index)
+ *   - the buffer is a part of the tensor arena. It is valid until
+ *     tflm_runtime_finalize(), and may be overwritten during forward
+ *     propagation, so write it again before each forward.
+ */
+
+void *tflm_runtime_input_buffer(tflm_runtime_t *rt,
+                                unsigned char input_index);
+
 /**
  * Return the number of outputs which this network emits.
  *
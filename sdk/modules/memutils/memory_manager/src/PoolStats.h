@@ -0,0 +1,111 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/PoolStats.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef POOLSTATS_H_INCLUDED
+#define POOLSTATS_H_INCLUDED
+
+#include "memutils/memory_manager/MemPool.h"
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+
+#include <time.h>
+
+/* Work area size of the allocation time array of a pool */
+
+#define POOL_STATS_WORK_SIZE(num_segs) \
+  (sizeof(uint32_t) * (num_segs) + sizeof(uint32_t))
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Monotonic time in microseconds (wraps in about 71 minutes)
+ *****************************************************************/
+static inline uint32_t getPoolStatsTime()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<uint32_t>(ts.tv_sec) * 1000000u +
+	       static_cast<uint32_t>(ts.tv_nsec) / 1000u;
+}
+
+/* Raise *max to val if val is larger. */
+
+template <typename T>
+static inline void atomicStoreMax(T* max, T val)
+{
+	T cur = __atomic_load_n(max, __ATOMIC_RELAXED);
+	while (val > cur &&
+	       !__atomic_compare_exchange_n(max, &cur, val, true,
+	                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	}
+}
+
+/*****************************************************************
+ * A segment was taken from the pool
+ *****************************************************************/
+inline void MemPool::noteSegAlloc(NumSeg seg_no)
+{
+	m_alloc_time[seg_no - 1] = getPoolStatsTime();
+	__atomic_add_fetch(&m_counters.alloc_count, 1, __ATOMIC_RELAXED);
+
+	NumSeg used = __atomic_add_fetch(&m_counters.used_segs, 1, __ATOMIC_RELAXED);
+	atomicStoreMax(&m_counters.max_used_segs, used);
+}
+
+/*****************************************************************
+ * A segment was returned to the pool
+ *****************************************************************/
+inline void MemPool::noteSegFree(NumSeg seg_no)
+{
+	uint32_t hold = getPoolStatsTime() - m_alloc_time[seg_no - 1];
+	atomicStoreMax(&m_counters.max_hold_us, hold);
+
+	__atomic_add_fetch(&m_counters.free_count, 1, __ATOMIC_RELAXED);
+	__atomic_sub_fetch(&m_counters.used_segs, 1, __ATOMIC_RELAXED);
+}
+
+/*****************************************************************
+ * An allocation failed because the pool was empty
+ *****************************************************************/
+inline void MemPool::noteAllocFail()
+{
+	__atomic_add_fetch(&m_counters.alloc_fails, 1, __ATOMIC_RELAXED);
+}
+
+} /* namespace MemMgrLite */
+
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS */
+
+#endif /* POOLSTATS_H_INCLUDED */
@@ -0,0 +1,104 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/RingBufPool.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef RINGBUFPOOL_H_INCLUDED
+#define RINGBUFPOOL_H_INCLUDED
+
+#include "memutils/common_utils/common_errcode.h"
+#include "memutils/memory_manager/MemPool.h"
+
+#ifdef USE_MEMMGR_RINGBUF_POOL
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Ring buffer memory pool class
+ *
+ * Segments of any size are reserved contiguously at the tail of the
+ * pool area, and the area is reused from the head as the oldest
+ * segments are freed. The number of segments (num_segs) is the number
+ * of reservations that can be held at the same time.
+ * A segment freed out of order is kept until all older segments
+ * are freed.
+ *****************************************************************/
+class RingBufPool : public MemPool {
+	friend class Manager;
+protected:
+	struct SegDesc {
+		PoolSize	offset;		/* offset from the pool address */
+		PoolSize	size;		/* reserved size (4bytes aligned) */
+	}; /* struct SegDesc */
+
+	RingBufPool(const PoolSectionAttr& attr, FastMemAlloc& fma);
+	~RingBufPool();
+
+	bool isFailed() {
+		return MemPool::isFailed() || m_order_que.que_area() == NULL || m_desc == NULL;
+	}
+
+	/* reserve a contiguous segment of the requested size */
+	err_t		allocSeg(size_t size_for_check, MemHandleProxy &proxy);
+
+	/* fix the used size of a segment */
+	err_t		commitSeg(const MemHandleBase& mh, size_t size);
+
+	/* free a memory segment */
+	void		freeSeg(MemHandleBase& mh);
+
+	PoolAddr	getSegAddr(const MemHandleBase& mh) const;
+	PoolSize	getSegSize(const MemHandleBase& mh) const;
+	PoolSize	getFreeSize() const;
+
+private:
+	static PoolSize	roundSize(size_t size) {
+		return (size == 0) ? sizeof(uint32_t) : MEMUTILS_ROUND_UP(size, sizeof(uint32_t));
+	}
+
+	void		releaseHead();
+
+	/* Segment numbers in use, in reservation order. */
+
+	RuntimeQue<NumSeg, NumSeg>	m_order_que;
+
+	SegDesc*	m_desc;		/* descriptor of each segment */
+	PoolSize	m_head;		/* offset of the oldest segment */
+	PoolSize	m_tail;		/* offset of the next reservation */
+}; /* class RingBufPool */
+
+} /* namespace MemMgrLite */
+
+#endif /* USE_MEMMGR_RINGBUF_POOL */
+
+#endif /* RINGBUFPOOL_H_INCLUDED */
@@ -0,0 +1,123 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/SegCache.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef SEGCACHE_H_INCLUDED
+#define SEGCACHE_H_INCLUDED
+
+#include <string.h>
+#include "memutils/memory_manager/MemMgrTypes.h"
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+
+#include <sched.h>
+#include <nuttx/arch.h>
+
+#ifdef CONFIG_SMP
+#  define SEG_CACHE_NCPUS   CONFIG_SMP_NCPUS
+#  define SEG_CACHE_CPU()   up_cpu_index()
+#else
+#  define SEG_CACHE_NCPUS   1
+#  define SEG_CACHE_CPU()   0
+#endif
+
+#define SEG_CACHE_DEPTH     CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE_DEPTH
+#define SEG_CACHE_BATCH     (SEG_CACHE_DEPTH / 2)
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Preemption lock class
+ * The cache of a CPU is touched only by the task running on it,
+ * so disabling preemption is enough. Interrupts stay enabled.
+ *****************************************************************/
+class PreemptLock : CopyGuard {
+public:
+	PreemptLock()  { sched_lock(); }
+	~PreemptLock() { sched_unlock(); }
+}; /* class PreemptLock */
+
+/*****************************************************************
+ * Segment magazine of one CPU
+ *****************************************************************/
+struct SegMagazine {
+	NumSeg		count;			/* number of cached segments */
+	NumSeg		segs[SEG_CACHE_DEPTH];	/* cached segment numbers (LIFO) */
+	uint32_t	alloc_hits;
+	uint32_t	alloc_misses;
+	uint32_t	free_hits;
+	uint32_t	free_misses;
+	uint32_t	refills;
+	uint32_t	flushes;
+
+	bool	empty() const { return count == 0; }
+	bool	full() const  { return count == SEG_CACHE_DEPTH; }
+	void	push(NumSeg seg_no) { segs[count++] = seg_no; }
+	NumSeg	pop() { return segs[--count]; }
+}; /* struct SegMagazine */
+
+/*****************************************************************
+ * Per-CPU segment cache class
+ *****************************************************************/
+class SegCache : CopyGuard {
+public:
+	SegCache() { memset(m_mag, 0, sizeof(m_mag)); }
+
+	SegMagazine&	getMagazine() { return m_mag[SEG_CACHE_CPU()]; }
+	SegMagazine&	getMagazine(uint32_t cpu) { return m_mag[cpu]; }
+	const SegMagazine&	getMagazine(uint32_t cpu) const { return m_mag[cpu]; }
+
+private:
+	SegMagazine	m_mag[SEG_CACHE_NCPUS];
+}; /* class SegCache */
+
+/* Atomic update of the segment reference counter.
+ * Used so that the counter can be changed without the pool lock.
+ */
+
+static inline SegRefCnt atomicIncRefCnt(SegRefCnt* cnt)
+{
+	return __atomic_add_fetch(cnt, 1, __ATOMIC_ACQ_REL);
+}
+
+static inline SegRefCnt atomicDecRefCnt(SegRefCnt* cnt)
+{
+	return __atomic_sub_fetch(cnt, 1, __ATOMIC_ACQ_REL);
+}
+
+} /* namespace MemMgrLite */
+
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE */
+
+#endif /* SEGCACHE_H_INCLUDED */
@@ -0,0 +1,104 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/SizeClassPool.h
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef SIZECLASSPOOL_H_INCLUDED
+#define SIZECLASSPOOL_H_INCLUDED
+
+#include "memutils/common_utils/common_errcode.h"
+#include "memutils/memory_manager/MemPool.h"
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Size-class memory pool class
+ *
+ * The pool area is divided into classes of different segment sizes.
+ * Segment numbers are assigned in class order, so the class of a
+ * segment is found from its number. Each class has its own queue of
+ * free segments, and a bitmap of non-empty classes lets allocSeg()
+ * find the smallest fitting class in constant time.
+ *****************************************************************/
+class SizeClassPool : public MemPool {
+	friend class Manager;
+	friend class MemPool;
+protected:
+	struct SegClass {
+		PoolAddr	addr;		/* address of the first segment */
+		PoolSize	seg_size;	/* segment size (4bytes aligned) */
+		NumSeg		first_seg;	/* first segment number (1 origin) */
+		NumSeg		last_seg;	/* last segment number (1 origin) */
+	}; /* struct SegClass */
+
+	SizeClassPool(const PoolSectionAttr& attr, const SizeClassAttr* classes,
+		      uint8_t num_classes, FastMemAlloc& fma);
+	~SizeClassPool();
+
+	bool isFailed() {
+		return MemPool::isFailed() || m_classes == NULL || m_class_ques == NULL;
+	}
+
+	/* allocate a memory segment from the smallest fitting class */
+	err_t		allocSeg(size_t size_for_check, MemHandleProxy &proxy);
+
+	/* free a memory segment */
+	void		freeSeg(MemHandleBase& mh);
+
+	PoolAddr	getSegAddr(const MemHandleBase& mh) const;
+	PoolSize	getSegSize(const MemHandleBase& mh) const;
+
+	/* Work area size for one pool, excluding PoolSectionAttr. */
+
+	static uint32_t	getWorkSize(NumSeg num_segs, uint8_t num_classes);
+
+private:
+	uint8_t		findClass(NumSeg seg_no) const;
+
+	typedef RuntimeQue<NumSeg, NumSeg>	SegNoQue;
+
+	uint8_t		m_num_classes;
+	uint8_t		m_avail_mask;	/* bit n is set when class n has a free segment */
+	SegClass*	m_classes;
+	SegNoQue*	m_class_ques;
+}; /* class SizeClassPool */
+
+S_ASSERT(MaxSizeClasses <= 8);	/* m_avail_mask is 8bits */
+
+} /* namespace MemMgrLite */
+
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL */
+
+#endif /* SIZECLASSPOOL_H_INCLUDED */
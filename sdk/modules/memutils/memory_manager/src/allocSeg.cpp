@@ -36,6 +36,10 @@
 #include "ScopedLock.h"
 #include "memutils/memory_manager/MemHandleBase.h"
 #include "BasicPool.h"
+#include "RingBufPool.h"
+#include "SegCache.h"
+#include "SizeClassPool.h"
+#include "PoolStats.h"
 
 namespace MemMgrLite {
 
@@ -55,22 +59,41 @@ err_t MemHandleBase::allocSeg(PoolId id, size_t size_for_check)
 err_t Manager::allocSeg(PoolId id, size_t size_for_check, MemHandleProxy &proxy)
 {
   MemPool* pool = findPool(id);
+  err_t    err;
 
-#ifdef USE_MEMMGR_RINGBUF_POOL
+#if defined(USE_MEMMGR_RINGBUF_POOL) || defined(CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL)
   /* 仮想関数を使用しない方針なので、該当プール型にダウンキャストする */
   switch (pool->getPoolType()) {
   case BasicType:
-    return static_cast<BasicPool*>(pool)->allocSeg(size_for_check);
+    err = static_cast<BasicPool*>(pool)->allocSeg(size_for_check, proxy);
+    break;
+#ifdef USE_MEMMGR_RINGBUF_POOL
   case RingBufType:
-    return static_cast<RingBufPool*>(pool)->allocSeg(size_for_check);
+    err = static_cast<RingBufPool*>(pool)->allocSeg(size_for_check, proxy);
+    break;
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+  case SizeClassType:
+    err = static_cast<SizeClassPool*>(pool)->allocSeg(size_for_check, proxy);
+    break;
+#endif
   default:
     D_ASSERT(false);
-    return MemHandleProxy();  /* default constructor */
+    return ERR_ARG;
   }
 #else
   /* BasicPoolのみ使用時は、各種チェックを省略する */
-  return static_cast<BasicPool*>(pool)->allocSeg(size_for_check, proxy);
+  err = static_cast<BasicPool*>(pool)->allocSeg(size_for_check, proxy);
+#endif
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  if (err == ERR_MEM_EMPTY)
+    {
+      pool->noteAllocFail();
+    }
 #endif
+
+  return err;
 }
 
 /*****************************************************************
@@ -83,8 +106,13 @@ err_t BasicPool::allocSeg(size_t size_for_check, MemHandleProxy &proxy)
       return ERR_DATA_SIZE;
     }
 
-  ScopedLock lock;
-  proxy = MemPool::allocSeg();
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+  if (up_interrupt_context() || !MemPool::allocSegCached(proxy))
+#endif
+    {
+      ScopedLock lock;
+      proxy = MemPool::allocSeg();
+    }
 
   if (proxy == 0)
     {
@@ -110,12 +138,63 @@ MemHandleProxy MemPool::allocSeg()
     /* セグメント参照カウンタを設定する */
     D_ASSERT(m_ref_cnt_array[seg_no - 1] == 0);  /* 未使用のはず */
     m_ref_cnt_array[seg_no - 1] = 1;  /* インクリメントより代入の方が効率が良い */
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+    noteSegAlloc(seg_no);
+#endif
 
     mhp = MemHandleBase::makeMemHandleProxy(getPoolId(), seg_no, 0);
   }
   return mhp;
 }
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+/*****************************************************************
+ * Get a segment handle from the cache of the running CPU.
+ * When the cache is empty, refill it from the pool in a batch.
+ * The attachment is checked with preemption disabled, so that
+ * attach/detach from another task cannot change it meanwhile.
+ *****************************************************************/
+bool MemPool::allocSegCached(MemHandleProxy& proxy)
+{
+  PreemptLock lock;
+  if (!isSegCacheAttached()) {
+    return false;
+  }
+
+  SegMagazine& mag = m_seg_cache->getMagazine();
+  proxy = 0;
+
+  if (mag.empty()) {
+    ++mag.alloc_misses;
+
+    /* Refill under the pool lock */
+    ScopedLock pool_lock;
+    while (mag.count < SEG_CACHE_BATCH && m_seg_no_que.size()) {
+      mag.push(m_seg_no_que.top());
+      m_seg_no_que.pop();
+    }
+    if (mag.empty()) {
+      return true;
+    }
+    ++mag.refills;
+  } else {
+    ++mag.alloc_hits;
+  }
+
+  NumSeg seg_no = mag.pop();
+
+  /* The segment is owned by nobody, so no other CPU touches the counter. */
+  D_ASSERT(m_ref_cnt_array[seg_no - 1] == 0);
+  __atomic_store_n(&m_ref_cnt_array[seg_no - 1], 1, __ATOMIC_RELEASE);
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  noteSegAlloc(seg_no);
+#endif
+
+  proxy = MemHandleBase::makeMemHandleProxy(getPoolId(), seg_no, 0);
+  return true;
+}
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE */
+
 } /* end of namespace MemMgrLite */
 
 /* allocSeg.cxx */
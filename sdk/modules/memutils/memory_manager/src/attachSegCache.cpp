@@ -0,0 +1,235 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/attachSegCache.cpp
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <new>
+#include "ScopedLock.h"
+#include "memutils/memory_manager/Manager.h"
+#include "SegCache.h"
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Get the work area size of segment caches
+ *****************************************************************/
+uint32_t Manager::getSegCacheWorkSize()
+{
+  return sizeof(SegCache);
+}
+
+/*****************************************************************
+ * Attach per-CPU segment caches to a pool
+ *****************************************************************/
+err_t Manager::attachSegCache(PoolId id, void* work_area, uint32_t area_size)
+{
+#ifdef USE_MEMMGR_MULTI_CORE
+  /* Pools are shared with other cores, which have no cache of their own */
+
+  (void)id;
+  (void)work_area;
+  (void)area_size;
+  return ERR_STS;
+#else
+  if (reinterpret_cast<uint32_t>(work_area) % sizeof(uint32_t) != 0)
+    {
+      return ERR_ADR_ALIGN;
+    }
+
+  if (area_size < getSegCacheWorkSize())
+    {
+      return ERR_DATA_SIZE;
+    }
+
+  MemPool* pool = lookupStaticPool(id);
+  if (pool == NULL || pool->getPoolType() != BasicType)
+    {
+      return ERR_ARG;
+    }
+
+  if (pool->isSegCacheAttached())
+    {
+      return ERR_STS;
+    }
+
+  pool->attachSegCache(new(work_area) SegCache);
+
+  return ERR_OK;
+#endif
+}
+
+/*****************************************************************
+ * Detach per-CPU segment caches from a pool
+ *****************************************************************/
+void* Manager::detachSegCache(PoolId id)
+{
+  MemPool* pool = lookupStaticPool(id);
+  if (pool == NULL || pool->getPoolType() != BasicType)
+    {
+      return NULL;
+    }
+
+  return pool->detachSegCache();
+}
+
+/*****************************************************************
+ * Get statistics of segment caches
+ *****************************************************************/
+err_t Manager::getSegCacheStats(PoolId id, SegCacheStats* stats)
+{
+  D_ASSERT(stats);
+
+  MemPool* pool = lookupStaticPool(id);
+  if (pool == NULL || pool->getPoolType() != BasicType)
+    {
+      return ERR_ARG;
+    }
+
+  if (!pool->isSegCacheAttached())
+    {
+      return ERR_STS;
+    }
+
+  pool->getSegCacheStats(*stats);
+
+  return ERR_OK;
+}
+
+/*****************************************************************
+ * Reset statistics of segment caches
+ *****************************************************************/
+void Manager::resetSegCacheStats(PoolId id)
+{
+  MemPool* pool = lookupStaticPool(id);
+  if (pool == NULL || pool->getPoolType() != BasicType)
+    {
+      return;
+    }
+
+  pool->resetSegCacheStats();
+}
+
+/*****************************************************************
+ * Set the cache to the pool
+ *****************************************************************/
+void MemPool::attachSegCache(SegCache* cache)
+{
+  ScopedLock lock;
+  m_seg_cache = cache;
+}
+
+/*****************************************************************
+ * Return all cached segments to the pool and clear the cache
+ *****************************************************************/
+SegCache* MemPool::detachSegCache()
+{
+  ScopedLock lock;
+
+  SegCache* cache = m_seg_cache;
+  if (cache != NULL) {
+    for (uint32_t cpu = 0; cpu < SEG_CACHE_NCPUS; ++cpu) {
+      SegMagazine& mag = cache->getMagazine(cpu);
+      while (!mag.empty()) {
+        D_ASSERT(m_seg_no_que.full() == false);
+        (void)m_seg_no_que.push(mag.pop());
+      }
+    }
+    m_seg_cache = NULL;
+  }
+  return cache;
+}
+
+/*****************************************************************
+ * Get the number of segments held by the caches
+ *****************************************************************/
+NumSeg MemPool::getNumCachedSegs() const
+{
+  uint32_t n = 0;
+  if (m_seg_cache != NULL) {
+    for (uint32_t cpu = 0; cpu < SEG_CACHE_NCPUS; ++cpu) {
+      n += m_seg_cache->getMagazine(cpu).count;
+    }
+  }
+  return static_cast<NumSeg>(n);
+}
+
+/*****************************************************************
+ * Sum up the statistics of all CPUs
+ *****************************************************************/
+void MemPool::getSegCacheStats(SegCacheStats& stats) const
+{
+  memset(&stats, 0, sizeof(stats));
+  if (m_seg_cache == NULL) {
+    return;
+  }
+
+  for (uint32_t cpu = 0; cpu < SEG_CACHE_NCPUS; ++cpu) {
+    const SegMagazine& mag = m_seg_cache->getMagazine(cpu);
+    stats.alloc_hits   += mag.alloc_hits;
+    stats.alloc_misses += mag.alloc_misses;
+    stats.free_hits    += mag.free_hits;
+    stats.free_misses  += mag.free_misses;
+    stats.refills      += mag.refills;
+    stats.flushes      += mag.flushes;
+  }
+  stats.cached_segs = getNumCachedSegs();
+}
+
+/*****************************************************************
+ * Clear the statistics of all CPUs
+ *****************************************************************/
+void MemPool::resetSegCacheStats()
+{
+  if (m_seg_cache == NULL) {
+    return;
+  }
+
+  ScopedLock lock;
+  for (uint32_t cpu = 0; cpu < SEG_CACHE_NCPUS; ++cpu) {
+    SegMagazine& mag = m_seg_cache->getMagazine(cpu);
+    mag.alloc_hits   = 0;
+    mag.alloc_misses = 0;
+    mag.free_hits    = 0;
+    mag.free_misses  = 0;
+    mag.refills      = 0;
+    mag.flushes      = 0;
+  }
+}
+
+} /* end of namespace MemMgrLite */
+
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE */
+
+/* attachSegCache.cxx */
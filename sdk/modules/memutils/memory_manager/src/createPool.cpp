@@ -37,6 +37,8 @@
 #include "FastMemAlloc.h"  /* FastMemAlloc class */
 #include "memutils/memory_manager/Manager.h"
 #include "BasicPool.h"
+#include "RingBufPool.h"
+#include "PoolStats.h"
 
 namespace MemMgrLite {
 
@@ -52,7 +54,10 @@ MemPool* Manager::createPool(const PoolSectionAttr& attr, FastMemAlloc& fma)
     pool = new(fma, sizeof(uint32_t)) BasicPool(attr, fma);
     break;
   case RingBufType:
-    pool = new(fma, sizeof(uint32_t)) RingBufPool(attr, fma);
+    {
+      RingBufPool* ring = new(fma, sizeof(uint32_t)) RingBufPool(attr, fma);
+      pool = (ring && ring->isFailed()) ? NULL : ring;
+    }
     break;
   default:
     D_ASSERT(false);  /* Unsupport pool type */
@@ -88,14 +93,26 @@ BasicPool::BasicPool(const PoolSectionAttr& attr, FastMemAlloc& fma) :
 /*****************************************************************
  * メモリプールのコンストラクタ
  *****************************************************************/
-MemPool::MemPool(const PoolSectionAttr& attr, FastMemAlloc& fma) :
+MemPool::MemPool(const PoolSectionAttr& attr, FastMemAlloc& fma,
+                 bool use_seg_no_que) :
   m_attr(attr),
-  m_seg_no_que(fma.alloc(sizeof(NumSeg) * attr.num_segs, sizeof(NumSeg)), attr.num_segs),
+  m_seg_no_que(use_seg_no_que ? fma.alloc(sizeof(NumSeg) * attr.num_segs, sizeof(NumSeg)) : NULL,
+               use_seg_no_que ? attr.num_segs : 0),
   m_ref_cnt_array(static_cast<SegRefCnt*>(fma.alloc(sizeof(SegRefCnt) * attr.num_segs, sizeof(SegRefCnt))))
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+  , m_seg_cache(NULL)
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  , m_alloc_time(static_cast<uint32_t*>(fma.alloc(sizeof(uint32_t) * attr.num_segs, sizeof(uint32_t))))
+#endif
 {
-  if (m_seg_no_que.que_area() && m_ref_cnt_array) { /* alloc成功 ? */
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  memset(&m_counters, 0x00, sizeof(m_counters));
+#endif
+
+  if (!isFailed()) { /* alloc成功 ? */
     /* 使用可能なセグメント番号(1 origin)を設定 */
-    for (uint32_t i = 1; i <= static_cast<uint32_t>(attr.num_segs); ++i) {
+    for (uint32_t i = 1; i <= static_cast<uint32_t>(m_seg_no_que.capacity()); ++i) {
       (void)m_seg_no_que.push(static_cast<NumSeg>(i));
     }
 
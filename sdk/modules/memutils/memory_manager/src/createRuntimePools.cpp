@@ -0,0 +1,319 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/createRuntimePools.cpp
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "FastMemAlloc.h"
+#include "ScopedLock.h"
+#include "memutils/memory_manager/Manager.h"
+#include "BasicPool.h"
+#include "RingBufPool.h"
+#include "PoolStats.h"
+#include "SizeClassPool.h"
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_RUNTIME_LAYOUT
+
+namespace MemMgrLite {
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_USE_FENCE
+#  define POOL_FENCE_SIZE(attr)  ((attr).fence ? sizeof(uint32_t) : 0)
+#else
+#  define POOL_FENCE_SIZE(attr)  0
+#endif
+
+/*****************************************************************
+ * Check a pool definition and return the total number of segments
+ * and the pool size. Return false for a bad definition.
+ *****************************************************************/
+static bool getRuntimePoolShape(const RuntimePoolAttr& attr,
+                                uint32_t* num_segs, PoolSize* size)
+{
+  if (attr.align == 0 || (attr.align & (attr.align - 1)) != 0)
+    {
+      return false;
+    }
+
+  uint32_t segs = 0;
+  PoolSize sz   = 0;
+
+  switch (attr.type)
+    {
+      case BasicType:
+#ifdef USE_MEMMGR_RINGBUF_POOL
+      case RingBufType:
+#endif
+        if (attr.num_segs == 0 || attr.seg_size == 0)
+          {
+            return false;
+          }
+
+        segs = attr.num_segs;
+        sz   = attr.seg_size * attr.num_segs;
+        break;
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+      case SizeClassType:
+        if (attr.classes == NULL ||
+            attr.num_classes == 0 || attr.num_classes > MaxSizeClasses)
+          {
+            return false;
+          }
+
+        for (uint8_t i = 0; i < attr.num_classes; ++i)
+          {
+            const SizeClassAttr& cls = attr.classes[i];
+
+            /* Classes must be given in ascending order of size. */
+
+            if (cls.num_segs == 0 || cls.seg_size == 0 ||
+                (i > 0 && cls.seg_size <= attr.classes[i - 1].seg_size))
+              {
+                return false;
+              }
+
+            segs += cls.num_segs;
+            sz   += MEMUTILS_ROUND_UP(cls.seg_size, sizeof(uint32_t)) * cls.num_segs;
+          }
+        break;
+#endif
+
+      default:
+        return false;
+    }
+
+  if (segs > static_cast<NumSeg>(~0))
+    {
+      return false;
+    }
+
+  *num_segs = segs;
+  *size     = sz;
+  return true;
+}
+
+/*****************************************************************
+ * Destroy the pools created before a failure.
+ * 排他制御は呼び出し側で行うこと
+ *****************************************************************/
+void Manager::destroyRuntimePools(MemPool** pools,
+                                  const RuntimePoolAttr* begin,
+                                  const RuntimePoolAttr* end)
+{
+  for (const RuntimePoolAttr* ra = begin; ra != end; ++ra)
+    {
+      destroyPool(pools[ra->id]);
+      pools[ra->id] = NULL;
+    }
+}
+
+/*****************************************************************
+ * Pool area size of a runtime layout
+ *****************************************************************/
+uint32_t Manager::getRuntimePoolsAreaSize(const RuntimePoolAttr *pool_attr)
+{
+  uint32_t total = 0;
+
+  for (; pool_attr->id != NullPoolId.pool; ++pool_attr)
+    {
+      uint32_t num_segs;
+      PoolSize size;
+
+      if (!getRuntimePoolShape(*pool_attr, &num_segs, &size))
+        {
+          return 0;
+        }
+
+      /* Worst case of alignment skip and fences */
+
+      total += (pool_attr->align - 1) + POOL_FENCE_SIZE(*pool_attr) * 2 + size;
+    }
+
+  return total;
+}
+
+/*****************************************************************
+ * Work area size of a runtime layout
+ *****************************************************************/
+uint32_t Manager::getRuntimePoolsWorkSize(const RuntimePoolAttr *pool_attr)
+{
+  uint32_t total = 0;
+
+  for (; pool_attr->id != NullPoolId.pool; ++pool_attr)
+    {
+      uint32_t num_segs;
+      PoolSize size;
+
+      if (!getRuntimePoolShape(*pool_attr, &num_segs, &size))
+        {
+          return 0;
+        }
+
+      total += MEMUTILS_ROUND_UP(sizeof(PoolSectionAttr), sizeof(uint32_t));
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+      total += POOL_STATS_WORK_SIZE(num_segs);
+#endif
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+      if (pool_attr->type == SizeClassType)
+        {
+          total += SizeClassPool::getWorkSize(num_segs, pool_attr->num_classes);
+          continue;
+        }
+#endif
+#ifdef USE_MEMMGR_RINGBUF_POOL
+      if (pool_attr->type == RingBufType)
+        {
+          total += sizeof(RingBufPool) - sizeof(BasicPool) +
+                   (sizeof(NumSeg) + sizeof(PoolSize) * 2) * num_segs +
+                   sizeof(uint32_t) * 2;
+        }
+#endif
+      total += sizeof(BasicPool) + sizeof(uint32_t) +
+               sizeof(NumSeg) * num_segs + sizeof(NumSeg) +
+               sizeof(SegRefCnt) * num_segs;
+    }
+
+  return total;
+}
+
+/*****************************************************************
+ * Create memory pools from a layout table built at runtime
+ *****************************************************************/
+err_t Manager::createRuntimePools(uint8_t sec_no, NumLayout layout_no,
+                                  const RuntimePoolAttr *pool_attr,
+                                  void* pool_area, uint32_t pool_size,
+                                  void* work_area, uint32_t work_size)
+{
+  if (reinterpret_cast<uint32_t>(work_area) % sizeof(uint32_t) != 0)
+    {
+      return ERR_ADR_ALIGN;
+    }
+
+  if (sec_no > 3 || pool_attr == NULL || pool_area == NULL)
+    {
+      return ERR_ARG;
+    }
+
+  if (theManager == NULL)
+    {
+      return ERR_STS;
+    }
+
+  if (isStaticPoolAvailable(sec_no))
+    {
+      return ERR_STS;
+    }
+
+  /* Check the whole table before creating any pool. */
+
+  uint32_t need_area = getRuntimePoolsAreaSize(pool_attr);
+  uint32_t need_work = getRuntimePoolsWorkSize(pool_attr);
+
+  if (need_area == 0 || need_work == 0)
+    {
+      return ERR_ARG;
+    }
+
+  if (pool_size < need_area || work_size < need_work)
+    {
+      return ERR_DATA_SIZE;
+    }
+
+  FastMemAlloc  fma(work_area, work_size);
+  PoolAddr      addr = reinterpret_cast<PoolAddr>(pool_area);
+
+  ScopedLock lock;
+
+  MemPool **pools = theManager->m_static_pools[sec_no];
+
+  for (const RuntimePoolAttr* ra = pool_attr; ra->id != NullPoolId.pool; ++ra)
+    {
+      if (ra->id >= theManager->m_pool_num[sec_no] || pools[ra->id] != NULL)
+        {
+          destroyRuntimePools(pools, pool_attr, ra);
+          return ERR_ARG;
+        }
+
+      uint32_t num_segs;
+      PoolSize size;
+      (void)getRuntimePoolShape(*ra, &num_segs, &size);
+
+      /* Place the pool. The lower fence is put just before the pool. */
+
+      addr = MEMUTILS_ROUND_UP(addr + POOL_FENCE_SIZE(*ra), ra->align);
+
+      PoolSectionAttr* attr = new(fma, sizeof(uint32_t)) PoolSectionAttr;
+      D_ASSERT(attr);
+      attr->id.sec   = sec_no;
+      attr->id.pool  = ra->id;
+      attr->type     = ra->type;
+      attr->num_segs = static_cast<NumSeg>(num_segs);
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_USE_FENCE
+      attr->fence    = ra->fence;
+#endif
+#ifdef USE_MEMMGR_MULTI_CORE
+      attr->spl_id   = NullLockId;
+#endif
+      attr->addr     = addr;
+      attr->size     = size;
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+      if (ra->type == SizeClassType)
+        {
+          pools[ra->id] = createSizeClassPool(*attr, ra->classes, ra->num_classes, fma);
+        }
+      else
+#endif
+        {
+          pools[ra->id] = createPool(*attr, fma);
+        }
+
+      if (pools[ra->id] == NULL)
+        {
+          destroyRuntimePools(pools, pool_attr, ra);
+          return ERR_DATA_SIZE;
+        }
+
+      addr += size + POOL_FENCE_SIZE(*ra);
+    }
+
+  theManager->m_layout_no[sec_no] = layout_no;
+
+  return ERR_OK;
+}
+
+} /* end of namespace MemMgrLite */
+
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_RUNTIME_LAYOUT */
+
+/* createRuntimePools.cxx */
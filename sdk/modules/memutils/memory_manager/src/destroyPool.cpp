@@ -35,6 +35,8 @@
 
 #include "memutils/memory_manager/Manager.h"
 #include "BasicPool.h"
+#include "RingBufPool.h"
+#include "SizeClassPool.h"
 
 namespace MemMgrLite {
 
@@ -44,15 +46,22 @@ namespace MemMgrLite {
  *****************************************************************/
 void Manager::destroyPool(MemPool* pool)
 {
-#ifdef USE_MEMMGR_RINGBUF_POOL
+#if defined(USE_MEMMGR_RINGBUF_POOL) || defined(CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL)
 	/* 仮想関数を使用しない方針なので、該当プール型にダウンキャストする */
 	switch (pool->getPoolType()) {
 	case BasicType:
 		static_cast<BasicPool*>(pool)->~BasicPool();
 		break;
+#ifdef USE_MEMMGR_RINGBUF_POOL
 	case RingBufType:
 		static_cast<RingBufPool*>(pool)->~RingBufPool();
 		break;
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+	case SizeClassType:
+		static_cast<SizeClassPool*>(pool)->~SizeClassPool();
+		break;
+#endif
 	default:
 		D_ASSERT(false);	/* Unsupport pool type */
 		break;
@@ -84,6 +93,11 @@ MemPool::~MemPool()
 	}
 #endif
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+	/* Cached segments are not leaked. Return them before the check. */
+	(void)detachSegCache();
+#endif
+
 	if (!m_seg_no_que.full()) {
 #ifdef USE_MEMMGR_DEBUG_OUTPUT
 		printf("~MemPool: Segment leak found. PoolId=%d\n", getPoolId());
@@ -36,6 +36,10 @@
 #include "ScopedLock.h"
 #include "memutils/memory_manager/MemHandleBase.h"
 #include "BasicPool.h"
+#include "RingBufPool.h"
+#include "SegCache.h"
+#include "SizeClassPool.h"
+#include "PoolStats.h"
 
 namespace MemMgrLite {
 
@@ -46,15 +50,22 @@ void Manager::freeSeg(MemHandleBase& mh)
 {
 	MemPool* pool = findPool(mh.getPoolId());
 
-#ifdef USE_MEMMGR_RINGBUF_POOL
+#if defined(USE_MEMMGR_RINGBUF_POOL) || defined(CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL)
 	/* 仮想関数を使用しない方針なので、該当プール型にダウンキャストする */
 	switch (pool->getPoolType()) {
 	case BasicType:
 		static_cast<BasicPool*>(pool)->freeSeg(mh);
 		break;
+#ifdef USE_MEMMGR_RINGBUF_POOL
 	case RingBufType:
 		static_cast<RingBufPool*>(pool)->freeSeg(mh);
 		break;
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+	case SizeClassType:
+		static_cast<SizeClassPool*>(pool)->freeSeg(mh);
+		break;
+#endif
 	default:
 		D_ASSERT(false);
 		break;
@@ -70,6 +81,11 @@ void Manager::freeSeg(MemHandleBase& mh)
  *****************************************************************/
 void BasicPool::freeSeg(MemHandleBase& mh)
 {
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+	if (!up_interrupt_context() && MemPool::freeSegCached(mh)) {
+		return;
+	}
+#endif
 	ScopedLock lock;
 	MemPool::freeSeg(mh);
 }
@@ -84,17 +100,72 @@ void MemPool::freeSeg(MemHandleBase& mh)
 	D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
 	D_ASSERT(m_ref_cnt_array[seg_no - 1] != 0);	/* 使用中のはず */
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+	/* Cached frees subtract the counter without the pool lock */
+	if (atomicDecRefCnt(&m_ref_cnt_array[seg_no - 1]) == 0) {
+#else
 	--m_ref_cnt_array[seg_no - 1];
 	if (m_ref_cnt_array[seg_no - 1] == 0) {
+#endif
 		D_ASSERT(m_seg_no_que.full() == false);
 #ifdef USE_MEMMGR_SEG_DELETER
 //		notifyFreeSeg(mh);
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+		noteSegFree(seg_no);
 #endif
 		(void)m_seg_no_que.push(seg_no);
 	}
 	mh.clear();	/* メモリハンドルを初期状態に戻す */
 }
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+/*****************************************************************
+ * Subtract the reference counter atomically, and return the segment
+ * to the cache of the running CPU when there is no reference.
+ * When the cache is full, flush a batch to the pool.
+ * The attachment is checked with preemption disabled, so that
+ * attach/detach from another task cannot change it meanwhile.
+ *****************************************************************/
+bool MemPool::freeSegCached(MemHandleBase& mh)
+{
+	PreemptLock lock;
+	if (!isSegCacheAttached()) {
+		return false;
+	}
+
+	NumSeg seg_no = mh.getSegNo();
+	D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
+	D_ASSERT(m_ref_cnt_array[seg_no - 1] != 0);	/* It should be in use. */
+
+	mh.clear();
+	if (atomicDecRefCnt(&m_ref_cnt_array[seg_no - 1]) != 0) {
+		return true;
+	}
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+	noteSegFree(seg_no);
+#endif
+
+	SegMagazine& mag = m_seg_cache->getMagazine();
+
+	if (mag.full()) {
+		++mag.free_misses;
+		++mag.flushes;
+
+		/* Flush under the pool lock */
+		ScopedLock pool_lock;
+		while (mag.count > SEG_CACHE_BATCH) {
+			D_ASSERT(m_seg_no_que.full() == false);
+			(void)m_seg_no_que.push(mag.pop());
+		}
+	} else {
+		++mag.free_hits;
+	}
+	mag.push(seg_no);
+	return true;
+}
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE */
+
 } /* end of namespace MemMgrLite */
 
 /* freeSeg.cxx */
@@ -0,0 +1,136 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/getPoolStats.cpp
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <string.h>
+#include "ScopedLock.h"
+#include "memutils/memory_manager/Manager.h"
+#include "PoolStats.h"
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Get statistics of a pool
+ *****************************************************************/
+err_t Manager::getPoolStats(PoolId id, PoolStats* stats)
+{
+  if (stats == NULL)
+    {
+      return ERR_ARG;
+    }
+
+  findPool(id)->getPoolStats(*stats);
+
+  return ERR_OK;
+}
+
+/*****************************************************************
+ * Get statistics of the static pools of a section.
+ * Nothing is stored before the layout is created.
+ *****************************************************************/
+uint32_t Manager::getStaticPoolsStats(uint8_t sec, PoolStats* stats, uint32_t num_stats)
+{
+  D_ASSERT(stats && num_stats);
+
+  if (theManager == NULL || !isStaticPoolAvailable(sec))
+    {
+      return 0;
+    }
+
+  uint32_t n = 0;
+
+  /* Pool ID 0 is reserved */
+  for (uint8_t id = 1; id < theManager->m_pool_num[sec] && n < num_stats; ++id)
+    {
+      MemPool* pool = theManager->m_static_pools[sec][id];
+      if (pool)
+        {
+          pool->getPoolStats(stats[n++]);
+        }
+    }
+
+  return n;
+}
+
+/*****************************************************************
+ * Reset statistics of a pool
+ *****************************************************************/
+void Manager::resetPoolStats(PoolId id)
+{
+  findPool(id)->resetPoolStats();
+}
+
+/*****************************************************************
+ * Copy the counters of the pool
+ *****************************************************************/
+void MemPool::getPoolStats(PoolStats& stats) const
+{
+  PoolCounters cnt;
+  {
+    ScopedLock lock;
+    cnt = m_counters;
+  }
+
+  stats.id             = getPoolId();
+  stats.type           = getPoolType();
+  stats.num_segs       = getPoolNumSegs();
+  stats.used_segs      = cnt.used_segs;
+  stats.max_used_segs  = cnt.max_used_segs;
+  stats.min_avail_segs = static_cast<NumSeg>(getPoolNumSegs() - cnt.max_used_segs);
+  stats.alloc_count    = cnt.alloc_count;
+  stats.free_count     = cnt.free_count;
+  stats.alloc_fails    = cnt.alloc_fails;
+  stats.max_hold_us    = cnt.max_hold_us;
+}
+
+/*****************************************************************
+ * Clear the counters. The segments in use stay counted.
+ *****************************************************************/
+void MemPool::resetPoolStats()
+{
+  ScopedLock lock;
+
+  NumSeg used = m_counters.used_segs;
+  memset(&m_counters, 0x00, sizeof(m_counters));
+  m_counters.used_segs     = used;
+  m_counters.max_used_segs = used;
+}
+
+} /* namespace MemMgrLite */
+
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS */
+
+/* getPoolStats.cxx */
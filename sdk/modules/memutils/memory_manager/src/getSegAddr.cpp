@@ -35,6 +35,8 @@
 
 #include "memutils/memory_manager/MemHandleBase.h"
 #include "BasicPool.h"
+#include "RingBufPool.h"
+#include "SizeClassPool.h"
 
 namespace MemMgrLite {
 
@@ -45,13 +47,19 @@ PoolAddr Manager::getSegAddr(const MemHandleBase& mh)
 {
 	MemPool* pool = findPool(mh.getPoolId());
 
-#ifdef USE_MEMMGR_RINGBUF_POOL
+#if defined(USE_MEMMGR_RINGBUF_POOL) || defined(CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL)
 	/* 仮想関数を使用しない方針なので、該当プール型にダウンキャストする */
 	switch (pool->getPoolType()) {
 	case BasicType:
 		return static_cast<BasicPool*>(pool)->getSegAddr(mh);
+#ifdef USE_MEMMGR_RINGBUF_POOL
 	case RingBufType:
 		return static_cast<RingBufPool*>(pool)->getSegAddr(mh);
+#endif
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+	case SizeClassType:
+		return static_cast<SizeClassPool*>(pool)->getSegAddr(mh);
+#endif
 	default:
 		D_ASSERT(false);
 		return BadPoolAddr;
@@ -35,6 +35,7 @@
 
 #include "ScopedLock.h"
 #include "memutils/memory_manager/MemHandleBase.h"
+#include "SegCache.h"
 
 namespace MemMgrLite {
 
@@ -63,9 +64,18 @@ void MemPool::incSegRefCnt(NumSeg seg_no)
 	NumSeg ref_idx = seg_no - 1;
 	D_ASSERT(m_ref_cnt_array[ref_idx] != 0);	/* 使用中のはず */
 
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+	/* Cached frees subtract the counter without the pool lock,
+	 * so always add it atomically, whether a cache is attached or not.
+	 */
+	SegRefCnt cnt = atomicIncRefCnt(&m_ref_cnt_array[ref_idx]);
+	D_ASSERT(cnt != 0);	/* ラップチェック */
+	(void)cnt;
+#else
 	ScopedLock lock;
 	++m_ref_cnt_array[ref_idx];
 	D_ASSERT(m_ref_cnt_array[ref_idx] != 0);	/* ラップチェック */
+#endif
 }
 
 } /* end of namespace MemMgrLite */
@@ -0,0 +1,301 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/ringBufPool.cpp
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "FastMemAlloc.h"
+#include "ScopedLock.h"
+#include "memutils/memory_manager/MemHandleBase.h"
+#include "BasicPool.h"
+#include "RingBufPool.h"
+#include "PoolStats.h"
+
+#ifdef USE_MEMMGR_RINGBUF_POOL
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Get the largest size which can be reserved now
+ *****************************************************************/
+PoolSize Manager::getRingBufPoolFreeSize(PoolId id)
+{
+  MemPool* pool = findPool(id);
+  D_ASSERT(pool->getPoolType() == RingBufType);
+
+  ScopedLock lock;
+  return static_cast<RingBufPool*>(pool)->getFreeSize();
+}
+
+/*****************************************************************
+ * Fix the used size of a memory segment
+ *****************************************************************/
+err_t Manager::commitSeg(const MemHandleBase& mh, size_t size)
+{
+  MemPool* pool = findPool(mh.getPoolId());
+
+  switch (pool->getPoolType()) {
+  case RingBufType:
+    return static_cast<RingBufPool*>(pool)->commitSeg(mh, size);
+  default:
+    return (size <= getSegSize(mh)) ? ERR_OK : ERR_DATA_SIZE;
+  }
+}
+
+/*****************************************************************
+ * Constructor
+ *****************************************************************/
+RingBufPool::RingBufPool(const PoolSectionAttr& attr, FastMemAlloc& fma) :
+  MemPool(attr, fma),
+  m_order_que(fma.alloc(sizeof(NumSeg) * attr.num_segs, sizeof(NumSeg)), attr.num_segs),
+  m_desc(static_cast<SegDesc*>(fma.alloc(sizeof(SegDesc) * attr.num_segs, sizeof(uint32_t)))),
+  m_head(0),
+  m_tail(0)
+{
+#ifdef USE_MEMMGR_DEBUG_OUTPUT
+  printf("RingBufPool: created. [fma.rest=%08x] ", fma.rest());
+  attr.printInfo();
+#endif
+}
+
+/*****************************************************************
+ * Destructor
+ *****************************************************************/
+RingBufPool::~RingBufPool()
+{
+#ifdef USE_MEMMGR_DEBUG_OUTPUT
+  printf("~RingBufPool: PoolId=%d\n", getPoolId());
+#endif
+}
+
+/*****************************************************************
+ * Largest contiguous free size
+ * 排他制御は呼出し側で行うこと
+ *****************************************************************/
+PoolSize RingBufPool::getFreeSize() const
+{
+  if (m_seg_no_que.empty()) {
+    return 0;
+  }
+
+  if (m_order_que.empty()) {
+    return getPoolSize();
+  }
+
+  if (m_tail > m_head) {
+    /* Not wrapped. Free at the end and before the head. */
+
+    PoolSize end = getPoolSize() - m_tail;
+    return (end > m_head) ? end : m_head;
+  }
+
+  /* Wrapped. Free between the tail and the head. */
+
+  return m_head - m_tail;
+}
+
+/*****************************************************************
+ * Reserve a contiguous segment
+ *****************************************************************/
+err_t RingBufPool::allocSeg(size_t size_for_check, MemHandleProxy &proxy)
+{
+  PoolSize need = roundSize(size_for_check);
+
+  if (need > getPoolSize())
+    {
+      return ERR_DATA_SIZE;
+    }
+
+  ScopedLock lock;
+
+  if (m_seg_no_que.empty())
+    {
+      proxy = 0;
+      return ERR_MEM_EMPTY;
+    }
+
+  if (m_order_que.empty())
+    {
+      /* Restart from the top to get the largest contiguous area. */
+
+      m_head = 0;
+      m_tail = 0;
+    }
+
+  PoolSize offset;
+
+  if (m_order_que.empty() || m_tail > m_head)
+    {
+      if (getPoolSize() - m_tail >= need)
+        {
+          offset = m_tail;
+        }
+      else if (m_head >= need)
+        {
+          offset = 0;  /* Wrap around. The end of the area is skipped. */
+        }
+      else
+        {
+          proxy = 0;
+          return ERR_MEM_EMPTY;
+        }
+    }
+  else
+    {
+      if (m_head - m_tail >= need)
+        {
+          offset = m_tail;
+        }
+      else
+        {
+          proxy = 0;
+          return ERR_MEM_EMPTY;
+        }
+    }
+
+  NumSeg seg_no = m_seg_no_que.top();
+  m_seg_no_que.pop();
+
+  m_desc[seg_no - 1].offset = offset;
+  m_desc[seg_no - 1].size   = need;
+  m_tail = offset + need;
+  (void)m_order_que.push(seg_no);
+
+  D_ASSERT(m_ref_cnt_array[seg_no - 1] == 0);  /* It should be unused. */
+  m_ref_cnt_array[seg_no - 1] = 1;
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  noteSegAlloc(seg_no);
+#endif
+
+  proxy = MemHandleBase::makeMemHandleProxy(getPoolId(), seg_no, 0);
+
+  return ERR_OK;
+}
+
+/*****************************************************************
+ * Fix the used size. If the segment is the newest one,
+ * the unused part is given back for the next reservation.
+ *****************************************************************/
+err_t RingBufPool::commitSeg(const MemHandleBase& mh, size_t size)
+{
+  NumSeg seg_no = mh.getSegNo();
+  D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
+
+  PoolSize need = roundSize(size);
+
+  ScopedLock lock;
+
+  SegDesc& desc = m_desc[seg_no - 1];
+  if (need > desc.size)
+    {
+      return ERR_DATA_SIZE;
+    }
+
+  desc.size = need;
+  if (m_order_que.back() == seg_no)
+    {
+      m_tail = desc.offset + need;
+    }
+
+  return ERR_OK;
+}
+
+/*****************************************************************
+ * Return the released segments at the head of the ring
+ * 排他制御は呼出し側で行うこと
+ *****************************************************************/
+void RingBufPool::releaseHead()
+{
+  while (!m_order_que.empty() && m_ref_cnt_array[m_order_que.top() - 1] == 0) {
+    D_ASSERT(m_seg_no_que.full() == false);
+    (void)m_seg_no_que.push(m_order_que.top());
+    m_order_que.pop();
+  }
+
+  if (m_order_que.empty()) {
+    m_head = 0;
+    m_tail = 0;
+  } else {
+    m_head = m_desc[m_order_que.top() - 1].offset;
+  }
+}
+
+/*****************************************************************
+ * Subtract the reference counter. The area is reused when all the
+ * older segments are also freed.
+ *****************************************************************/
+void RingBufPool::freeSeg(MemHandleBase& mh)
+{
+  NumSeg seg_no = mh.getSegNo();
+  D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
+
+  ScopedLock lock;
+
+  D_ASSERT(m_ref_cnt_array[seg_no - 1] != 0);  /* It should be in use. */
+  if (--m_ref_cnt_array[seg_no - 1] == 0) {
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+    noteSegFree(seg_no);
+#endif
+    if (m_order_que.top() == seg_no) {
+      releaseHead();
+    }
+  }
+  mh.clear();
+}
+
+/*****************************************************************
+ * Get the segment address
+ *****************************************************************/
+PoolAddr RingBufPool::getSegAddr(const MemHandleBase& mh) const
+{
+  NumSeg seg_no = mh.getSegNo();
+  D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
+
+  return getPoolAddr() + m_desc[seg_no - 1].offset;
+}
+
+/*****************************************************************
+ * Get the segment size
+ *****************************************************************/
+PoolSize RingBufPool::getSegSize(const MemHandleBase& mh) const
+{
+  NumSeg seg_no = mh.getSegNo();
+  D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
+
+  return m_desc[seg_no - 1].size;
+}
+
+} /* end of namespace MemMgrLite */
+
+#endif /* USE_MEMMGR_RINGBUF_POOL */
+
+/* ringBufPool.cxx */
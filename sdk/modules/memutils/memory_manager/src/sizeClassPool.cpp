@@ -0,0 +1,277 @@
+/****************************************************************************
+ * modules/memutils/memory_manager/src/sizeClassPool.cpp
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <new>
+#include "FastMemAlloc.h"
+#include "ScopedLock.h"
+#include "memutils/memory_manager/MemHandleBase.h"
+#include "BasicPool.h"
+#include "SizeClassPool.h"
+#include "PoolStats.h"
+
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL
+
+namespace MemMgrLite {
+
+/*****************************************************************
+ * Create a size-class memory pool object
+ *****************************************************************/
+MemPool* Manager::createSizeClassPool(const PoolSectionAttr& attr,
+                                      const SizeClassAttr* classes,
+                                      uint8_t num_classes, FastMemAlloc& fma)
+{
+  SizeClassPool* pool = new(fma, sizeof(uint32_t))
+    SizeClassPool(attr, classes, num_classes, fma);
+
+  if (pool && pool->isFailed()) {
+    pool = NULL;
+  }
+  return pool;
+}
+
+/*****************************************************************
+ * Work area size of a size-class pool
+ *****************************************************************/
+uint32_t SizeClassPool::getWorkSize(NumSeg num_segs, uint8_t num_classes)
+{
+  /* Pool object, reference counter, class table, class queues and
+   * their data area. Add the alignment margin for each allocation.
+   * The segment number queue of MemPool is not used.
+   */
+
+  return sizeof(SizeClassPool) + sizeof(uint32_t) +
+         sizeof(SegRefCnt) * num_segs +
+         sizeof(SegClass) * num_classes + sizeof(uint32_t) +
+         sizeof(SegNoQue) * num_classes + sizeof(uint32_t) +
+         sizeof(NumSeg) * num_segs + sizeof(NumSeg) * num_classes;
+}
+
+/*****************************************************************
+ * Constructor
+ *****************************************************************/
+SizeClassPool::SizeClassPool(const PoolSectionAttr& attr,
+                             const SizeClassAttr* classes,
+                             uint8_t num_classes, FastMemAlloc& fma) :
+  MemPool(attr, fma, false),
+  m_num_classes(num_classes),
+  m_avail_mask(0),
+  m_classes(static_cast<SegClass*>(fma.alloc(sizeof(SegClass) * num_classes, sizeof(uint32_t)))),
+  m_class_ques(static_cast<SegNoQue*>(fma.alloc(sizeof(SegNoQue) * num_classes, sizeof(uint32_t))))
+{
+  if (MemPool::isFailed() || m_classes == NULL || m_class_ques == NULL) {
+    m_classes = NULL;
+    return;
+  }
+
+  PoolAddr addr   = getPoolAddr();
+  NumSeg   seg_no = 1;
+
+  for (uint8_t i = 0; i < num_classes; ++i) {
+    SegClass& cls = m_classes[i];
+    cls.addr      = addr;
+    cls.seg_size  = MEMUTILS_ROUND_UP(classes[i].seg_size, sizeof(uint32_t));
+    cls.first_seg = seg_no;
+    cls.last_seg  = static_cast<NumSeg>(seg_no + classes[i].num_segs - 1);
+
+    void* que_area = fma.alloc(sizeof(NumSeg) * classes[i].num_segs, sizeof(NumSeg));
+    if (que_area == NULL) {
+      m_classes = NULL;
+      return;
+    }
+
+    SegNoQue* que = ::new(&m_class_ques[i]) SegNoQue(que_area, classes[i].num_segs);
+    for (NumSeg n = cls.first_seg; n <= cls.last_seg; ++n) {
+      (void)que->push(n);
+    }
+    m_avail_mask |= static_cast<uint8_t>(1 << i);
+
+    addr   += cls.seg_size * classes[i].num_segs;
+    seg_no  = static_cast<NumSeg>(cls.last_seg + 1);
+  }
+
+  D_ASSERT(addr - getPoolAddr() <= getPoolSize());
+  D_ASSERT(static_cast<NumSeg>(seg_no - 1) == getPoolNumSegs());
+
+#ifdef USE_MEMMGR_DEBUG_OUTPUT
+  printf("SizeClassPool: created. [fma.rest=%08x] ", fma.rest());
+  attr.printInfo();
+#endif
+}
+
+/*****************************************************************
+ * Destructor
+ * All the segments should be back in the class queues.
+ *****************************************************************/
+SizeClassPool::~SizeClassPool()
+{
+#ifdef USE_MEMMGR_DEBUG_OUTPUT
+  printf("~SizeClassPool: PoolId=%d\n", getPoolId());
+#endif
+  if (m_classes == NULL) {
+    return;
+  }
+
+  if (getPoolNumAvailSegs() != getPoolNumSegs()) {
+#ifdef USE_MEMMGR_DEBUG_OUTPUT
+    printf("~SizeClassPool: Segment leak found. PoolId=%d\n", getPoolId());
+#endif
+    F_ASSERT(0);	/* memory segment leaked */
+  }
+
+  for (uint8_t i = 0; i < m_num_classes; ++i) {
+    m_class_ques[i].~SegNoQue();
+  }
+}
+
+/*****************************************************************
+ * Find the class of a segment
+ *****************************************************************/
+uint8_t SizeClassPool::findClass(NumSeg seg_no) const
+{
+  D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
+
+  uint8_t i = 0;
+  while (seg_no > m_classes[i].last_seg) {
+    ++i;
+  }
+  return i;
+}
+
+/*****************************************************************
+ * Get a segment from the smallest class that fits and has a free one
+ *****************************************************************/
+err_t SizeClassPool::allocSeg(size_t size_for_check, MemHandleProxy &proxy)
+{
+  uint8_t first = 0;
+  while (first < m_num_classes && size_for_check > m_classes[first].seg_size) {
+    ++first;
+  }
+
+  if (first == m_num_classes)
+    {
+      return ERR_DATA_SIZE;
+    }
+
+  ScopedLock lock;
+
+  uint32_t mask = m_avail_mask & ~((1u << first) - 1);
+  if (mask == 0)
+    {
+      proxy = 0;
+      return ERR_MEM_EMPTY;
+    }
+
+  uint8_t   cls = static_cast<uint8_t>(__builtin_ctz(mask));
+  SegNoQue& que = m_class_ques[cls];
+
+  NumSeg seg_no = que.top();
+  que.pop();
+  if (que.empty()) {
+    m_avail_mask &= static_cast<uint8_t>(~(1 << cls));
+  }
+
+  D_ASSERT(m_ref_cnt_array[seg_no - 1] == 0);  /* It should be unused. */
+  m_ref_cnt_array[seg_no - 1] = 1;
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+  noteSegAlloc(seg_no);
+#endif
+
+  proxy = MemHandleBase::makeMemHandleProxy(getPoolId(), seg_no, 0);
+
+  return ERR_OK;
+}
+
+/*****************************************************************
+ * Subtract the reference counter and return the segment
+ * to its class if there is no reference.
+ *****************************************************************/
+void SizeClassPool::freeSeg(MemHandleBase& mh)
+{
+  NumSeg seg_no = mh.getSegNo();
+  D_ASSERT(seg_no != NullSegNo && seg_no <= getPoolNumSegs());
+
+  ScopedLock lock;
+
+  D_ASSERT(m_ref_cnt_array[seg_no - 1] != 0);  /* It should be in use. */
+  if (--m_ref_cnt_array[seg_no - 1] == 0) {
+#ifdef CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
+    noteSegFree(seg_no);
+#endif
+    uint8_t cls = findClass(seg_no);
+    D_ASSERT(m_class_ques[cls].full() == false);
+    (void)m_class_ques[cls].push(seg_no);
+    m_avail_mask |= static_cast<uint8_t>(1 << cls);
+  }
+  mh.clear();
+}
+
+/*****************************************************************
+ * Get the segment address
+ *****************************************************************/
+PoolAddr SizeClassPool::getSegAddr(const MemHandleBase& mh) const
+{
+  NumSeg seg_no = mh.getSegNo();
+  const SegClass& cls = m_classes[findClass(seg_no)];
+
+  return cls.addr + (seg_no - cls.first_seg) * cls.seg_size;
+}
+
+/*****************************************************************
+ * Get the segment size
+ *****************************************************************/
+PoolSize SizeClassPool::getSegSize(const MemHandleBase& mh) const
+{
+  return m_classes[findClass(mh.getSegNo())].seg_size;
+}
+
+/*****************************************************************
+ * Get the number of free segments of all classes
+ *****************************************************************/
+NumSeg MemPool::getSizeClassNumAvailSegs() const
+{
+  const SizeClassPool* pool = static_cast<const SizeClassPool*>(this);
+
+  uint32_t n = 0;
+  for (uint8_t i = 0; i < pool->m_num_classes; ++i) {
+    n += pool->m_class_ques[i].size();
+  }
+  return static_cast<NumSeg>(n);
+}
+
+} /* end of namespace MemMgrLite */
+
+#endif /* CONFIG_MEMUTILS_MEMORY_MANAGER_SIZE_CLASS_POOL */
+
+/* sizeClassPool.cxx */
@@ -52,6 +52,8 @@ UseSegDeleter       = false
 UseSegThreshold     = false
 UseRingBufPool      = false
 UseRingBufThreshold = false
+UseSegCache         = false  # Set true with CONFIG_MEMUTILS_MEMORY_MANAGER_SEG_CACHE
+UsePoolStats        = false  # Set true with CONFIG_MEMUTILS_MEMORY_MANAGER_POOL_STATS
 
 #####################################################################
 # Fixed parameters of pool layout
@@ -418,16 +420,25 @@ end
 #  - Alignment adjustment of MemPool area         : 0-3
 #  - Pool attribute area(Usually in static pool 0): 0, 12 or 16
 #  - BasicPool(=MemPool) area                      : 12 + 4 * sizeof(NumSeg)
-#  - RingBufPool area                              : To be determined(MemPool Area+alpha)
+#                                                    (+ 4 with segment cache)
+#                                                    (+ 24 with pool statistics)
+#  - RingBufPool area                              : MemPool area + 20
+#                                                    + 8 + sizeof(NumSeg) per segment
 #  - Data area of the segment number queue         : Number of segments * sizeof(NumSeg)
 #  - Reference counter area                        : Number of segments * sizeof(SegRefCnt)
+#  - Allocation time area(With pool statistics)    : Number of segments * 4
+# Segment caches are per CPU of one SMP kernel. Other cores sharing the
+# pools would all use the cache of CPU 0.
+abort("UseSegCache can't be used with UseMultiCore.") if UseSegCache and UseMultiCore
+
 NumSegSize              = UseOver255Segments ? 2 : 1
 SegRefCntSize           = 1
 PoolAttrSize            = round_up(10 + NumSegSize + (UseFence ? 1 : 0) + (UseMultiCore ? 1 : 0), 4)
-MemPoolDataSize         = 12 + 4 * NumSegSize   # 16 or 20
+MemPoolDataSize         = 12 + 4 * NumSegSize + (UseSegCache ? 4 : 0) + (UsePoolStats ? 24 : 0)
+PoolStatsSegDataSize    = 4                     # Allocation time of the segment
 BasicPoolDataSize       = MemPoolDataSize
-RingBufPoolDataSize     = MemPoolDataSize + 32  # Tentative value for details unexamined
-RingBufPoolSegDataSize  = 8                     # Tentative value for details unexamined
+RingBufPoolDataSize     = MemPoolDataSize + 20  # Order queue, descriptor pointer, head and tail
+RingBufPoolSegDataSize  = 8 + NumSegSize        # Descriptor and order queue entry
 
 #######################################################################
 class PoolLayout
@@ -463,6 +474,8 @@ class PoolLayout
       pool_work_size += (pool.type == Basic) ? BasicPoolDataSize : RingBufPoolDataSize
       pool_work_size += pool.num_seg * NumSegSize    # Data area of the segment number queue
       pool_work_size += pool.num_seg * SegRefCntSize # Reference counter area
+      pool_work_size += pool.num_seg * PoolStatsSegDataSize + MinAlign if UsePoolStats
+      pool_work_size += pool.num_seg * RingBufPoolSegDataSize + MinAlign if pool.type == RingBuf
       # Round up to the MinAlign unit and integrate
       layout_work_size += round_up(pool_work_size, MinAlign)
     end
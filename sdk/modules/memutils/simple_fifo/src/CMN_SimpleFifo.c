@@ -176,6 +176,63 @@ static size_t peek(
     return sz;
 }
 
+/*!
+ * @brief Internal reserve implementation. Counterpart of peek() for
+ *        the vacant region.
+ */
+static size_t reserve(
+        const CMN_SimpleFifoHandle* pHandle0,
+        PeekHandleInternal* pPeekHandle,
+        size_t sz) {
+    assert(pHandle0 != NULL);
+    assert(pPeekHandle != NULL);
+
+    volatile const CMN_SimpleFifoHandle* pHandle = pHandle0;
+    const size_t rp = pHandle->m_rp;
+    const size_t wp = pHandle->m_wp;
+    const size_t bufsz = pHandle->m_size;
+
+    pPeekHandle->m_idxChunk[0] = pPeekHandle->m_idxChunk[1] = 0;
+    pPeekHandle->m_szChunk[0] = pPeekHandle->m_szChunk[1] = 0;
+    pPeekHandle->m_newRp = rp;
+    if (getVacantSize(bufsz, wp, rp) < sz) {
+        // no enough space
+        return 0;
+    }
+    if (wp < rp) {
+        pPeekHandle->m_idxChunk[0] = wp;
+        pPeekHandle->m_szChunk[0] = sz;
+    } else {
+        size_t szRegion1 = bufsz - wp;
+        if (sz < szRegion1) {
+            szRegion1 = sz;
+        }
+        pPeekHandle->m_idxChunk[0] = wp;
+        pPeekHandle->m_szChunk[0] = szRegion1;
+        if (szRegion1 < sz) {
+            pPeekHandle->m_idxChunk[1] = 0;
+            pPeekHandle->m_szChunk[1] = sz - szRegion1;
+        }
+    }
+    return sz;
+}
+
+/*!
+ * @brief Copy PeekHandleInternal to the client's handle.
+ */
+static void exportPeekHandle(
+        volatile const CMN_SimpleFifoHandle* pHandle,
+        const PeekHandleInternal* pInternal,
+        CMN_SimpleFifoPeekHandle* pPeekHandle) {
+    int i = 0;
+    for (i = 0; i < 2; ++i) {
+        pPeekHandle->m_szChunk[i] = pInternal->m_szChunk[i];
+        pPeekHandle->m_pChunk[i] =
+            pInternal->m_szChunk[i] <= 0 ?
+            NULL : &pHandle->m_pBuf[pInternal->m_idxChunk[i]];
+    }
+}
+
 /*!
  * @brief Alignment size.
  */
@@ -417,14 +474,7 @@ size_t CMN_SimpleFifoPeekWithOffset(
             }
             ret -= offset;
         }
-        pPeekHandle->m_szChunk[0] = peekHandle.m_szChunk[0];
-        pPeekHandle->m_pChunk[0] =
-            peekHandle.m_szChunk[0] <= 0 ?
-            NULL : &pHandle->m_pBuf[peekHandle.m_idxChunk[0]];
-        pPeekHandle->m_szChunk[1] = peekHandle.m_szChunk[1];
-        pPeekHandle->m_pChunk[1] =
-            peekHandle.m_szChunk[1] <= 0 ?
-            NULL : &pHandle->m_pBuf[peekHandle.m_idxChunk[1]];
+        exportPeekHandle(pHandle, &peekHandle, pPeekHandle);
     } else {
         pPeekHandle->m_szChunk[0] = 0;
         pPeekHandle->m_pChunk[0] = NULL;
@@ -434,6 +484,62 @@ size_t CMN_SimpleFifoPeekWithOffset(
     return ret;
 }
 
+size_t CMN_SimpleFifoRelease(
+        CMN_SimpleFifoHandle* pHandle0,
+        size_t sz) {
+    assert(pHandle0 != NULL);
+
+    volatile CMN_SimpleFifoHandle* pHandle = pHandle0;
+    PeekHandleInternal peekHandle;
+    size_t ret = peek(pHandle0, &peekHandle, sz);
+    if (ret) {
+        // the reader must finish with the region before it is reused.
+        __DMB();
+        pHandle->m_rp = peekHandle.m_newRp;
+        __DSB();
+    }
+    return ret;
+}
+
+size_t CMN_SimpleFifoReserve(
+        const CMN_SimpleFifoHandle* pHandle0,
+        CMN_SimpleFifoPeekHandle* pReserveHandle,
+        size_t sz) {
+    assert(pHandle0 != NULL);
+    assert(pReserveHandle != NULL);
+
+    volatile const CMN_SimpleFifoHandle* pHandle = pHandle0;
+    PeekHandleInternal reserveHandle;
+    size_t ret = reserve(pHandle0, &reserveHandle, sz);
+    exportPeekHandle(pHandle, &reserveHandle, pReserveHandle);
+    return ret;
+}
+
+size_t CMN_SimpleFifoCommit(
+        CMN_SimpleFifoHandle* pHandle0,
+        size_t sz) {
+    assert(pHandle0 != NULL);
+
+    volatile CMN_SimpleFifoHandle* pHandle = pHandle0;
+    const size_t rp = pHandle->m_rp;
+    const size_t wp = pHandle->m_wp;
+    const size_t bufsz = pHandle->m_size;
+    size_t newWp = wp;
+
+    if (sz == 0 || getVacantSize(bufsz, wp, rp) < sz) {
+        return 0;
+    }
+    newWp = wp + sz;
+    if (bufsz <= newWp) {
+        newWp -= bufsz;
+    }
+    // the written data must be visible before the new WP.
+    __DMB();
+    pHandle->m_wp = newWp;
+    __DSB();
+    return sz;
+}
+
 /*
 size_t CMN_SimpleFifoPeek(
         const CMN_SimpleFifoHandle* pHandle0,
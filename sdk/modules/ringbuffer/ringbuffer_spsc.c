@@ -0,0 +1,613 @@
+/****************************************************************************
+ * modules/ringbuffer/ringbuffer_spsc.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include "ringbuffer/ringbuffer_spsc.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_DEBUG_RINGBUFFER
+#  define ringbuffer_debug(x, ...) printf("%s "x, __func__, ##__VA_ARGS__)
+#else
+#  define ringbuffer_debug(x, ...)
+#endif
+
+#ifndef MIN
+#  define MIN(a,b)  (((a) < (b)) ? (a) : (b))
+#endif
+
+/* The reader and the writer exchange head/tail and the wait flags with
+ * sequentially consistent accesses. A side going to sleep sets its flag
+ * and checks the buffer again, and the other side publishes its counter
+ * and checks the flag, so one of them always sees the other.
+ */
+
+#define RB_LOAD(p)      __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define RB_STORE(p, v)  __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define RB_XCHG(p, v)   __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ringbuf_spsc_used
+ ****************************************************************************/
+
+static inline size_t ringbuf_spsc_used(FAR struct ringbuf_spsc_s *rb)
+{
+  /* head and tail are free-running counters. The difference is
+   * correct even after they wrap around.
+   */
+
+  return RB_LOAD(&rb->tail) - RB_LOAD(&rb->head);
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_abstime
+ ****************************************************************************/
+
+static void ringbuf_spsc_abstime(int timeout, FAR struct timespec *abstime)
+{
+  clock_gettime(CLOCK_REALTIME, abstime);
+
+  abstime->tv_sec  += timeout / 1000;
+  abstime->tv_nsec += (timeout % 1000) * 1000000;
+  if (abstime->tv_nsec >= 1000000000)
+    {
+      abstime->tv_sec++;
+      abstime->tv_nsec -= 1000000000;
+    }
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_wait
+ *
+ * Description:
+ *   Sleep until the other side posts the semaphore.
+ *   Returns 0 on wake up (including spurious one) or -ETIMEDOUT.
+ *
+ ****************************************************************************/
+
+static int ringbuf_spsc_wait(FAR sem_t *sem, int timeout,
+                             FAR const struct timespec *abstime)
+{
+  int ret;
+
+  if (timeout < 0)
+    {
+      ret = sem_wait(sem);
+    }
+  else
+    {
+      ret = sem_timedwait(sem, abstime);
+    }
+
+  if (ret < 0 && errno == ETIMEDOUT)
+    {
+      return -ETIMEDOUT;
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_wakeup
+ ****************************************************************************/
+
+static inline void ringbuf_spsc_wakeup(FAR sem_t *sem,
+                                       FAR volatile int *waiting)
+{
+  if (RB_XCHG(waiting, 0))
+    {
+      sem_post(sem);
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ringbuf_spsc_new
+ *
+ * Description:
+ *   Allocates a new SPSC Ring Buffer.
+ *
+ * Input Parameters:
+ *   size  Size of Ring Buffer to allocate. Rounded up to a power of two.
+ *
+ * Returned Value:
+ *   On success, the allocated Ring Buffer is returned.
+ *   On failure, NULL is returned.
+ *
+ ****************************************************************************/
+
+FAR struct ringbuf_spsc_s *ringbuf_spsc_new(size_t size)
+{
+  FAR struct ringbuf_spsc_s *rb;
+  size_t pow2 = 1;
+
+  if (size == 0 || size > (((size_t)-1 >> 1) + 1))
+    {
+      return NULL;
+    }
+
+  while (pow2 < size)
+    {
+      pow2 <<= 1;
+    }
+
+  rb = (FAR struct ringbuf_spsc_s *)malloc(sizeof(struct ringbuf_spsc_s));
+  if (rb)
+    {
+      rb->buf = (FAR uint8_t *)calloc(1, pow2);
+      if (rb->buf)
+        {
+          rb->size  = pow2;
+          rb->mask  = pow2 - 1;
+          rb->head  = 0;
+          rb->tail  = 0;
+          rb->rwait = 0;
+          rb->wwait = 0;
+          sem_init(&rb->rsem, 0, 0);
+          sem_init(&rb->wsem, 0, 0);
+
+          ringbuffer_debug("buf:%p size:%d\n", rb->buf, rb->size);
+        }
+      else
+        {
+          free(rb);
+          rb = NULL;
+        }
+    }
+
+  return rb;
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_free
+ *
+ * Description:
+ *   Release a SPSC Ring Buffer.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer to release.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void ringbuf_spsc_free(FAR struct ringbuf_spsc_s *rb)
+{
+  if (rb && rb->buf)
+    {
+      sem_destroy(&rb->rsem);
+      sem_destroy(&rb->wsem);
+      free(rb->buf);
+      free(rb);
+    }
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_read
+ *
+ * Description:
+ *   Read from a SPSC Ring Buffer. Called by the reader only.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer to read.
+ *   buf  Pointer to buffer to store data that read from a Ring Buffer.
+ *   count  Bytes to read.
+ *   timeout  Time to wait in milliseconds. (0: no wait, <0: forever)
+ *
+ * Returned Value:
+ *   On success, The number of bytes read.
+ *   On failure, negative value is returned according to <errno.h>.
+ *
+ ****************************************************************************/
+
+ssize_t ringbuf_spsc_read(FAR struct ringbuf_spsc_s *rb, FAR void *buf,
+                          size_t count, int timeout)
+{
+  struct timespec abstime;
+  size_t used;
+  size_t offset;
+  size_t first;
+
+  if (!rb || (!buf && count))
+    {
+      return -EINVAL;
+    }
+
+  if (!count)
+    {
+      return count;
+    }
+
+  if (timeout > 0)
+    {
+      ringbuf_spsc_abstime(timeout, &abstime);
+    }
+
+  while ((used = ringbuf_spsc_used(rb)) == 0)
+    {
+      if (timeout == 0)
+        {
+          return -EAGAIN;
+        }
+
+      RB_STORE(&rb->rwait, 1);
+
+      /* Check again because the writer may have written data
+       * before it saw the flag.
+       */
+
+      if (ringbuf_spsc_used(rb))
+        {
+          RB_STORE(&rb->rwait, 0);
+          continue;
+        }
+
+      if (ringbuf_spsc_wait(&rb->rsem, timeout, &abstime) < 0)
+        {
+          RB_STORE(&rb->rwait, 0);
+          return -ETIMEDOUT;
+        }
+    }
+
+  count  = MIN(used, count);
+  offset = rb->head & rb->mask;
+  first  = MIN(count, rb->size - offset);
+
+  memcpy(buf, rb->buf + offset, first);
+  memcpy((FAR uint8_t *)buf + first, rb->buf, count - first);
+
+  RB_STORE(&rb->head, rb->head + count);
+  ringbuf_spsc_wakeup(&rb->wsem, &rb->wwait);
+
+  ringbuffer_debug("head:%d tail:%d count:%d\n", rb->head, rb->tail, count);
+
+  return count;
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_write
+ *
+ * Description:
+ *   Write to a SPSC Ring Buffer. Called by the writer only.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer to write.
+ *   buf  Pointer to buffer to stored data that write to a Ring Buffer.
+ *   count  Bytes to write.
+ *   timeout  Time to wait in milliseconds. (0: no wait, <0: forever)
+ *
+ * Returned Value:
+ *   On success, The number of bytes written.
+ *   On failure, negative value is returned according to <errno.h>.
+ *
+ ****************************************************************************/
+
+ssize_t ringbuf_spsc_write(FAR struct ringbuf_spsc_s *rb,
+                           FAR const void *buf, size_t count, int timeout)
+{
+  struct timespec abstime;
+  size_t offset;
+  size_t first;
+
+  if (!rb || (!buf && count))
+    {
+      return -EINVAL;
+    }
+
+  if (count > rb->size)
+    {
+      return -ENOSPC;
+    }
+
+  if (!count)
+    {
+      return count;
+    }
+
+  if (timeout > 0)
+    {
+      ringbuf_spsc_abstime(timeout, &abstime);
+    }
+
+  while (rb->size - ringbuf_spsc_used(rb) < count)
+    {
+      if (timeout == 0)
+        {
+          return -ENOSPC;
+        }
+
+      RB_STORE(&rb->wwait, 1);
+
+      /* Check again because the reader may have read data
+       * before it saw the flag.
+       */
+
+      if (rb->size - ringbuf_spsc_used(rb) >= count)
+        {
+          RB_STORE(&rb->wwait, 0);
+          break;
+        }
+
+      if (ringbuf_spsc_wait(&rb->wsem, timeout, &abstime) < 0)
+        {
+          RB_STORE(&rb->wwait, 0);
+          return -ETIMEDOUT;
+        }
+    }
+
+  offset = rb->tail & rb->mask;
+  first  = MIN(count, rb->size - offset);
+
+  memcpy(rb->buf + offset, buf, first);
+  memcpy(rb->buf, (FAR const uint8_t *)buf + first, count - first);
+
+  RB_STORE(&rb->tail, rb->tail + count);
+  ringbuf_spsc_wakeup(&rb->rsem, &rb->rwait);
+
+  ringbuffer_debug("head:%d tail:%d count:%d\n", rb->head, rb->tail, count);
+
+  return count;
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_write_acquire
+ *
+ * Description:
+ *   Gets the continuous free region from the tail. Called by the writer
+ *   only.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer.
+ *   ptr  Address of the free region.
+ *
+ * Returned Value:
+ *   The number of bytes of the free region.
+ *
+ ****************************************************************************/
+
+size_t ringbuf_spsc_write_acquire(FAR struct ringbuf_spsc_s *rb,
+                                  FAR uint8_t **ptr)
+{
+  size_t offset;
+  size_t avail;
+
+  if (!rb || !ptr)
+    {
+      return 0;
+    }
+
+  offset = rb->tail & rb->mask;
+  avail  = rb->size - ringbuf_spsc_used(rb);
+  *ptr   = rb->buf + offset;
+
+  return MIN(avail, rb->size - offset);
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_write_release
+ *
+ * Description:
+ *   Makes data written to the acquired region readable. Called by the
+ *   writer only.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer.
+ *   count  Bytes written.
+ *
+ * Returned Value:
+ *   On success, count is returned.
+ *   On failure, negative value is returned according to <errno.h>.
+ *
+ ****************************************************************************/
+
+ssize_t ringbuf_spsc_write_release(FAR struct ringbuf_spsc_s *rb,
+                                   size_t count)
+{
+  if (!rb)
+    {
+      return -EINVAL;
+    }
+
+  if (rb->size - ringbuf_spsc_used(rb) < count)
+    {
+      return -ENOSPC;
+    }
+
+  RB_STORE(&rb->tail, rb->tail + count);
+  ringbuf_spsc_wakeup(&rb->rsem, &rb->rwait);
+
+  return count;
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_read_acquire
+ *
+ * Description:
+ *   Gets the continuous stored data from the head. Called by the reader
+ *   only.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer.
+ *   ptr  Address of the stored data.
+ *
+ * Returned Value:
+ *   The number of bytes of the stored data.
+ *
+ ****************************************************************************/
+
+size_t ringbuf_spsc_read_acquire(FAR struct ringbuf_spsc_s *rb,
+                                 FAR uint8_t **ptr)
+{
+  size_t offset;
+  size_t used;
+
+  if (!rb || !ptr)
+    {
+      return 0;
+    }
+
+  offset = rb->head & rb->mask;
+  used   = ringbuf_spsc_used(rb);
+  *ptr   = rb->buf + offset;
+
+  return MIN(used, rb->size - offset);
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_read_release
+ *
+ * Description:
+ *   Frees the data referred through the acquired region. Called by the
+ *   reader only.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer.
+ *   count  Bytes consumed.
+ *
+ * Returned Value:
+ *   On success, count is returned.
+ *   On failure, negative value is returned according to <errno.h>.
+ *
+ ****************************************************************************/
+
+ssize_t ringbuf_spsc_read_release(FAR struct ringbuf_spsc_s *rb,
+                                  size_t count)
+{
+  if (!rb)
+    {
+      return -EINVAL;
+    }
+
+  if (ringbuf_spsc_used(rb) < count)
+    {
+      return -EINVAL;
+    }
+
+  RB_STORE(&rb->head, rb->head + count);
+  ringbuf_spsc_wakeup(&rb->wsem, &rb->wwait);
+
+  return count;
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_buffersize
+ *
+ * Description:
+ *   Gets the buffer size.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer.
+ *
+ * Returned Value:
+ *   The buffer size.
+ *
+ ****************************************************************************/
+
+size_t ringbuf_spsc_buffersize(FAR struct ringbuf_spsc_s *rb)
+{
+  if (!rb)
+    {
+      return 0;
+    }
+
+  return rb->size;
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_bytesused
+ *
+ * Description:
+ *   Gets the number of bytes used.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer.
+ *
+ * Returned Value:
+ *   The number of bytes used.
+ *
+ ****************************************************************************/
+
+size_t ringbuf_spsc_bytesused(FAR struct ringbuf_spsc_s *rb)
+{
+  if (!rb)
+    {
+      return 0;
+    }
+
+  return ringbuf_spsc_used(rb);
+}
+
+/****************************************************************************
+ * Name: ringbuf_spsc_bytesavail
+ *
+ * Description:
+ *   Gets the number of bytes free.
+ *
+ * Input Parameters:
+ *   rb  Pointer to a Ring Buffer.
+ *
+ * Returned Value:
+ *   The number of bytes free.
+ *
+ ****************************************************************************/
+
+size_t ringbuf_spsc_bytesavail(FAR struct ringbuf_spsc_s *rb)
+{
+  if (!rb)
+    {
+      return 0;
+    }
+
+  return rb->size - ringbuf_spsc_used(rb);
+}
@@ -108,7 +108,7 @@ int tflm_initialize(tflm_config_t *config)
       config = &cfg;
     }
 
-  if (config->cpu_num != 1)
+  if (config->cpu_num == 0)
     {
       return -EINVAL;
     }
@@ -129,6 +129,28 @@ int tflm_runtime_initialize(tflm_runtime_t *rt, const void *network,
                                   size);
 }
 
+int tflm_runtime_initialize_shared(tflm_runtime_t *rt,
+                                   const void *network,
+                                   const tflm_arena_t *arena)
+{
+  return tflm_supervisor_send_msg(TFLMRT_MSG_NRT_INIT_SHARED, 3, rt,
+                                  network, arena);
+}
+
+int tflm_runtime_probe_arenasize(const void *network, int max_size,
+                                 int *persistent_size)
+{
+  /* The temporary arena is allocated from this heap through the worker */
+
+  if (max_size == 0)
+    {
+      max_size = mallinfo().mxordblk;
+    }
+
+  return tflm_supervisor_send_msg(TFLMRT_MSG_NRT_PROBE_ARENASIZE, 3,
+                                  network, max_size, persistent_size);
+}
+
 int tflm_runtime_finalize(tflm_runtime_t *rt)
 {
   return tflm_supervisor_send_msg(TFLMRT_MSG_NRT_FINI, 1, rt);
@@ -141,6 +163,11 @@ int tflm_runtime_forward(tflm_runtime_t *rt, const void *inputs[],
                                   input_num);
 }
 
+int tflm_runtime_forward_inplace(tflm_runtime_t *rt)
+{
+  return tflm_supervisor_send_msg(TFLMRT_MSG_NRT_FOWARD_INPLACE, 1, rt);
+}
+
 int tflm_runtime_input_num(tflm_runtime_t *rt)
 {
   return tflm_supervisor_send_msg(TFLMRT_MSG_NRT_INPUT_NUM, 1, rt);
@@ -173,6 +200,13 @@ TfLiteTensor *tflm_runtime_input_variable(tflm_runtime_t *rt,
                                              2, rt, data_index);
 }
 
+void *tflm_runtime_input_buffer(tflm_runtime_t *rt,
+                                unsigned char data_index)
+{
+  return (void *)tflm_supervisor_send_msg(TFLMRT_MSG_NRT_INPUT_BUFFER,
+                                          2, rt, data_index);
+}
+
 int tflm_runtime_output_num(tflm_runtime_t *rt)
 {
   return tflm_supervisor_send_msg(TFLMRT_MSG_NRT_OUTPUT_NUM, 1, rt);
@@ -57,6 +57,10 @@ typedef enum
   TFLMRT_MSG_NRT_OUTPUT_BUFFER,
   TFLMRT_MSG_NRT_OUTPUT_VARIABLE,
   TFLMRT_MSG_NRT_ASMP_MALLINFO,
+  TFLMRT_MSG_NRT_FOWARD_INPLACE,
+  TFLMRT_MSG_NRT_INPUT_BUFFER,
+  TFLMRT_MSG_NRT_INIT_SHARED,
+  TFLMRT_MSG_NRT_PROBE_ARENASIZE,
 } tflm_msg_id_t;
 
 typedef struct tflm_msg
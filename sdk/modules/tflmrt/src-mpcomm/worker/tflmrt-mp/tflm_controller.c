@@ -45,11 +45,27 @@
 #include <tf_runtime.h>
 
 #include "tflm_controller.h"
+#include "tflm_exec_function.h"
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+static int tflm_runtime_setup(void)
+{
+  tf_rt_set_malloc(tflm_controller_malloc);
+  tf_rt_set_free(tflm_controller_free);
+
+  /* Split heavy kernels across the helpers if any */
+
+  if (mpcomm_get_helpers_num() > 0)
+    {
+      return tflm_exec_function_register();
+    }
+
+  return 0;
+}
+
 static int tflm_runtime_initialize(tflm_runtime_t *rt,
                                    const void *network,
                                    int size)
@@ -71,8 +87,11 @@ static int tflm_runtime_initialize(tflm_runtime_t *rt,
       return -EINVAL;
     }
 
-  tf_rt_set_malloc(tflm_controller_malloc);
-  tf_rt_set_free(tflm_controller_free);
+  ret = tflm_runtime_setup();
+  if (ret != 0)
+    {
+      return ret;
+    }
 
   ret = tf_rt_allocate_context((tf_rt_context_pointer *) &(rt->impl_ctx));
   if (ret != 0)
@@ -91,6 +110,83 @@ static int tflm_runtime_initialize(tflm_runtime_t *rt,
   return ret;
 }
 
+static int tflm_runtime_initialize_shared(tflm_runtime_t *rt,
+                                          const void *network,
+                                          const tflm_arena_t *arena)
+{
+  int ret;
+
+  if (!rt || !network || !arena)
+    {
+      return -EINVAL;
+    }
+
+  if (!arena->scratch || arena->scratch_size <= 0 ||
+      arena->persistent_size <= 0)
+    {
+      return -EINVAL;
+    }
+
+  ret = tflm_runtime_setup();
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  ret = tf_rt_allocate_context((tf_rt_context_pointer *) &(rt->impl_ctx));
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  return tf_rt_initialize_context_shared(rt->impl_ctx, network,
+                                         arena->scratch,
+                                         (size_t)arena->scratch_size,
+                                         (size_t)arena->persistent_size);
+}
+
+static int tflm_runtime_probe_arenasize(const void *network, int max_size,
+                                        int *persistent_size)
+{
+  int ret;
+  void *buf;
+  size_t persist;
+  size_t scratch;
+
+  if (!network || max_size <= 0)
+    {
+      return -EINVAL;
+    }
+
+  ret = tflm_runtime_setup();
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  buf = tflm_controller_malloc(max_size);
+  if (!buf)
+    {
+      return -ENOMEM;
+    }
+
+  ret = tf_rt_probe_arena(network, buf, (size_t)max_size,
+                          &persist, &scratch);
+  tflm_controller_free(buf);
+
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  if (persistent_size)
+    {
+      *persistent_size = (int)persist;
+    }
+
+  return (int)(persist + scratch);
+}
+
 static int tflm_runtime_finalize(tflm_runtime_t *rt)
 {
   if (rt == NULL)
@@ -118,14 +214,29 @@ static int tflm_runtime_forward(tflm_runtime_t *rt,
 
   for (int i = 0; i < input_num; ++i)
     {
-      memcpy(tf_rt_input_buffer(ctx, i),
-             inputs[i],
-             tf_rt_input_size(ctx, i));
+      void *buf = tf_rt_input_buffer(ctx, i);
+
+      /* Skip the copy when the supervisor wrote the data in place */
+
+      if (inputs[i] != MEM_V2P(buf))
+        {
+          memcpy(buf, inputs[i], tf_rt_input_size(ctx, i));
+        }
     }
 
   return tf_rt_forward(ctx);
 }
 
+static int tflm_runtime_forward_inplace(tflm_runtime_t *rt)
+{
+  if (rt == NULL)
+    {
+      return -EINVAL;
+    }
+
+  return tf_rt_forward((tf_rt_context_pointer)rt->impl_ctx);
+}
+
 static int tflm_runtime_input_num(tflm_runtime_t *rt)
 {
   if (rt == NULL)
@@ -183,6 +294,22 @@ static TfLiteTensor *tflm_runtime_input_variable(tflm_runtime_t *rt,
   return MEM_V2P(tf_rt_input_variable(rt->impl_ctx, data_index));
 }
 
+static void *tflm_runtime_input_buffer(tflm_runtime_t *rt,
+                                       unsigned char data_index)
+{
+  if (rt == NULL)
+    {
+      return NULL;
+    }
+
+  if (data_index >= tf_rt_num_of_input(rt->impl_ctx))
+    {
+      return NULL;
+    }
+
+  return MEM_V2P(tf_rt_input_buffer(rt->impl_ctx, (size_t)data_index));
+}
+
 static int tflm_runtime_output_num(tflm_runtime_t *rt)
 {
   if (rt == NULL)
@@ -271,6 +398,20 @@ void tflm_controller_handle_msg(void *data)
                                   (int)tflm_msg->arg[2]);
         break;
 
+      case TFLMRT_MSG_NRT_INIT_SHARED:
+        tflm_msg->ret =
+          tflm_runtime_initialize_shared((tflm_runtime_t *)tflm_msg->arg[0],
+                                         (const void *)tflm_msg->arg[1],
+                                         (tflm_arena_t *)tflm_msg->arg[2]);
+        break;
+
+      case TFLMRT_MSG_NRT_PROBE_ARENASIZE:
+        tflm_msg->ret =
+          tflm_runtime_probe_arenasize((const void *)tflm_msg->arg[0],
+                                       (int)tflm_msg->arg[1],
+                                       (int *)tflm_msg->arg[2]);
+        break;
+
       case TFLMRT_MSG_NRT_FINI:
         tflm_msg->ret =
           tflm_runtime_finalize((tflm_runtime_t *)tflm_msg->arg[0]);
@@ -283,6 +424,11 @@ void tflm_controller_handle_msg(void *data)
                                (unsigned char)tflm_msg->arg[2]);
         break;
 
+      case TFLMRT_MSG_NRT_FOWARD_INPLACE:
+        tflm_msg->ret =
+          tflm_runtime_forward_inplace((tflm_runtime_t *)tflm_msg->arg[0]);
+        break;
+
       case TFLMRT_MSG_NRT_INPUT_NUM:
         tflm_msg->ret =
           tflm_runtime_input_num((tflm_runtime_t *)tflm_msg->arg[0]);
@@ -314,6 +460,12 @@ void tflm_controller_handle_msg(void *data)
             (unsigned char)tflm_msg->arg[1]);
         break;
 
+      case TFLMRT_MSG_NRT_INPUT_BUFFER:
+        tflm_msg->ret =
+          (int)tflm_runtime_input_buffer((tflm_runtime_t *)tflm_msg->arg[0],
+                                         (unsigned char)tflm_msg->arg[1]);
+        break;
+
       case TFLMRT_MSG_NRT_OUTPUT_NUM:
         tflm_msg->ret =
           tflm_runtime_output_num((tflm_runtime_t *)tflm_msg->arg[0]);
@@ -61,8 +61,25 @@ typedef enum
   TFLMRT_MSG_NRT_OUTPUT_SHAPE,
   TFLMRT_MSG_NRT_OUTPUT_BUFFER,
   TFLMRT_MSG_NRT_OUTPUT_VARIABLE,
+  TFLMRT_MSG_NRT_ASMP_MALLINFO,
+  TFLMRT_MSG_NRT_FOWARD_INPLACE,
+  TFLMRT_MSG_NRT_INPUT_BUFFER,
+  TFLMRT_MSG_NRT_INIT_SHARED,
+  TFLMRT_MSG_NRT_PROBE_ARENASIZE,
 } tflm_msg_id_t;
 
+typedef enum
+{
+  TFLM_HELPER_EXEC_TASK,
+} tflm_helper_msg_id_t;
+
+typedef struct tflm_arena
+{
+  void *scratch;
+  int scratch_size;
+  int persistent_size;
+} tflm_arena_t;
+
 typedef struct tflm_msg
 {
   uint8_t id;
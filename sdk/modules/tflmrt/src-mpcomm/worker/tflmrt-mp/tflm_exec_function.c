@@ -0,0 +1,1004 @@
+/****************************************************************************
+ * modules/tflmrt/src-mpcomm/worker/tflmrt-mp/tflm_exec_function.c
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <mpcomm/mpcomm.h>
+
+#include <tf_runtime.h>
+#include "tensorflow/lite/c/builtin_op_data.h"
+
+#include "arm_nnfunctions.h"
+
+#include "tflm_controller.h"
+#include "tflm_exec_function.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define TFLM_MAX_TASKS  (MPCOMM_MAX_HELPERS + 1)
+
+/* Layers smaller than this run on the controller alone, since the round
+ * trip of the helper messages costs more than the split saves.
+ */
+
+#define TFLM_PARALLEL_MIN_MACS  (32 * 1024)
+
+#define TFLM_MIN(a, b)  ((a) < (b) ? (a) : (b))
+#define TFLM_MAX(a, b)  ((a) > (b) ? (a) : (b))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef enum
+{
+  TFLM_OP_CONV,
+  TFLM_OP_DEPTHWISE_CONV,
+  TFLM_OP_FULLY_CONNECTED,
+  TFLM_OP_NUM,
+} tflm_op_type_t;
+
+typedef struct tflm_op tflm_op_t;
+
+/* A task computes output rows [begin, end) of a convolution, or output
+ * units [begin, end) of a fully-connected layer. Convolution tasks read
+ * input rows [in_begin, in_end), which are padded by pad_top rows above.
+ */
+
+struct tflm_task
+{
+  tflm_op_t *op;
+  int begin;
+  int end;
+  int in_begin;
+  int in_end;
+  int pad_top;
+  int8_t *scratch;
+};
+
+/* Op data of a node. It is allocated in the arena, so that the helpers
+ * can read it while the controller waits for them.
+ */
+
+struct tflm_op
+{
+  tflm_op_type_t type;
+  const TfLiteRegistration *base;  /* Kernel for unsupported cases */
+  void *base_data;
+  bool parallel;
+  int task_num;
+  int scratch_idx;
+  int scratch_size;                /* Per task */
+
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+  cmsis_nn_tile stride;
+  cmsis_nn_tile padding;
+  cmsis_nn_tile dilation;
+  cmsis_nn_activation activation;
+  int32_t ch_mult;
+  int32_t input_offset;
+  int32_t filter_offset;
+  int32_t output_offset;
+  int32_t *multiplier;
+  int32_t *shift;
+
+  /* Tensor data of the running invocation */
+
+  const int8_t *input;
+  const int8_t *filter;
+  const int32_t *bias;
+  int8_t *output;
+
+  tflm_task_t tasks[TFLM_MAX_TASKS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const int g_builtin_ops[TFLM_OP_NUM] =
+{
+  TF_RT_OP_CONV_2D,
+  TF_RT_OP_DEPTHWISE_CONV_2D,
+  TF_RT_OP_FULLY_CONNECTED,
+};
+
+static TfLiteRegistration g_kernels[TFLM_OP_NUM];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Same as tflite::QuantizeMultiplier() */
+
+static void quantize_multiplier(double real, int32_t *multiplier,
+                                int32_t *shift)
+{
+  int exp;
+  int64_t q;
+
+  if (real == 0.)
+    {
+      *multiplier = 0;
+      *shift = 0;
+      return;
+    }
+
+  q = (int64_t)round(frexp(real, &exp) * (1ll << 31));
+  if (q == (1ll << 31))
+    {
+      q /= 2;
+      exp++;
+    }
+
+  if (exp < -31)
+    {
+      exp = 0;
+      q = 0;
+    }
+
+  *multiplier = (int32_t)q;
+  *shift = exp;
+}
+
+/* Same as tflite::CalculateActivationRangeQuantized() for int8 */
+
+static int calc_activation(TfLiteFusedActivation act,
+                           const TfLiteTensor *output,
+                           cmsis_nn_activation *range)
+{
+  float scale = output->params.scale;
+  int32_t zp = output->params.zero_point;
+
+  range->min = INT8_MIN;
+  range->max = INT8_MAX;
+
+  switch (act)
+    {
+      case kTfLiteActNone:
+        break;
+      case kTfLiteActRelu:
+        range->min = TFLM_MAX(range->min, zp);
+        break;
+      case kTfLiteActRelu6:
+        range->min = TFLM_MAX(range->min, zp);
+        range->max = TFLM_MIN(range->max,
+                              zp + (int32_t)roundf(6.f / scale));
+        break;
+      case kTfLiteActReluN1To1:
+        range->min = TFLM_MAX(range->min,
+                              zp + (int32_t)roundf(-1.f / scale));
+        range->max = TFLM_MIN(range->max,
+                              zp + (int32_t)roundf(1.f / scale));
+        break;
+      default:
+        return -EINVAL;
+    }
+
+  return 0;
+}
+
+/* Same as the padding of tflite::ComputePaddingHeightWidth(). The output
+ * size of the padding type is given by the output tensor.
+ */
+
+static int calc_padding(int stride, int dilation, int in_size,
+                        int filter_size, int out_size)
+{
+  int effective = (filter_size - 1) * dilation + 1;
+  int total = (out_size - 1) * stride + effective - in_size;
+
+  return total > 0 ? total / 2 : 0;
+}
+
+static bool is_int8_tensors(const TfLiteTensor *input,
+                            const TfLiteTensor *filter,
+                            const TfLiteTensor *bias,
+                            const TfLiteTensor *output)
+{
+  return input->type == kTfLiteInt8 && filter->type == kTfLiteInt8 &&
+         bias != NULL && bias->type == kTfLiteInt32 &&
+         output->type == kTfLiteInt8 &&
+         filter->quantization.type == kTfLiteAffineQuantization &&
+         filter->quantization.params != NULL;
+}
+
+static int alloc_quant_params(TfLiteContext *context, tflm_op_t *op,
+                              int num)
+{
+  op->multiplier = (int32_t *)
+    context->AllocatePersistentBuffer(context, num * sizeof(int32_t));
+  op->shift = (int32_t *)
+    context->AllocatePersistentBuffer(context, num * sizeof(int32_t));
+
+  return (op->multiplier && op->shift) ? 0 : -ENOMEM;
+}
+
+static int calc_task_num(int total, int macs)
+{
+  int helpers = mpcomm_get_helpers_num();
+
+  if (helpers <= 0 || macs < TFLM_PARALLEL_MIN_MACS || total < 2)
+    {
+      return 1;
+    }
+
+  return TFLM_MIN(helpers + 1, TFLM_MAX_TASKS);
+}
+
+static void split_load(tflm_op_t *op, int total)
+{
+  int load = (total + op->task_num - 1) / op->task_num;
+  int i;
+
+  memset(op->tasks, 0, sizeof(op->tasks));
+
+  for (i = 0; i < op->task_num; i++)
+    {
+      op->tasks[i].op = op;
+      op->tasks[i].begin = TFLM_MIN(i * load, total);
+      op->tasks[i].end = TFLM_MIN((i + 1) * load, total);
+    }
+}
+
+/* Find the input rows used by the output rows of each task */
+
+static void split_rows(tflm_op_t *op)
+{
+  int kh = (op->filter_dims.h - 1) * op->dilation.h + 1;
+  int i;
+
+  split_load(op, op->output_dims.h);
+
+  for (i = 0; i < op->task_num; i++)
+    {
+      tflm_task_t *t = &op->tasks[i];
+      int top;
+      int bottom;
+
+      if (t->begin == t->end)
+        {
+          continue;
+        }
+
+      top = t->begin * op->stride.h - op->padding.h;
+      bottom = (t->end - 1) * op->stride.h - op->padding.h + kh;
+
+      t->in_begin = TFLM_MAX(top, 0);
+      t->in_end = TFLM_MIN(bottom, op->input_dims.h);
+      t->pad_top = t->in_begin - top;
+    }
+}
+
+static void slice_dims(const tflm_task_t *t, cmsis_nn_dims *input_dims,
+                       cmsis_nn_dims *output_dims)
+{
+  *input_dims = t->op->input_dims;
+  *output_dims = t->op->output_dims;
+  input_dims->h = t->in_end - t->in_begin;
+  output_dims->h = t->end - t->begin;
+}
+
+static void conv_params(const tflm_task_t *t, cmsis_nn_conv_params *params)
+{
+  const tflm_op_t *op = t->op;
+
+  params->input_offset = op->input_offset;
+  params->output_offset = op->output_offset;
+  params->stride = op->stride;
+  params->padding.w = op->padding.w;
+  params->padding.h = t->pad_top;
+  params->dilation = op->dilation;
+  params->activation = op->activation;
+}
+
+static void dw_conv_params(const tflm_task_t *t,
+                           cmsis_nn_dw_conv_params *params)
+{
+  const tflm_op_t *op = t->op;
+
+  params->input_offset = op->input_offset;
+  params->output_offset = op->output_offset;
+  params->ch_mult = op->ch_mult;
+  params->stride = op->stride;
+  params->padding.w = op->padding.w;
+  params->padding.h = t->pad_top;
+  params->dilation = op->dilation;
+  params->activation = op->activation;
+}
+
+static int task_buffer_size(const tflm_task_t *t)
+{
+  const tflm_op_t *op = t->op;
+  cmsis_nn_conv_params params;
+  cmsis_nn_dw_conv_params dw_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+  cmsis_nn_dims filter_dims;
+
+  if (t->begin == t->end)
+    {
+      return 0;
+    }
+
+  switch (op->type)
+    {
+      case TFLM_OP_CONV:
+        conv_params(t, &params);
+        slice_dims(t, &input_dims, &output_dims);
+        return arm_convolve_wrapper_s8_get_buffer_size(&params,
+                                                       &input_dims,
+                                                       &op->filter_dims,
+                                                       &output_dims);
+      case TFLM_OP_DEPTHWISE_CONV:
+        dw_conv_params(t, &dw_params);
+        slice_dims(t, &input_dims, &output_dims);
+        return arm_depthwise_conv_wrapper_s8_get_buffer_size(
+                 &dw_params, &input_dims, &op->filter_dims, &output_dims);
+      case TFLM_OP_FULLY_CONNECTED:
+        filter_dims = op->filter_dims;
+        filter_dims.c = t->end - t->begin;
+        return arm_fully_connected_s8_get_buffer_size(&filter_dims);
+      default:
+        return 0;
+    }
+}
+
+/* Request a scratch buffer shared by the tasks in slices */
+
+static int request_scratch(TfLiteContext *context, tflm_op_t *op)
+{
+  int size = 0;
+  int i;
+
+  for (i = 0; i < op->task_num; i++)
+    {
+      size = TFLM_MAX(size, task_buffer_size(&op->tasks[i]));
+    }
+
+  op->scratch_size = (size + 3) & ~3;
+  op->scratch_idx = -1;
+
+  if (op->scratch_size == 0)
+    {
+      return 0;
+    }
+
+  if (context->RequestScratchBufferInArena(context,
+                                           op->scratch_size * op->task_num,
+                                           &op->scratch_idx) != kTfLiteOk)
+    {
+      return -ENOMEM;
+    }
+
+  return 0;
+}
+
+static int setup_conv(TfLiteContext *context, TfLiteNode *node,
+                      tflm_op_t *op)
+{
+  const TfLiteTensor *input;
+  const TfLiteTensor *filter;
+  const TfLiteTensor *bias;
+  const TfLiteTensor *output;
+  const TfLiteAffineQuantization *quant;
+  TfLiteFusedActivation act;
+  int stride_w;
+  int stride_h;
+  int dilation_w;
+  int dilation_h;
+  int channels;
+  int macs;
+  int ret;
+  int c;
+
+  if (node->inputs->size < 3 || node->inputs->data[2] < 0)
+    {
+      return -EINVAL;
+    }
+
+  input = context->GetTensor(context, node->inputs->data[0]);
+  filter = context->GetTensor(context, node->inputs->data[1]);
+  bias = context->GetTensor(context, node->inputs->data[2]);
+  output = context->GetTensor(context, node->outputs->data[0]);
+
+  if (!is_int8_tensors(input, filter, bias, output) ||
+      input->dims->size != 4 || output->dims->size != 4 ||
+      input->dims->data[0] != 1)
+    {
+      return -EINVAL;
+    }
+
+  if (op->type == TFLM_OP_CONV)
+    {
+      const TfLiteConvParams *params =
+        (const TfLiteConvParams *)node->builtin_data;
+
+      act = params->activation;
+      stride_w = params->stride_width;
+      stride_h = params->stride_height;
+      dilation_w = params->dilation_width_factor;
+      dilation_h = params->dilation_height_factor;
+      op->ch_mult = 1;
+    }
+  else
+    {
+      const TfLiteDepthwiseConvParams *params =
+        (const TfLiteDepthwiseConvParams *)node->builtin_data;
+
+      act = params->activation;
+      stride_w = params->stride_width;
+      stride_h = params->stride_height;
+      dilation_w = params->dilation_width_factor;
+      dilation_h = params->dilation_height_factor;
+      op->ch_mult = params->depth_multiplier;
+    }
+
+  if (dilation_w != 1 || dilation_h != 1)
+    {
+      return -EINVAL;
+    }
+
+  op->input_dims.n = 1;
+  op->input_dims.h = input->dims->data[1];
+  op->input_dims.w = input->dims->data[2];
+  op->input_dims.c = input->dims->data[3];
+  op->output_dims.n = 1;
+  op->output_dims.h = output->dims->data[1];
+  op->output_dims.w = output->dims->data[2];
+  op->output_dims.c = output->dims->data[3];
+  channels = op->output_dims.c;
+
+  /* Filter is [out_c, h, w, in_c] for conv, [1, h, w, out_c] otherwise */
+
+  op->filter_dims.n = op->type == TFLM_OP_CONV ? channels : 1;
+  op->filter_dims.h = filter->dims->data[1];
+  op->filter_dims.w = filter->dims->data[2];
+  op->filter_dims.c = op->type == TFLM_OP_CONV ? op->input_dims.c
+                                                : channels;
+  op->bias_dims.n = 1;
+  op->bias_dims.h = 1;
+  op->bias_dims.w = 1;
+  op->bias_dims.c = channels;
+
+  op->stride.w = stride_w;
+  op->stride.h = stride_h;
+  op->dilation.w = dilation_w;
+  op->dilation.h = dilation_h;
+  op->padding.w = calc_padding(stride_w, dilation_w, op->input_dims.w,
+                               op->filter_dims.w, op->output_dims.w);
+  op->padding.h = calc_padding(stride_h, dilation_h, op->input_dims.h,
+                               op->filter_dims.h, op->output_dims.h);
+
+  if (calc_activation(act, output, &op->activation) != 0)
+    {
+      return -EINVAL;
+    }
+
+  /* Per-channel requantization, same as
+   * tflite::PopulateConvolutionQuantizationParams()
+   */
+
+  quant = (const TfLiteAffineQuantization *)filter->quantization.params;
+  if (quant->scale == NULL ||
+      (quant->scale->size != 1 && quant->scale->size != channels))
+    {
+      return -EINVAL;
+    }
+
+  ret = alloc_quant_params(context, op, channels);
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  for (c = 0; c < channels; c++)
+    {
+      float filter_scale = quant->scale->data[quant->scale->size == 1 ?
+                                              0 : c];
+
+      quantize_multiplier((double)input->params.scale *
+                          (double)filter_scale /
+                          (double)output->params.scale,
+                          &op->multiplier[c], &op->shift[c]);
+    }
+
+  op->input_offset = -input->params.zero_point;
+  op->filter_offset = 0;
+  op->output_offset = output->params.zero_point;
+
+  macs = op->output_dims.h * op->output_dims.w * channels *
+         op->filter_dims.h * op->filter_dims.w;
+  if (op->type == TFLM_OP_CONV)
+    {
+      macs *= op->input_dims.c;
+    }
+
+  op->task_num = calc_task_num(op->output_dims.h, macs);
+  split_rows(op);
+
+  return request_scratch(context, op);
+}
+
+static int setup_fully_connected(TfLiteContext *context, TfLiteNode *node,
+                                 tflm_op_t *op)
+{
+  const TfLiteFullyConnectedParams *params =
+    (const TfLiteFullyConnectedParams *)node->builtin_data;
+  const TfLiteTensor *input;
+  const TfLiteTensor *filter;
+  const TfLiteTensor *bias;
+  const TfLiteTensor *output;
+  const TfLiteAffineQuantization *quant;
+  int accum_depth;
+  int units;
+  int elems;
+  int ret;
+  int i;
+
+  if (node->inputs->size < 3 || node->inputs->data[2] < 0)
+    {
+      return -EINVAL;
+    }
+
+  input = context->GetTensor(context, node->inputs->data[0]);
+  filter = context->GetTensor(context, node->inputs->data[1]);
+  bias = context->GetTensor(context, node->inputs->data[2]);
+  output = context->GetTensor(context, node->outputs->data[0]);
+
+  if (!is_int8_tensors(input, filter, bias, output) ||
+      filter->dims->size != 2 ||
+      params->weights_format != kTfLiteFullyConnectedWeightsFormatDefault)
+    {
+      return -EINVAL;
+    }
+
+  units = filter->dims->data[0];
+  accum_depth = filter->dims->data[1];
+
+  for (i = 0, elems = 1; i < input->dims->size; i++)
+    {
+      elems *= input->dims->data[i];
+    }
+
+  /* Only a single batch is split by output units */
+
+  if (elems != accum_depth)
+    {
+      return -EINVAL;
+    }
+
+  quant = (const TfLiteAffineQuantization *)filter->quantization.params;
+  if (quant->scale == NULL || quant->scale->size != 1)
+    {
+      return -EINVAL;
+    }
+
+  if (calc_activation(params->activation, output, &op->activation) != 0)
+    {
+      return -EINVAL;
+    }
+
+  ret = alloc_quant_params(context, op, 1);
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  /* Same as tflite::GetQuantizedConvolutionMultipler() */
+
+  quantize_multiplier((double)(input->params.scale *
+                               filter->params.scale) /
+                      (double)output->params.scale,
+                      op->multiplier, op->shift);
+
+  op->input_offset = -input->params.zero_point;
+  op->filter_offset = -filter->params.zero_point;
+  op->output_offset = output->params.zero_point;
+
+  op->input_dims.n = 1;
+  op->input_dims.h = 1;
+  op->input_dims.w = 1;
+  op->input_dims.c = accum_depth;
+  op->filter_dims.n = accum_depth;
+  op->filter_dims.h = 1;
+  op->filter_dims.w = 1;
+  op->filter_dims.c = units;
+  op->bias_dims.n = 1;
+  op->bias_dims.h = 1;
+  op->bias_dims.w = 1;
+  op->bias_dims.c = units;
+  op->output_dims.n = 1;
+  op->output_dims.h = 1;
+  op->output_dims.w = 1;
+  op->output_dims.c = units;
+
+  op->task_num = calc_task_num(units, units * accum_depth);
+  split_load(op, units);
+
+  return request_scratch(context, op);
+}
+
+static int exec_conv(tflm_task_t *t)
+{
+  tflm_op_t *op = t->op;
+  cmsis_nn_context ctx;
+  cmsis_nn_conv_params params;
+  cmsis_nn_per_channel_quant_params quant;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+  arm_status status;
+
+  ctx.buf = t->scratch;
+  ctx.size = op->scratch_size;
+  quant.multiplier = op->multiplier;
+  quant.shift = op->shift;
+  conv_params(t, &params);
+  slice_dims(t, &input_dims, &output_dims);
+
+  status = arm_convolve_wrapper_s8(&ctx, &params, &quant,
+                                   &input_dims,
+                                   op->input + t->in_begin *
+                                   input_dims.w * input_dims.c,
+                                   &op->filter_dims, op->filter,
+                                   &op->bias_dims, op->bias,
+                                   &output_dims,
+                                   op->output + t->begin *
+                                   output_dims.w * output_dims.c);
+
+  return status == ARM_MATH_SUCCESS ? 0 : -EINVAL;
+}
+
+static int exec_depthwise_conv(tflm_task_t *t)
+{
+  tflm_op_t *op = t->op;
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params params;
+  cmsis_nn_per_channel_quant_params quant;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+  arm_status status;
+
+  ctx.buf = t->scratch;
+  ctx.size = op->scratch_size;
+  quant.multiplier = op->multiplier;
+  quant.shift = op->shift;
+  dw_conv_params(t, &params);
+  slice_dims(t, &input_dims, &output_dims);
+
+  status = arm_depthwise_conv_wrapper_s8(&ctx, &params, &quant,
+                                         &input_dims,
+                                         op->input + t->in_begin *
+                                         input_dims.w * input_dims.c,
+                                         &op->filter_dims, op->filter,
+                                         &op->bias_dims, op->bias,
+                                         &output_dims,
+                                         op->output + t->begin *
+                                         output_dims.w * output_dims.c);
+
+  return status == ARM_MATH_SUCCESS ? 0 : -EINVAL;
+}
+
+static int exec_fully_connected(tflm_task_t *t)
+{
+  tflm_op_t *op = t->op;
+  cmsis_nn_context ctx;
+  cmsis_nn_fc_params params;
+  cmsis_nn_per_tensor_quant_params quant;
+  cmsis_nn_dims filter_dims = op->filter_dims;
+  cmsis_nn_dims bias_dims = op->bias_dims;
+  cmsis_nn_dims output_dims = op->output_dims;
+  arm_status status;
+
+  ctx.buf = t->scratch;
+  ctx.size = op->scratch_size;
+  params.input_offset = op->input_offset;
+  params.filter_offset = op->filter_offset;
+  params.output_offset = op->output_offset;
+  params.activation = op->activation;
+  quant.multiplier = op->multiplier[0];
+  quant.shift = op->shift[0];
+
+  /* Filter rows, bias and output of the units [begin, end) */
+
+  filter_dims.c = t->end - t->begin;
+  bias_dims.c = filter_dims.c;
+  output_dims.c = filter_dims.c;
+
+  status = arm_fully_connected_s8(&ctx, &params, &quant,
+                                  &op->input_dims, op->input,
+                                  &filter_dims,
+                                  op->filter + t->begin * filter_dims.n,
+                                  &bias_dims, op->bias + t->begin,
+                                  &output_dims, op->output + t->begin);
+
+  return status == ARM_MATH_SUCCESS ? 0 : -EINVAL;
+}
+
+static int exec_tasks(tflm_op_t *op)
+{
+  tflm_msg_t tflm_msg[MPCOMM_MAX_HELPERS];
+  int helpers = op->task_num - 1;
+  int ret;
+  int i;
+
+  for (i = 0; i < helpers; i++)
+    {
+      tflm_msg[i].id = TFLM_HELPER_EXEC_TASK;
+      tflm_msg[i].arg[0] = (int)&op->tasks[i];
+      tflm_msg[i].ret = 0;
+      mpcomm_send_helper(i, MEM_V2P(&tflm_msg[i]));
+    }
+
+  /* The controller takes the last task while the helpers run theirs */
+
+  ret = tflm_exec_task(&op->tasks[helpers]);
+
+  if (helpers > 0)
+    {
+      mpcomm_wait_helpers_done();
+
+      for (i = 0; i < helpers; i++)
+        {
+          if (tflm_msg[i].ret != 0)
+            {
+              ret = tflm_msg[i].ret;
+            }
+        }
+    }
+
+  return ret;
+}
+
+static TfLiteStatus call_base(TfLiteContext *context, TfLiteNode *node,
+                              TfLiteStatus (*func)(TfLiteContext *,
+                                                   TfLiteNode *))
+{
+  tflm_op_t *op = (tflm_op_t *)node->user_data;
+  TfLiteStatus status = kTfLiteOk;
+
+  if (func != NULL)
+    {
+      node->user_data = op->base_data;
+      status = func(context, node);
+      node->user_data = op;
+    }
+
+  return status;
+}
+
+static void *op_init(TfLiteContext *context, const char *buffer,
+                     size_t length, tflm_op_type_t type)
+{
+  tflm_op_t *op = (tflm_op_t *)
+    context->AllocatePersistentBuffer(context, sizeof(tflm_op_t));
+
+  if (op == NULL)
+    {
+      return NULL;
+    }
+
+  memset(op, 0, sizeof(tflm_op_t));
+  op->type = type;
+  op->scratch_idx = -1;
+  op->base = tf_rt_base_kernel(g_builtin_ops[type]);
+
+  if (op->base != NULL && op->base->init != NULL)
+    {
+      op->base_data = op->base->init(context, buffer, length);
+    }
+
+  return op;
+}
+
+static void *conv_init(TfLiteContext *context, const char *buffer,
+                       size_t length)
+{
+  return op_init(context, buffer, length, TFLM_OP_CONV);
+}
+
+static void *depthwise_conv_init(TfLiteContext *context,
+                                 const char *buffer, size_t length)
+{
+  return op_init(context, buffer, length, TFLM_OP_DEPTHWISE_CONV);
+}
+
+static void *fully_connected_init(TfLiteContext *context,
+                                  const char *buffer, size_t length)
+{
+  return op_init(context, buffer, length, TFLM_OP_FULLY_CONNECTED);
+}
+
+static void op_free(TfLiteContext *context, void *buffer)
+{
+  tflm_op_t *op = (tflm_op_t *)buffer;
+
+  if (op != NULL && op->base != NULL && op->base->free != NULL)
+    {
+      op->base->free(context, op->base_data);
+    }
+}
+
+static TfLiteStatus op_prepare(TfLiteContext *context, TfLiteNode *node)
+{
+  tflm_op_t *op = (tflm_op_t *)node->user_data;
+  int ret;
+
+  if (op == NULL)
+    {
+      return kTfLiteError;
+    }
+
+  if (op->type == TFLM_OP_FULLY_CONNECTED)
+    {
+      ret = setup_fully_connected(context, node, op);
+    }
+  else
+    {
+      ret = setup_conv(context, node, op);
+    }
+
+  if (ret == -ENOMEM)
+    {
+      return kTfLiteError;
+    }
+
+  op->parallel = (ret == 0);
+  if (op->parallel)
+    {
+      return kTfLiteOk;
+    }
+
+  /* Leave unsupported cases to the original kernel */
+
+  if (op->base == NULL)
+    {
+      return kTfLiteError;
+    }
+
+  return call_base(context, node, op->base->prepare);
+}
+
+static TfLiteStatus op_invoke(TfLiteContext *context, TfLiteNode *node)
+{
+  tflm_op_t *op = (tflm_op_t *)node->user_data;
+  int8_t *scratch = NULL;
+  int i;
+
+  if (!op->parallel)
+    {
+      return call_base(context, node, op->base->invoke);
+    }
+
+  op->input = context->GetEvalTensor(context,
+                                     node->inputs->data[0])->data.int8;
+  op->filter = context->GetEvalTensor(context,
+                                      node->inputs->data[1])->data.int8;
+  op->bias = context->GetEvalTensor(context,
+                                    node->inputs->data[2])->data.i32;
+  op->output = context->GetEvalTensor(context,
+                                      node->outputs->data[0])->data.int8;
+
+  if (op->scratch_idx >= 0)
+    {
+      scratch = (int8_t *)context->GetScratchBuffer(context,
+                                                    op->scratch_idx);
+    }
+
+  for (i = 0; i < op->task_num; i++)
+    {
+      op->tasks[i].scratch = scratch ? scratch + i * op->scratch_size
+                                     : NULL;
+    }
+
+  return exec_tasks(op) == 0 ? kTfLiteOk : kTfLiteError;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int tflm_exec_task(tflm_task_t *task)
+{
+  if (task->begin >= task->end)
+    {
+      return 0;
+    }
+
+  switch (task->op->type)
+    {
+      case TFLM_OP_CONV:
+        return exec_conv(task);
+      case TFLM_OP_DEPTHWISE_CONV:
+        return exec_depthwise_conv(task);
+      case TFLM_OP_FULLY_CONNECTED:
+        return exec_fully_connected(task);
+      default:
+        return -EINVAL;
+    }
+}
+
+int tflm_exec_function_register(void)
+{
+  static void *(*const inits[TFLM_OP_NUM])(TfLiteContext *,
+                                           const char *, size_t) =
+  {
+    conv_init,
+    depthwise_conv_init,
+    fully_connected_init,
+  };
+
+  const TfLiteRegistration *base;
+  int ret;
+  int i;
+
+  for (i = 0; i < TFLM_OP_NUM; i++)
+    {
+      /* Ops which the resolver doesn't have are not used by the model */
+
+      base = tf_rt_base_kernel(g_builtin_ops[i]);
+      if (base == NULL)
+        {
+          continue;
+        }
+
+      g_kernels[i] = *base;
+      g_kernels[i].init = inits[i];
+      g_kernels[i].free = op_free;
+      g_kernels[i].prepare = op_prepare;
+      g_kernels[i].invoke = op_invoke;
+
+      ret = tf_rt_set_kernel(g_builtin_ops[i], &g_kernels[i]);
+      if (ret != 0)
+        {
+          return ret;
+        }
+    }
+
+  return 0;
+}
@@ -40,6 +40,7 @@
 #include <mpcomm/mpcomm.h>
 
 #include "tflm_controller.h"
+#include "tflm_helper.h"
 
 /****************************************************************************
  * Public Functions
@@ -57,5 +58,5 @@ int printf(const char *fmt, ...)
 
 int main(void)
 {
-  return mpcomm_main(tflm_controller_handle_msg, NULL);
+  return mpcomm_main(tflm_controller_handle_msg, tflm_helper_handle_msg);
 }
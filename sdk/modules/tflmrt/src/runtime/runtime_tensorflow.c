@@ -118,6 +118,95 @@ int tflm_runtime_initialize(tflm_runtime_t *rt,
   return ret;
 }
 
+int tflm_runtime_initialize_shared(tflm_runtime_t *rt,
+                                   const void *network,
+                                   const tflm_arena_t *arena)
+{
+  int ret;
+
+  if (!rt)
+    {
+      tflm_err("rt is null.\n");
+      return -EINVAL;
+    }
+
+  if (!network)
+    {
+      tflm_err("network is null.\n");
+      return -EINVAL;
+    }
+
+  if (!arena || !arena->scratch || arena->scratch_size <= 0 ||
+      arena->persistent_size <= 0)
+    {
+      tflm_err("arena is invalid.\n");
+      return -EINVAL;
+    }
+
+  RegisterDebugLogCallback(debug_log_printf);
+
+  ret = tf_rt_allocate_context((tf_rt_context_pointer *) &(rt->impl_ctx));
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  return tf_rt_initialize_context_shared(rt->impl_ctx, network,
+                                         arena->scratch,
+                                         (size_t)arena->scratch_size,
+                                         (size_t)arena->persistent_size);
+}
+
+int tflm_runtime_probe_arenasize(const void *network, int max_size,
+                                 int *persistent_size)
+{
+  int ret;
+  void *buf;
+  size_t persist;
+  size_t scratch;
+
+  if (!network)
+    {
+      tflm_err("network is null.\n");
+      return -EINVAL;
+    }
+
+  if (max_size < 0)
+    {
+      return -EINVAL;
+    }
+
+  if (max_size == 0)
+    {
+      max_size = mallinfo().mxordblk;
+    }
+
+  RegisterDebugLogCallback(debug_log_printf);
+
+  buf = malloc(max_size);
+  if (!buf)
+    {
+      tflm_err("no memory to probe arena.\n");
+      return -ENOMEM;
+    }
+
+  ret = tf_rt_probe_arena(network, buf, (size_t)max_size,
+                          &persist, &scratch);
+  free(buf);
+
+  if (ret != 0)
+    {
+      return ret;
+    }
+
+  if (persistent_size)
+    {
+      *persistent_size = (int)persist;
+    }
+
+  return (int)(persist + scratch);
+}
+
 int tflm_runtime_finalize(tflm_runtime_t *rt)
 {
   if (!rt)
@@ -146,14 +235,30 @@ int tflm_runtime_forward(tflm_runtime_t *rt, const void *inputs[],
 
   for (int i = 0; i < input_num; ++i)
     {
-      memcpy(tf_rt_input_buffer(ctx, i),
-             inputs[i],
-             tf_rt_input_size(ctx, i));
+      void *buf = tf_rt_input_buffer(ctx, i);
+
+      /* Skip the copy when the caller wrote the data in place */
+
+      if (inputs[i] != buf)
+        {
+          memcpy(buf, inputs[i], tf_rt_input_size(ctx, i));
+        }
     }
 
   return tf_rt_forward(ctx);
 }
 
+int tflm_runtime_forward_inplace(tflm_runtime_t *rt)
+{
+  if (!rt)
+    {
+      tflm_err("rt is null.\n");
+      return -EINVAL;
+    }
+
+  return tf_rt_forward((tf_rt_context_pointer) rt->impl_ctx);
+}
+
 int tflm_runtime_input_num(tflm_runtime_t *rt)
 {
   if (!rt)
@@ -213,7 +318,8 @@ tflm_runtime_input_shape(tflm_runtime_t *rt, unsigned char data_index,
                            dim_index);
 }
 
-void *tflm_input_buffer(tflm_runtime_t *rt, unsigned char data_index)
+void *tflm_runtime_input_buffer(tflm_runtime_t *rt,
+                                unsigned char data_index)
 {
   if (!rt)
     {
@@ -221,9 +327,20 @@ void *tflm_input_buffer(tflm_runtime_t *rt, unsigned char data_index)
       return NULL;
     }
 
+  if (data_index >= tf_rt_num_of_input(rt->impl_ctx))
+    {
+      tflm_err("data_index is out of range.\n");
+      return NULL;
+    }
+
   return tf_rt_input_buffer(rt->impl_ctx, (size_t) data_index);
 }
 
+void *tflm_input_buffer(tflm_runtime_t *rt, unsigned char data_index)
+{
+  return tflm_runtime_input_buffer(rt, data_index);
+}
+
 TfLiteTensor *tflm_runtime_input_variable(tflm_runtime_t *rt,
                                           unsigned char data_index)
 {
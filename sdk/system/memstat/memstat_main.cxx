@@ -0,0 +1,234 @@
+/****************************************************************************
+ * system/memstat/memstat_main.cxx
+ *
+ *   Copyright 2026 Sony Semiconductor Solutions Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Sony Semiconductor Solutions Corporation nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <sdk/config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef CONFIG_CXD56_BACKUPLOG
+#include <arch/chip/backuplog.h>
+#endif
+
+#include "memutils/memory_manager/Manager.h"
+
+using namespace MemMgrLite;
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MEMSTAT_MAX_POOLS   63   /* Pool ID is 6 bits and 0 is reserved */
+#define MEMSTAT_LOG_NAME    "MEMSTAT"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static PoolStats g_stats[MEMSTAT_MAX_POOLS];
+
+static const char *g_type_name[] =
+{
+  "Basic", "RingBuf", "SizeCls"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void show_usage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [-r] [-s] [section]\n", progname);
+  fprintf(stderr, "  -r: reset the statistics after showing them\n");
+#ifdef CONFIG_CXD56_BACKUPLOG
+  fprintf(stderr, "  -s: store the statistics in the backup log (see logsave)\n");
+#endif
+  fprintf(stderr, "  section: memory section number (default 0)\n");
+}
+
+/* Format the header (stats == NULL) or a line of a pool.
+ * The return value is the same as snprintf().
+ */
+
+static int format_line(FAR char *buf, size_t size, uint8_t sec,
+                       FAR const PoolStats *stats)
+{
+  if (stats == NULL)
+    {
+      return snprintf(buf, size,
+                      "Sec Pool Type    Segs Used Peak MinFree"
+                      "     Allocs      Frees  Fails MaxHold(us)\n");
+    }
+
+  return snprintf(buf, size,
+                  "%3d %4d %-7s %4d %4d %4d %7d %10lu %10lu %6lu %11lu\n",
+                  sec, stats->id.pool,
+                  (stats->type < NumPoolTypes) ?
+                    g_type_name[stats->type] : "?",
+                  stats->num_segs, stats->used_segs, stats->max_used_segs,
+                  stats->min_avail_segs,
+                  (unsigned long)stats->alloc_count,
+                  (unsigned long)stats->free_count,
+                  (unsigned long)stats->alloc_fails,
+                  (unsigned long)stats->max_hold_us);
+}
+
+#ifdef CONFIG_CXD56_BACKUPLOG
+static int save_backuplog(uint8_t sec, uint32_t num)
+{
+  size_t size = 0;
+  uint32_t i;
+
+  size += format_line(NULL, 0, sec, NULL);
+  for (i = 0; i < num; i++)
+    {
+      size += format_line(NULL, 0, sec, &g_stats[i]);
+    }
+
+  /* Replace the previous snapshot not saved yet. */
+
+  up_backuplog_free(MEMSTAT_LOG_NAME);
+
+  FAR char *log = (FAR char *)up_backuplog_alloc(MEMSTAT_LOG_NAME, size);
+  if (log == NULL)
+    {
+      printf("Backup log allocation failed (%d bytes)\n", (int)size);
+      return EXIT_FAILURE;
+    }
+
+  /* snprintf() needs space for the terminator, so write each line
+   * through a local buffer.
+   */
+
+  char line[96];
+  size_t pos = 0;
+  int len;
+
+  len = format_line(line, sizeof(line), sec, NULL);
+  memcpy(log + pos, line, len);
+  pos += len;
+  for (i = 0; i < num; i++)
+    {
+      len = format_line(line, sizeof(line), sec, &g_stats[i]);
+      memcpy(log + pos, line, len);
+      pos += len;
+    }
+
+  printf("Stored in backup log \"%s\" (%d bytes)\n", MEMSTAT_LOG_NAME, (int)size);
+
+  return EXIT_SUCCESS;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+extern "C" int main(int argc, FAR char *argv[])
+{
+  bool reset = false;
+  bool save = false;
+  uint8_t sec = 0;
+  uint32_t num;
+  uint32_t i;
+  int option;
+  int ret = EXIT_SUCCESS;
+  char line[96];
+
+  while ((option = getopt(argc, argv, "rsh")) >= 0)
+    {
+      switch (option)
+        {
+          case 'r':
+            reset = true;
+            break;
+
+          case 's':
+            save = true;
+            break;
+
+          case 'h':
+          default:
+            show_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+  if (optind < argc)
+    {
+      sec = (uint8_t)strtoul(argv[optind], NULL, 10);
+    }
+
+  num = Manager::getStaticPoolsStats(sec, g_stats, MEMSTAT_MAX_POOLS);
+  if (num == 0)
+    {
+      printf("No pools in section %d\n", sec);
+      return EXIT_FAILURE;
+    }
+
+  format_line(line, sizeof(line), sec, NULL);
+  printf("%s", line);
+  for (i = 0; i < num; i++)
+    {
+      format_line(line, sizeof(line), sec, &g_stats[i]);
+      printf("%s", line);
+    }
+
+  if (save)
+    {
+#ifdef CONFIG_CXD56_BACKUPLOG
+      ret = save_backuplog(sec, num);
+#else
+      printf("Backup log is not supported\n");
+      ret = EXIT_FAILURE;
+#endif
+    }
+
+  if (reset)
+    {
+      for (i = 0; i < num; i++)
+        {
+          Manager::resetPoolStats(g_stats[i].id);
+        }
+    }
+
+  return ret;
+}